@@ -0,0 +1,250 @@
+// AudioBenchmarks: decode throughput per codec, both whole-file (what buffer
+// loads do) and in 250 ms pulls (what streams do). PCM and IMA-ADPCM fixtures
+// are generated in the temp directory; Vorbis needs a file, passed in through
+// the PILLAR_BENCH_OGG environment variable, and is skipped otherwise.
+// Also measures the software mixer backend: voices mixed per millisecond.
+#include "BenchmarkUtils.h"
+#include "Pillar/Audio/AudioBuffer.h"
+#include "Pillar/Audio/AudioDecoder.h"
+#include "Pillar/Audio/AudioEngine.h"
+#include "Pillar/Audio/AudioSource.h"
+#include "Pillar/Audio/WavDecoder.h"
+#include "Pillar/Audio/WavLoader.h"
+#include "Platform/Software/SoftwareMixer.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Pillar;
+
+namespace {
+
+	enum Codec : int64_t { Pcm = 0, ImaAdpcm = 1, Vorbis = 2 };
+
+	constexpr int kSampleRate = 44100;
+	constexpr int kChannels = 2;
+	constexpr uint64_t kFrames = 10ull * kSampleRate;	// 10 s of music-like stereo
+
+	std::vector<int16_t> MakeSignal()
+	{
+		// Two detuned partials so ADPCM has to track a moving waveform
+		std::vector<int16_t> samples(kFrames * kChannels);
+		for (uint64_t i = 0; i < kFrames; ++i)
+		{
+			const double t = static_cast<double>(i) / kSampleRate;
+			for (int c = 0; c < kChannels; ++c)
+				samples[i * kChannels + c] = static_cast<int16_t>(
+					6000.0 * std::sin(t * 2.0 * 3.14159265 * (220.0 + c)) +
+					3000.0 * std::sin(t * 2.0 * 3.14159265 * 1375.0));
+		}
+		return samples;
+	}
+
+	void WritePcmWav(const std::string& path, const std::vector<int16_t>& samples)
+	{
+		std::ofstream file(path, std::ios::binary);
+		const auto dataSize = static_cast<uint32_t>(samples.size() * sizeof(int16_t));
+		const uint32_t chunkSize = 36 + dataSize, fmtSize = 16, sampleRate = kSampleRate;
+		const uint32_t byteRate = kSampleRate * kChannels * 2;
+		const uint16_t format = 1, channels = kChannels, blockAlign = kChannels * 2, bits = 16;
+
+		file.write("RIFF", 4);
+		file.write(reinterpret_cast<const char*>(&chunkSize), 4);
+		file.write("WAVEfmt ", 8);
+		file.write(reinterpret_cast<const char*>(&fmtSize), 4);
+		file.write(reinterpret_cast<const char*>(&format), 2);
+		file.write(reinterpret_cast<const char*>(&channels), 2);
+		file.write(reinterpret_cast<const char*>(&sampleRate), 4);
+		file.write(reinterpret_cast<const char*>(&byteRate), 4);
+		file.write(reinterpret_cast<const char*>(&blockAlign), 2);
+		file.write(reinterpret_cast<const char*>(&bits), 2);
+		file.write("data", 4);
+		file.write(reinterpret_cast<const char*>(&dataSize), 4);
+		file.write(reinterpret_cast<const char*>(samples.data()), dataSize);
+	}
+
+	// Path of the fixture for a codec, written on first use; empty if unavailable
+	std::string FixturePath(int64_t codec)
+	{
+		static const std::string pcmPath = [] {
+			auto path = (std::filesystem::temp_directory_path() / "pillar_bench_pcm.wav").string();
+			WritePcmWav(path, MakeSignal());
+			return path;
+		}();
+		static const std::string adpcmPath = [] {
+			auto path = (std::filesystem::temp_directory_path() / "pillar_bench_adpcm.wav").string();
+			const auto samples = MakeSignal();
+			ImaAdpcmDecoder::Encode(path, samples.data(), kFrames, kChannels, kSampleRate, 2048);
+			return path;
+		}();
+
+		switch (codec)
+		{
+			case Pcm:		return pcmPath;
+			case ImaAdpcm:	return adpcmPath;
+			default:
+			{
+				const char* ogg = std::getenv("PILLAR_BENCH_OGG");
+				return ogg ? std::string(ogg) : std::string();
+			}
+		}
+	}
+
+	const char* CodecLabel(int64_t codec)
+	{
+		switch (codec)
+		{
+			case Pcm:		return "pcm16";
+			case ImaAdpcm:	return "ima-adpcm";
+			default:		return "vorbis";
+		}
+	}
+
+	// Frames per second plus "xRealtime": seconds of audio decoded per second
+	void SetDecodeCounters(benchmark::State& state, const AudioDecoder& decoder, uint64_t framesPerIteration)
+	{
+		PillarBench::SetThroughput(state, static_cast<int64_t>(framesPerIteration));
+		state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * framesPerIteration * decoder.GetFrameSize()));
+		state.counters["xRealtime"] = benchmark::Counter(
+			static_cast<double>(state.iterations() * framesPerIteration) / decoder.GetSampleRate(),
+			benchmark::Counter::kIsRate);
+		state.counters["FileBytes"] = static_cast<double>(std::filesystem::file_size(FixturePath(state.range(0))));
+		state.SetLabel(CodecLabel(state.range(0)));
+	}
+
+	std::unique_ptr<AudioDecoder> OpenFixture(benchmark::State& state)
+	{
+		const std::string path = FixturePath(state.range(0));
+		auto decoder = path.empty() ? nullptr : AudioDecoder::Open(path);
+		if (!decoder)
+			state.SkipWithMessage("No fixture for this codec (set PILLAR_BENCH_OGG for Vorbis)");
+		return decoder;
+	}
+
+	void ApplyCodecs(benchmark::internal::Benchmark* bench)
+	{
+		bench->Arg(Pcm)->Arg(ImaAdpcm)->Arg(Vorbis);
+	}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Whole-file decode (AudioBuffer loads, the async scene loader)
+// -----------------------------------------------------------------------------
+
+static void BM_AudioDecodeFull(benchmark::State& state)
+{
+	auto probe = OpenFixture(state);
+	if (!probe)
+		return;
+	const std::string path = FixturePath(state.range(0));
+
+	for (auto _ : state)
+	{
+		WavData data;
+		AudioDecoder::Decode(path, data);
+		benchmark::DoNotOptimize(data.Data.data());
+	}
+
+	SetDecodeCounters(state, *probe, probe->GetFrameCount());
+}
+BENCHMARK(BM_AudioDecodeFull)->Apply(ApplyCodecs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// -----------------------------------------------------------------------------
+// Streaming decode: 250 ms pulls through one open decoder, as OpenALStream does
+// -----------------------------------------------------------------------------
+
+static void BM_AudioDecodeStream(benchmark::State& state)
+{
+	auto decoder = OpenFixture(state);
+	if (!decoder)
+		return;
+
+	const uint64_t chunkFrames = static_cast<uint64_t>(decoder->GetSampleRate()) / 4;
+	std::vector<char> chunk(chunkFrames * decoder->GetFrameSize());
+
+	for (auto _ : state)
+	{
+		if (decoder->ReadFrames(chunk.data(), chunkFrames) < chunkFrames)
+			decoder->SeekFrame(0);
+		benchmark::DoNotOptimize(chunk.data());
+	}
+
+	SetDecodeCounters(state, *decoder, chunkFrames);
+}
+BENCHMARK(BM_AudioDecodeStream)->Apply(ApplyCodecs)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// -----------------------------------------------------------------------------
+// Software mixer: N looping voices rendered in 10 ms blocks. Half the voices are
+// mono (attenuated and panned, every other one pitch-shifted so it resamples),
+// half stereo. VoicesPerMs is voices mixed into a block per millisecond;
+// RealtimeVoices is how many voices one core could keep mixing in real time.
+// -----------------------------------------------------------------------------
+
+static void BM_SoftwareMix(benchmark::State& state)
+{
+	const auto voiceCount = static_cast<uint32_t>(state.range(0));
+	AudioEngine::Init(AudioBackend::Software);
+	SoftwareMixer& mixer = *AudioEngine::GetSoftwareMixer();
+
+	const auto stereo = MakeSignal();
+	WavData stereoData, monoData;
+	stereoData.SampleRate = monoData.SampleRate = kSampleRate;
+	stereoData.BitsPerSample = monoData.BitsPerSample = 16;
+	stereoData.Channels = 2;
+	monoData.Channels = 1;
+	stereoData.Data.assign(reinterpret_cast<const char*>(stereo.data()),
+		reinterpret_cast<const char*>(stereo.data() + stereo.size()));
+	std::vector<int16_t> mono(kFrames);
+	for (uint64_t i = 0; i < kFrames; ++i)
+		mono[i] = stereo[i * kChannels];
+	monoData.Data.assign(reinterpret_cast<const char*>(mono.data()),
+		reinterpret_cast<const char*>(mono.data() + mono.size()));
+
+	auto stereoBuffer = AudioBuffer::Create("bench_stereo", stereoData);
+	auto monoBuffer = AudioBuffer::Create("bench_mono", monoData);
+
+	std::vector<std::shared_ptr<AudioSource>> sources;
+	for (uint32_t i = 0; i < voiceCount; ++i)
+	{
+		auto source = AudioEngine::CreateSource();
+		const bool isMono = (i % 2) == 0;
+		source->SetBuffer(isMono ? monoBuffer : stereoBuffer);
+		source->SetLooping(true);
+		if (isMono)
+		{
+			const float angle = static_cast<float>(i) * 0.7f;
+			source->SetPosition({ std::cos(angle) * 8.0f, 0.0f, std::sin(angle) * 8.0f });
+			if ((i / 2) % 2 == 1)
+				source->SetPitch(0.9f);
+		}
+		source->Play();
+		sources.push_back(std::move(source));
+	}
+
+	const uint32_t blockFrames = mixer.GetSampleRate() / 100;
+	std::vector<float> out(static_cast<size_t>(blockFrames) * 2);
+
+	const auto start = std::chrono::steady_clock::now();
+	for (auto _ : state)
+	{
+		mixer.Render(out.data(), blockFrames);
+		benchmark::DoNotOptimize(out.data());
+	}
+	const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	// Plain counters rather than kIsRate, which would report per second
+	const double voicesPerMs = elapsedMs > 0.0 ? static_cast<double>(state.iterations()) * voiceCount / elapsedMs : 0.0;
+	PillarBench::SetThroughput(state, static_cast<int64_t>(voiceCount) * blockFrames);
+	state.counters["VoicesPerMs"] = voicesPerMs;
+	state.counters["RealtimeVoices"] = voicesPerMs * 10.0;	// Each voice covers 10 ms of audio
+
+	sources.clear();
+	AudioEngine::Shutdown();
+}
+BENCHMARK(BM_SoftwareMix)->Arg(1)->Arg(8)->Arg(32)->Arg(128)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,20 @@
+// BenchmarkMain: entry point for PillarBenchmarks. Initializes the engine
+// logger (quietly) before handing control to Google Benchmark.
+#include <benchmark/benchmark.h>
+#include "Pillar/Logger.h"
+
+int main(int argc, char** argv)
+{
+	// Systems log through the core logger; keep it quiet so logging does not skew timings
+	Pillar::Logger::Init();
+	Pillar::Logger::GetCoreLogger()->set_level(spdlog::level::warn);
+	Pillar::Logger::GetClientLogger()->set_level(spdlog::level::warn);
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
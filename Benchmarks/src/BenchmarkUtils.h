@@ -0,0 +1,57 @@
+#pragma once
+// BenchmarkUtils: shared scales, registration helpers and throughput counters
+// for the PillarBenchmarks suite.
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+namespace PillarBench {
+
+	// Fixed frame step used by every simulation benchmark
+	constexpr float kFrameDt = 1.0f / 60.0f;
+
+	// Entity counts used by the single-threaded scaling runs
+	constexpr int64_t kScales[] = { 10'000, 100'000, 1'000'000 };
+
+	// Entity count (per thread) used by the thread-scaling runs
+	constexpr int64_t kThreadScalingCount = 100'000;
+
+	inline int MaxThreads()
+	{
+		return static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+	}
+
+	inline void ApplyScales(benchmark::internal::Benchmark* bench)
+	{
+		for (int64_t count : kScales)
+			bench->Arg(count);
+	}
+
+	/**
+	 * @brief Report entities processed per iteration
+	 *
+	 * items_per_second is the total across all threads; ItemsPerThread is the
+	 * same rate averaged per thread, so per-core throughput and scaling can be
+	 * read directly from the JSON output.
+	 */
+	inline void SetThroughput(benchmark::State& state, int64_t itemsPerIteration)
+	{
+		const int64_t items = static_cast<int64_t>(state.iterations()) * itemsPerIteration;
+		state.SetItemsProcessed(items);
+		state.counters["ItemsPerThread"] = benchmark::Counter(
+			static_cast<double>(items),
+			benchmark::Counter::kIsRate | benchmark::Counter::kAvgThreads);
+	}
+
+} // namespace PillarBench
+
+// Register a benchmark at every scale (single thread) and as a thread-scaling sweep.
+// Each thread builds its own independent Scene, so the sweep measures how well
+// the systems scale when several worlds run side by side.
+#define PIL_BENCHMARK_SCALING(fn)                                                   \
+	BENCHMARK(fn)->Apply(::PillarBench::ApplyScales)                                \
+		->Unit(benchmark::kMillisecond)->UseRealTime();                             \
+	BENCHMARK(fn)->Arg(::PillarBench::kThreadScalingCount)                          \
+		->ThreadRange(1, ::PillarBench::MaxThreads())                               \
+		->Unit(benchmark::kMillisecond)->UseRealTime()
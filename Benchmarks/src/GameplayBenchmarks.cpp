@@ -0,0 +1,194 @@
+// GameplayBenchmarks: throughput of the light-entity gameplay systems
+// (velocity integration, bullet raycasts, XP gem collection, sprite animation).
+#include "BenchmarkUtils.h"
+#include "Pillar/ECS/Scene.h"
+#include "Pillar/ECS/Entity.h"
+#include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Physics/VelocityComponent.h"
+#include "Pillar/ECS/Components/Physics/RigidbodyComponent.h"
+#include "Pillar/ECS/Components/Physics/ColliderComponent.h"
+#include "Pillar/ECS/Components/Gameplay/BulletComponent.h"
+#include "Pillar/ECS/Components/Gameplay/XPGemComponent.h"
+#include "Pillar/ECS/Components/Rendering/AnimationComponent.h"
+#include "Pillar/ECS/Components/Rendering/SpriteComponent.h"
+#include "Pillar/ECS/Systems/VelocityIntegrationSystem.h"
+#include "Pillar/ECS/Systems/BulletCollisionSystem.h"
+#include "Pillar/ECS/Systems/PhysicsSystem.h"
+#include "Pillar/ECS/Systems/XPCollectionSystem.h"
+#include "Pillar/ECS/Systems/AnimationSystem.h"
+#include "Pillar/Utils/RandomStream.h"
+#include <glm/glm.hpp>
+#include <limits>
+#include <string>
+
+using namespace Pillar;
+
+// -----------------------------------------------------------------------------
+// Velocity integration over N moving entities
+// -----------------------------------------------------------------------------
+
+static void BM_VelocityIntegration(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	Scene scene("VelocityBenchmark");
+	auto& registry = scene.GetRegistry();
+
+	RandomStream random(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		entt::entity entity = registry.create();
+		registry.emplace<TransformComponent>(entity, glm::vec2(random.Float(-100.0f, 100.0f), random.Float(-100.0f, 100.0f)));
+		auto& velocity = registry.emplace<VelocityComponent>(entity, random.Direction2D() * 5.0f);
+		velocity.Drag = 0.1f;
+	}
+
+	VelocityIntegrationSystem system;
+	system.OnAttach(&scene);
+
+	for (auto _ : state)
+	{
+		system.OnUpdate(PillarBench::kFrameDt);
+		benchmark::ClobberMemory();
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+PIL_BENCHMARK_SCALING(BM_VelocityIntegration);
+
+// -----------------------------------------------------------------------------
+// Bullets: lifetime + one raycast per bullet against a field of static boxes
+// -----------------------------------------------------------------------------
+
+static void BM_BulletCollision(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	Scene scene("BulletBenchmark");
+
+	PhysicsSystem physics;
+	physics.OnAttach(&scene);
+
+	// Static obstacles on a grid (so raycasts actually traverse the broadphase)
+	for (int x = -10; x <= 10; ++x)
+	{
+		for (int y = -10; y <= 10; ++y)
+		{
+			Entity obstacle = scene.CreateEntity("Obstacle");
+			obstacle.GetComponent<TransformComponent>().Position = glm::vec2(x * 10.0f, y * 10.0f);
+			obstacle.AddComponent<RigidbodyComponent>(b2_staticBody);
+			obstacle.AddComponent<ColliderComponent>(ColliderComponent::Box(glm::vec2(1.0f)));
+		}
+	}
+	physics.OnUpdate(PillarBench::kFrameDt); // Create Box2D bodies
+
+	// Bullets never expire and never run out of hits, so the count stays constant
+	auto& registry = scene.GetRegistry();
+	RandomStream random(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		entt::entity entity = registry.create();
+		registry.emplace<TransformComponent>(entity, glm::vec2(random.Float(-100.0f, 100.0f), random.Float(-100.0f, 100.0f)));
+		registry.emplace<VelocityComponent>(entity, random.Direction2D() * 30.0f);
+		auto& bullet = registry.emplace<BulletComponent>(entity);
+		bullet.Lifetime = std::numeric_limits<float>::max();
+		bullet.MaxHits = std::numeric_limits<uint32_t>::max();
+		bullet.HitsRemaining = bullet.MaxHits;
+	}
+
+	BulletCollisionSystem bullets(&physics);
+	bullets.OnAttach(&scene);
+
+	for (auto _ : state)
+	{
+		bullets.OnUpdate(PillarBench::kFrameDt);
+		benchmark::ClobberMemory();
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+PIL_BENCHMARK_SCALING(BM_BulletCollision);
+
+// -----------------------------------------------------------------------------
+// XP gems: spatial grid rebuild + attraction query around the player
+// -----------------------------------------------------------------------------
+
+static void BM_XPGemCollection(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	Scene scene("XPGemBenchmark");
+
+	Entity player = scene.CreateEntity("Player");
+	player.GetComponent<TransformComponent>().Position = glm::vec2(0.0f);
+
+	auto& registry = scene.GetRegistry();
+	RandomStream random(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		entt::entity entity = registry.create();
+		registry.emplace<TransformComponent>(entity, glm::vec2(random.Float(-200.0f, 200.0f), random.Float(-200.0f, 200.0f)));
+		registry.emplace<VelocityComponent>(entity);
+		registry.emplace<XPGemComponent>(entity);
+	}
+
+	XPCollectionSystem system;
+	system.OnAttach(&scene);
+
+	for (auto _ : state)
+	{
+		system.OnUpdate(PillarBench::kFrameDt);
+		benchmark::DoNotOptimize(system.GetEntityCount());
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+PIL_BENCHMARK_SCALING(BM_XPGemCollection);
+
+// -----------------------------------------------------------------------------
+// Sprite animation: N entities cycling through 8 clips of 4-12 frames at
+// staggered offsets, so a frame step lands on some sprites every update
+// -----------------------------------------------------------------------------
+
+static void BM_AnimationUpdate(benchmark::State& state)
+{
+	constexpr int kClipCount = 8;
+	const auto count = static_cast<uint32_t>(state.range(0));
+	Scene scene("AnimationBenchmark");
+
+	AnimationSystem system;
+	system.OnAttach(&scene);
+	for (int c = 0; c < kClipCount; ++c)
+	{
+		AnimationClip clip;
+		clip.Name = "Clip" + std::to_string(c);
+		clip.Loop = true;
+		const int frameCount = 4 + c;
+		for (int f = 0; f < frameCount; ++f)
+		{
+			AnimationFrame frame;
+			frame.Duration = 0.05f + 0.01f * static_cast<float>(c);
+			frame.UVMin = glm::vec2(static_cast<float>(f) / frameCount, 0.0f);
+			frame.UVMax = glm::vec2(static_cast<float>(f + 1) / frameCount, 1.0f);
+			clip.Frames.push_back(frame);
+		}
+		system.RegisterClip(clip);
+	}
+
+	auto& registry = scene.GetRegistry();
+	RandomStream random(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		entt::entity entity = registry.create();
+		registry.emplace<SpriteComponent>(entity);
+		auto& anim = registry.emplace<AnimationComponent>(entity);
+		anim.Play("Clip" + std::to_string(i % kClipCount));
+		anim.PlaybackTime = random.Float(0.0f, 0.05f);
+	}
+
+	for (auto _ : state)
+	{
+		system.OnUpdate(PillarBench::kFrameDt);
+		benchmark::ClobberMemory();
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+PIL_BENCHMARK_SCALING(BM_AnimationUpdate);
@@ -0,0 +1,154 @@
+// ParticleBenchmarks: spawn, simulation update and CPU render-packing
+// throughput for the particle pipeline at 10k / 100k / 1M particles.
+#include "BenchmarkUtils.h"
+#include "Pillar/ECS/Scene.h"
+#include "Pillar/ECS/SpecializedPools.h"
+#include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Gameplay/ParticleComponent.h"
+#include "Pillar/ECS/Components/Gameplay/ParticleEmitterComponent.h"
+#include "Pillar/ECS/Components/Gameplay/ParticleAnimationCurves.h"
+#include "Pillar/ECS/Components/Rendering/SpriteComponent.h"
+#include "Pillar/ECS/Systems/ParticleSystem.h"
+#include "Pillar/ECS/Systems/ParticleEmitterSystem.h"
+#include "Pillar/ECS/Systems/SpriteRenderSystem.h"
+#include "Pillar/ECS/Systems/VelocityIntegrationSystem.h"
+#include "Pillar/Utils/RandomStream.h"
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+using namespace Pillar;
+
+namespace {
+
+	/**
+	 * @brief A scene pre-populated with live particles
+	 *
+	 * Particles get a very long lifetime so none expire mid-benchmark and the
+	 * live count stays constant across iterations.
+	 */
+	struct ParticleWorld
+	{
+		std::unique_ptr<Scene> World = std::make_unique<Scene>("ParticleBenchmark");
+		ParticlePool Pool;
+		ColorGradient Gradient{ glm::vec4(1.0f, 1.0f, 0.3f, 1.0f), glm::vec4(1.0f, 0.5f, 0.0f, 0.8f), glm::vec4(0.2f, 0.0f, 0.0f, 0.0f) };
+		AnimationCurve SizeCurve{ CurveType::EaseOut };
+
+		explicit ParticleWorld(uint32_t count)
+		{
+			Pool.Init(World.get(), count);
+
+			RandomStream random(count);
+			ParticleSpawnBatch batch;
+			batch.Resize(count);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				batch.Positions[i] = glm::vec2(random.Float(-100.0f, 100.0f), random.Float(-100.0f, 100.0f));
+				batch.Velocities[i] = random.Direction2D() * random.Float(1.0f, 5.0f);
+				batch.Colors[i] = glm::vec4(1.0f);
+				batch.Sizes[i] = random.Float(0.05f, 0.2f);
+				batch.Lifetimes[i] = 1.0e6f;
+			}
+			batch.ScaleOverTime = true;
+			batch.RotateOverTime = true;
+			batch.RotationSpeed = 90.0f;
+			batch.UseColorGradient = true;
+			batch.ColorGradientPtr = &Gradient;
+			batch.SizeCurve = &SizeCurve;
+
+			Pool.SpawnBatch(batch);
+		}
+	};
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Spawn: one burst of N particles through ParticleEmitterSystem
+// -----------------------------------------------------------------------------
+
+static void BM_ParticleSpawnBurst(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		auto scene = std::make_unique<Scene>("ParticleSpawnBenchmark");
+		auto pool = std::make_unique<ParticlePool>();
+		pool->Init(scene.get(), count);
+
+		ParticleEmitterSystem emitters;
+		emitters.OnAttach(scene.get());
+		emitters.SetParticlePool(pool.get());
+
+		auto& emitter = scene->CreateEntity("Emitter").AddComponent<ParticleEmitterComponent>();
+		emitter.BurstMode = true;
+		emitter.BurstCount = static_cast<int>(count);
+		emitter.Shape = EmissionShape::Circle;
+		emitter.DirectionSpread = 180.0f;
+		state.ResumeTiming();
+
+		emitters.OnUpdate(PillarBench::kFrameDt);
+
+		state.PauseTiming();
+		benchmark::DoNotOptimize(emitters.GetParticlesSpawnedThisFrame());
+		pool.reset();
+		scene.reset();
+		state.ResumeTiming();
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+PIL_BENCHMARK_SCALING(BM_ParticleSpawnBurst);
+
+// -----------------------------------------------------------------------------
+// Update: ParticleSystem (aging, gradient, curves) + velocity integration
+// -----------------------------------------------------------------------------
+
+static void BM_ParticleUpdate(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	ParticleWorld world(count);
+
+	ParticleSystem particles;
+	particles.OnAttach(world.World.get());
+	particles.SetParticlePool(&world.Pool);
+
+	VelocityIntegrationSystem velocity;
+	velocity.OnAttach(world.World.get());
+
+	for (auto _ : state)
+	{
+		particles.OnUpdate(PillarBench::kFrameDt);
+		velocity.OnUpdate(PillarBench::kFrameDt);
+		benchmark::DoNotOptimize(particles.GetActiveParticleCount());
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+PIL_BENCHMARK_SCALING(BM_ParticleUpdate);
+
+// -----------------------------------------------------------------------------
+// Render packing: SpriteRenderSystem's sort + batch vertex expansion (GPU-free)
+// -----------------------------------------------------------------------------
+
+static void BM_ParticleRenderPack(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	ParticleWorld world(count);
+
+	std::vector<entt::entity> order;
+	std::vector<QuadGeometry::QuadVertex> vertices;
+	order.reserve(count);
+	vertices.reserve(static_cast<size_t>(count) * 4);
+
+	for (auto _ : state)
+	{
+		SpriteRenderSystem::PackQuads(*world.World, order, vertices);
+		benchmark::DoNotOptimize(vertices.data());
+		benchmark::ClobberMemory();
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+PIL_BENCHMARK_SCALING(BM_ParticleRenderPack);
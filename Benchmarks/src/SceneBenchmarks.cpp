@@ -0,0 +1,156 @@
+// SceneBenchmarks: scene load time for the JSON authoring format (DOM and
+// streaming) versus the chunked binary format, all from memory so disk speed
+// is left out, plus the play-mode Scene::Copy.
+#include "BenchmarkUtils.h"
+#include "Pillar/ECS/Scene.h"
+#include "Pillar/ECS/Entity.h"
+#include "Pillar/ECS/SceneSerializer.h"
+#include "Pillar/ECS/SceneStreamLoader.h"
+#include "Pillar/ECS/SceneSnapshot.h"
+#include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Core/HierarchyComponent.h"
+#include "Pillar/ECS/Components/Physics/VelocityComponent.h"
+#include "Pillar/ECS/Components/Gameplay/XPGemComponent.h"
+#include "Pillar/Utils/RandomStream.h"
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Pillar;
+
+namespace {
+
+	// A level-like mix: every entity has a transform, a quarter are parented,
+	// half move and one in eight carries a registry-only component
+	void BuildLevel(Scene& scene, uint32_t count)
+	{
+		RandomStream random(count);
+		uint64_t lastRoot = 0;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			Entity entity = scene.CreateEntity("Entity" + std::to_string(i));
+			entity.GetComponent<TransformComponent>().Position =
+				glm::vec2(random.Float(-500.0f, 500.0f), random.Float(-500.0f, 500.0f));
+
+			if (i % 4 == 0)
+				lastRoot = entity.GetUUID();
+			else if (i % 4 == 1)
+				entity.AddComponent<HierarchyComponent>(lastRoot);
+
+			if (i % 2 == 0)
+				entity.AddComponent<VelocityComponent>(random.Direction2D() * 3.0f);
+			if (i % 8 == 0)
+				entity.AddComponent<XPGemComponent>(5);
+		}
+	}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Load from JSON text (DOM parse + ComponentRegistry lambdas per entity)
+// -----------------------------------------------------------------------------
+
+static void BM_SceneLoadJson(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	Scene source("JsonSource");
+	BuildLevel(source, count);
+	const std::string text = SceneSerializer(&source).SerializeToString();
+
+	for (auto _ : state)
+	{
+		Scene scene;
+		SceneSerializer(&scene).DeserializeFromString(text);
+		benchmark::DoNotOptimize(scene.GetEntityCount());
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+BENCHMARK(BM_SceneLoadJson)->Arg(10'000)->Arg(200'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// -----------------------------------------------------------------------------
+// Load from JSON text through the SAX loader (no DOM of the whole file)
+// -----------------------------------------------------------------------------
+
+static void BM_SceneLoadJsonStreaming(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	Scene source("StreamSource");
+	BuildLevel(source, count);
+	const std::string text = SceneSerializer(&source).SerializeToString();
+
+	for (auto _ : state)
+	{
+		Scene scene;
+		std::istringstream stream(text);
+		SceneStreamLoader(&scene).Load(stream, text.size());
+		benchmark::DoNotOptimize(scene.GetEntityCount());
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+BENCHMARK(BM_SceneLoadJsonStreaming)->Arg(10'000)->Arg(200'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// -----------------------------------------------------------------------------
+// Load from the chunked binary format (bulk inserts per component type)
+// -----------------------------------------------------------------------------
+
+static void BM_SceneLoadChunked(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	Scene source("ChunkedSource");
+	BuildLevel(source, count);
+	const std::vector<uint8_t> data = SceneSerializer(&source).SerializeChunkedToBuffer();
+
+	for (auto _ : state)
+	{
+		Scene scene;
+		SceneSerializer(&scene).DeserializeChunkedFromMemory(data.data(), data.size());
+		benchmark::DoNotOptimize(scene.GetEntityCount());
+	}
+
+	PillarBench::SetThroughput(state, count);
+	state.counters["FileBytes"] = static_cast<double>(data.size());
+}
+BENCHMARK(BM_SceneLoadChunked)->Arg(10'000)->Arg(200'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// -----------------------------------------------------------------------------
+// Play-mode copy (storage-level: Scene::Copy and SceneSnapshot share one path)
+// -----------------------------------------------------------------------------
+
+static void BM_SceneCopy(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	auto source = std::make_shared<Scene>("CopySource");
+	BuildLevel(*source, count);
+
+	for (auto _ : state)
+	{
+		auto copy = Scene::Copy(source);
+		benchmark::DoNotOptimize(copy->GetEntityCount());
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+BENCHMARK(BM_SceneCopy)->Arg(10'000)->Arg(200'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Stop button: restore the captured edit-mode state into the live scene
+static void BM_SceneSnapshotRestore(benchmark::State& state)
+{
+	const auto count = static_cast<uint32_t>(state.range(0));
+	Scene scene("SnapshotSource");
+	BuildLevel(scene, count);
+
+	SceneSnapshot snapshot;
+	snapshot.Capture(scene);
+
+	for (auto _ : state)
+	{
+		snapshot.Restore(scene);
+		benchmark::DoNotOptimize(scene.GetEntityCount());
+	}
+
+	PillarBench::SetThroughput(state, count);
+}
+BENCHMARK(BM_SceneSnapshotRestore)->Arg(10'000)->Arg(200'000)->Unit(benchmark::kMillisecond)->UseRealTime();
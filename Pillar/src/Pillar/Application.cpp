@@ -5,6 +5,8 @@
 #include "Pillar/Audio/AudioEngine.h"
 #include "Pillar/Renderer/Renderer2DBackend.h"
 #include "Pillar/Renderer/Lighting2D.h"
+#include "Pillar/Utils/AssetManager.h"
+#include "Pillar/Utils/Profiler.h"
 #include <chrono>
 #include "Pillar/Input.h"
 #include "Pillar/Time.h"
@@ -99,9 +101,13 @@ namespace Pillar
 		PIL_CORE_ERROR("This is an error message for demonstration purposes.");
 		PIL_CORE_WARN("This is a warning message for demonstration purposes.");
 
+		PIL_PROFILE_THREAD("Main");
+
 		auto lastTime = std::chrono::steady_clock::now();
 		while (m_Running)
 		{// Simulate application running
+			PIL_PROFILE_SCOPE("Application::Frame");
+
 			// Delta time
 			auto now = std::chrono::steady_clock::now();
 			std::chrono::duration<float> dt = now - lastTime;
@@ -110,8 +116,17 @@ namespace Pillar
 			Time::Tick(unscaledDeltaTime);
 			float deltaTime = Time::GetDeltaTime();
 
-			m_Window->PollEvents();
-			Input::OnUpdate();
+			{
+				PIL_PROFILE_SCOPE("Application::PollEvents");
+				m_Window->PollEvents();
+				Input::OnUpdate();
+			}
+
+			// Textures decoded in the background go to the GPU a few per frame
+			{
+				PIL_PROFILE_SCOPE("AssetManager::ProcessTextureUploads");
+				AssetManager::ProcessTextureUploads();
+			}
 
 			// Clear screen
 			Renderer::SetClearColor({ 0.1f, 0.1f, 0.1f, 1.0f });
@@ -119,22 +134,37 @@ namespace Pillar
 
 			// Begin scene
 
-			for (Layer* layer : m_LayerStack)
 			{
-				layer->OnUpdate(deltaTime);
+				PIL_PROFILE_SCOPE("Application::LayerUpdate");
+				for (Layer* layer : m_LayerStack)
+				{
+					layer->OnUpdate(deltaTime);
+				}
+			}
+
+			// Bus fades and pooled voices run on real time
+			{
+				PIL_PROFILE_SCOPE("AudioEngine::Update");
+				AudioEngine::Update(unscaledDeltaTime);
 			}
 
 			// End scene
 
 			// Render ImGui
-			m_ImGuiLayer->Begin();
-			for (Layer* layer : m_LayerStack)
 			{
-				layer->OnImGuiRender();
+				PIL_PROFILE_SCOPE("Application::ImGui");
+				m_ImGuiLayer->Begin();
+				for (Layer* layer : m_LayerStack)
+				{
+					layer->OnImGuiRender();
+				}
+				m_ImGuiLayer->End();
 			}
-			m_ImGuiLayer->End();
 
-			m_Window->OnUpdate();
+			{
+				PIL_PROFILE_SCOPE("Application::SwapBuffers");
+				m_Window->OnUpdate();
+			}
 		}
 	}
 }
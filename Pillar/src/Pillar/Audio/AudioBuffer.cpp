@@ -1,19 +1,25 @@
 #include "Pillar/Audio/AudioBuffer.h"
+#include "Pillar/Audio/AudioEngine.h"
 #include "Platform/OpenAL/OpenALBuffer.h"
-#include "Platform/OpenAL/OpenALContext.h"
+#include "Platform/Software/SoftwareBuffer.h"
+#include "Pillar/Audio/WavLoader.h"
 #include "Pillar/Logger.h"
 
 namespace Pillar {
 
     std::shared_ptr<AudioBuffer> AudioBuffer::Create(const std::string& filepath)
     {
-        if (!OpenALContext::IsInitialized())
+        if (!AudioEngine::IsInitialized())
         {
             PIL_CORE_ERROR("AudioBuffer::Create: Audio engine not initialized");
             return nullptr;
         }
 
-        auto buffer = std::make_shared<OpenALBuffer>(filepath);
+        std::shared_ptr<AudioBuffer> buffer;
+        if (AudioEngine::GetBackend() == AudioBackend::Software)
+            buffer = std::make_shared<SoftwareBuffer>(filepath);
+        else
+            buffer = std::make_shared<OpenALBuffer>(filepath);
         
         if (!buffer->IsLoaded())
         {
@@ -24,4 +30,27 @@ namespace Pillar {
         return buffer;
     }
 
+    std::shared_ptr<AudioBuffer> AudioBuffer::Create(const std::string& filepath, const WavData& wavData)
+    {
+        if (!AudioEngine::IsInitialized())
+        {
+            PIL_CORE_ERROR("AudioBuffer::Create: Audio engine not initialized");
+            return nullptr;
+        }
+
+        std::shared_ptr<AudioBuffer> buffer;
+        if (AudioEngine::GetBackend() == AudioBackend::Software)
+            buffer = std::make_shared<SoftwareBuffer>(filepath, wavData);
+        else
+            buffer = std::make_shared<OpenALBuffer>(filepath, wavData);
+
+        if (!buffer->IsLoaded())
+        {
+            PIL_CORE_ERROR("AudioBuffer::Create: Failed to upload audio data: {0}", filepath);
+            return nullptr;
+        }
+
+        return buffer;
+    }
+
 }
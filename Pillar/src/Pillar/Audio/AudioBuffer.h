@@ -3,10 +3,13 @@
 #include "Pillar/Core.h"
 #include <memory>
 #include <string>
+#include <cstddef>
 #include <cstdint>
 
 namespace Pillar {
 
+    struct WavData;
+
     /**
      * @brief Abstract audio buffer class for storing audio data.
      * 
@@ -48,6 +51,12 @@ namespace Pillar {
          */
         virtual int GetBitsPerSample() const = 0;
 
+        /**
+         * @brief Get the size of the uploaded sample data.
+         * @return Size in bytes (used for AudioEngine's buffer cache budget).
+         */
+        virtual size_t GetSizeInBytes() const = 0;
+
         /**
          * @brief Check if the buffer is loaded and valid.
          * @return true if loaded, false otherwise.
@@ -61,11 +70,19 @@ namespace Pillar {
         virtual const std::string& GetFilePath() const = 0;
 
         /**
-         * @brief Create an audio buffer from a WAV file.
-         * @param filepath Path to the WAV file.
+         * @brief Create an audio buffer from a .wav (PCM or IMA-ADPCM) or .ogg file.
+         * @param filepath Path to the audio file.
          * @return Shared pointer to the created buffer, or nullptr on failure.
          */
         static std::shared_ptr<AudioBuffer> Create(const std::string& filepath);
+
+        /**
+         * @brief Create an audio buffer from WAV data decoded elsewhere (e.g. on a loader thread).
+         * @param filepath Path the data was decoded from.
+         * @param wavData Decoded samples and format.
+         * @return Shared pointer to the created buffer, or nullptr on failure.
+         */
+        static std::shared_ptr<AudioBuffer> Create(const std::string& filepath, const WavData& wavData);
     };
 
 }
@@ -0,0 +1,99 @@
+#include "Pillar/Audio/AudioDecoder.h"
+#include "Pillar/Audio/WavDecoder.h"
+#include "Pillar/Audio/VorbisDecoder.h"
+#include "Pillar/Audio/WavLoader.h"
+#include "Pillar/Logger.h"
+#include <cstring>
+#include <fstream>
+
+namespace Pillar {
+
+    float AudioDecoder::GetDuration() const
+    {
+        const int sampleRate = GetSampleRate();
+        return sampleRate > 0 ? static_cast<float>(GetFrameCount()) / static_cast<float>(sampleRate) : 0.0f;
+    }
+
+    bool AudioDecoder::DecodeAll(WavData& outData)
+    {
+        if (!SeekFrame(0))
+            return false;
+
+        const uint64_t frameCount = GetFrameCount();
+        outData.SampleRate = GetSampleRate();
+        outData.Channels = GetChannels();
+        outData.BitsPerSample = GetBitsPerSample();
+        outData.Data.resize(static_cast<size_t>(frameCount) * GetFrameSize());
+
+        const uint64_t decoded = ReadFrames(outData.Data.data(), frameCount);
+        if (decoded < frameCount)
+        {
+            PIL_CORE_WARN("AudioDecoder: Decoded {0} of {1} frames, truncating", decoded, frameCount);
+            outData.Data.resize(static_cast<size_t>(decoded) * GetFrameSize());
+        }
+
+        outData.Duration = outData.SampleRate > 0 ? static_cast<float>(decoded) / static_cast<float>(outData.SampleRate) : 0.0f;
+        return decoded > 0;
+    }
+
+    std::unique_ptr<AudioDecoder> AudioDecoder::Open(const std::string& filepath)
+    {
+        char magic[4] = {};
+        {
+            std::ifstream file(filepath, std::ios::binary);
+            if (!file.is_open() || !file.read(magic, sizeof(magic)))
+            {
+                PIL_CORE_ERROR("AudioDecoder: Failed to open file: {0}", filepath);
+                return nullptr;
+            }
+        }
+
+        if (std::strncmp(magic, "OggS", 4) == 0)
+        {
+            auto decoder = std::make_unique<VorbisDecoder>();
+            if (!decoder->Open(filepath))
+                return nullptr;
+            return decoder;
+        }
+
+        if (std::strncmp(magic, "RIFF", 4) == 0)
+        {
+            WavLayout layout;
+            if (!WavLoader::ReadLayout(filepath, layout))
+                return nullptr;
+
+            if (layout.AudioFormat == PcmWavDecoder::FormatTag)
+            {
+                auto decoder = std::make_unique<PcmWavDecoder>();
+                if (!decoder->Open(filepath, layout))
+                    return nullptr;
+                return decoder;
+            }
+            if (layout.AudioFormat == ImaAdpcmDecoder::FormatTag)
+            {
+                auto decoder = std::make_unique<ImaAdpcmDecoder>();
+                if (!decoder->Open(filepath, layout))
+                    return nullptr;
+                return decoder;
+            }
+
+            PIL_CORE_ERROR("AudioDecoder: Unsupported WAV format {0} in {1}", layout.AudioFormat, filepath);
+            return nullptr;
+        }
+
+        PIL_CORE_ERROR("AudioDecoder: Unrecognized audio file: {0}", filepath);
+        return nullptr;
+    }
+
+    bool AudioDecoder::Decode(const std::string& filepath, WavData& outData)
+    {
+        auto decoder = Open(filepath);
+        if (!decoder || !decoder->DecodeAll(outData))
+            return false;
+
+        PIL_CORE_TRACE("AudioDecoder: Decoded {0} - {1}Hz, {2} channels, {3}-bit, {4:.2f}s",
+            filepath, outData.SampleRate, outData.Channels, outData.BitsPerSample, outData.Duration);
+        return true;
+    }
+
+}
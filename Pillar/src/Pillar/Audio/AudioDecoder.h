@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Pillar {
+
+    struct WavData;
+
+    /**
+     * @brief Pull-style decoder that turns an audio file into interleaved PCM.
+     *
+     * Every codec sits behind this interface: PCM and IMA-ADPCM WAV files,
+     * and Ogg Vorbis. Streams pull a chunk at a time with ReadFrames();
+     * buffers decode the whole file in one go with Decode(). The codec is
+     * chosen from the file's magic bytes, not its extension.
+     *
+     * Output is 8-bit (PCM WAV only) or 16-bit signed samples, mono or stereo.
+     * A decoder is not thread-safe; give each thread its own.
+     */
+    class PIL_API AudioDecoder
+    {
+    public:
+        virtual ~AudioDecoder() = default;
+
+        virtual int GetSampleRate() const = 0;
+        virtual int GetChannels() const = 0;
+
+        /**
+         * @brief Bits per decoded output sample (8 or 16), whatever the file stores.
+         */
+        virtual int GetBitsPerSample() const = 0;
+
+        /**
+         * @brief Total number of frames (one sample per channel) in the file.
+         */
+        virtual uint64_t GetFrameCount() const = 0;
+
+        /**
+         * @brief Decode frames from the current position.
+         * @param out Destination of at least frameCount * GetFrameSize() bytes.
+         * @param frameCount Frames to decode.
+         * @return Frames actually decoded; fewer only at the end of the file or on a read error.
+         */
+        virtual uint64_t ReadFrames(char* out, uint64_t frameCount) = 0;
+
+        /**
+         * @brief Move the read position.
+         * @param frame Frame to continue from (clamped to GetFrameCount()).
+         * @return true if the decoder can continue from there.
+         */
+        virtual bool SeekFrame(uint64_t frame) = 0;
+
+        uint32_t GetFrameSize() const { return static_cast<uint32_t>(GetChannels() * (GetBitsPerSample() / 8)); }
+        float GetDuration() const;
+
+        /**
+         * @brief Decode everything from the start of the file.
+         * @param outData Output samples and format.
+         * @return true if every frame was decoded.
+         */
+        bool DecodeAll(WavData& outData);
+
+        // ==================== Factory ====================
+
+        /**
+         * @brief Open a file for decoding with the codec that matches its contents.
+         * @param filepath Resolved path to a .wav or .ogg file.
+         * @return The decoder, or nullptr if the file can't be opened or its codec is unsupported.
+         */
+        static std::unique_ptr<AudioDecoder> Open(const std::string& filepath);
+
+        /**
+         * @brief Decode a whole file (Open + DecodeAll).
+         * @param filepath Resolved path to a .wav or .ogg file.
+         * @param outData Output samples and format.
+         * @return true if loading succeeded, false otherwise.
+         */
+        static bool Decode(const std::string& filepath, WavData& outData);
+    };
+
+}
@@ -1,12 +1,17 @@
 #include "Pillar/Audio/AudioEngine.h"
 #include "Pillar/Audio/AudioBuffer.h"
 #include "Pillar/Audio/AudioSource.h"
+#include "Pillar/Audio/AudioStream.h"
+#include "Pillar/Audio/VoicePool.h"
 #include "Platform/OpenAL/OpenALContext.h"
+#include "Platform/Software/SoftwareMixer.h"
 #include "Pillar/Logger.h"
 #include <AL/al.h>
 #include <algorithm>
 #include <array>
+#include <list>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
 namespace Pillar {
@@ -17,6 +22,7 @@ namespace Pillar {
     static glm::vec3 s_ListenerVelocity = { 0.0f, 0.0f, 0.0f };
     static glm::vec3 s_ListenerForward = { 0.0f, 0.0f, -1.0f };
     static glm::vec3 s_ListenerUp = { 0.0f, 1.0f, 0.0f };
+    static AudioBackend s_Backend = AudioBackend::OpenAL;
 
     std::vector<AudioEngine::TrackedSource> AudioEngine::s_TrackedSources;
     std::vector<AudioEngine::BusState> AudioEngine::s_BusStates(static_cast<size_t>(AudioEngine::AudioBus::Count));
@@ -31,16 +37,113 @@ namespace Pillar {
         {
             return a + (b - a) * t;
         }
+
+        // ==================== Buffer Cache ====================
+
+        struct CachedBuffer
+        {
+            std::string Path;
+            std::shared_ptr<AudioBuffer> Buffer;
+            size_t Bytes = 0;
+            bool Pinned = false;
+        };
+
+        constexpr size_t DefaultBufferCacheBudget = 64ull * 1024 * 1024;
+
+        // Most recently used at the front; the map points into the list
+        std::list<CachedBuffer> s_BufferLRU;
+        std::unordered_map<std::string, std::list<CachedBuffer>::iterator> s_BufferLookup;
+        size_t s_BufferCacheBytes = 0;
+        size_t s_BufferCacheBudget = DefaultBufferCacheBudget;
+
+        // Anything holding the buffer besides the cache entry itself
+        inline bool IsInUse(const CachedBuffer& entry)
+        {
+            return entry.Buffer.use_count() > 1;
+        }
+
+        std::list<CachedBuffer>::iterator EraseCachedBuffer(std::list<CachedBuffer>::iterator it)
+        {
+            s_BufferCacheBytes -= it->Bytes;
+            s_BufferLookup.erase(it->Path);
+            return s_BufferLRU.erase(it);
+        }
+
+        void EvictBuffers()
+        {
+            // Walk from the least recently used end; skip entries that can't go
+            auto it = s_BufferLRU.end();
+            while (s_BufferCacheBytes > s_BufferCacheBudget && it != s_BufferLRU.begin())
+            {
+                --it;
+                if (!it->Pinned && !IsInUse(*it))
+                    it = EraseCachedBuffer(it);
+            }
+        }
+
+        // wavData: already-decoded samples to build the buffer from on a miss (nullptr = load the file)
+        std::shared_ptr<AudioBuffer> AcquireBuffer(const std::string& filepath, bool pin, const WavData* wavData = nullptr)
+        {
+            if (auto found = s_BufferLookup.find(filepath); found != s_BufferLookup.end())
+            {
+                auto it = found->second;
+                s_BufferLRU.splice(s_BufferLRU.begin(), s_BufferLRU, it);
+                it->Pinned = it->Pinned || pin;
+                return it->Buffer;
+            }
+
+            auto buffer = wavData ? AudioBuffer::Create(filepath, *wavData) : AudioBuffer::Create(filepath);
+            if (!buffer)
+                return nullptr;
+
+            CachedBuffer entry;
+            entry.Path = filepath;
+            entry.Buffer = buffer;
+            entry.Bytes = buffer->GetSizeInBytes();
+            entry.Pinned = pin;
+            s_BufferLRU.push_front(std::move(entry));
+            s_BufferLookup.emplace(filepath, s_BufferLRU.begin());
+            s_BufferCacheBytes += s_BufferLRU.front().Bytes;
+
+            EvictBuffers();
+            return buffer;
+        }
+
+        void ClearBufferCache()
+        {
+            s_BufferLookup.clear();
+            s_BufferLRU.clear();
+            s_BufferCacheBytes = 0;
+        }
+
+        // Pre-generated sources shared by one-shot voices
+        std::unique_ptr<VoicePool> s_VoicePool;
+
+        // Streams created through CreateStream, fed every Update
+        std::vector<std::weak_ptr<AudioStream>> s_Streams;
+
+        // Output of AudioBackend::Software
+        std::unique_ptr<SoftwareMixer> s_SoftwareMixer;
     }
 
-    void AudioEngine::Init()
+    void AudioEngine::Init(AudioBackend backend)
     {
         PIL_CORE_INFO("AudioEngine: Initializing...");
 
-        if (!OpenALContext::Init())
+        s_Backend = backend;
+        switch (backend)
         {
-            PIL_CORE_ERROR("AudioEngine: Failed to initialize OpenAL context");
-            return;
+            case AudioBackend::OpenAL:
+                if (!OpenALContext::Init())
+                {
+                    PIL_CORE_ERROR("AudioEngine: Failed to initialize OpenAL context");
+                    return;
+                }
+                break;
+            case AudioBackend::Software:
+                s_SoftwareMixer = std::make_unique<SoftwareMixer>();
+                PIL_CORE_INFO("AudioEngine: Using the software mixer ({0} Hz)", s_SoftwareMixer->GetSampleRate());
+                break;
         }
 
         // Reset static state to defaults
@@ -61,15 +164,20 @@ namespace Pillar {
             bus.FadeElapsed = 0.0f;
         }
 
-        // Set initial listener properties
-        alListenerf(AL_GAIN, s_MasterVolume);
-        alListener3f(AL_POSITION, s_ListenerPosition.x, s_ListenerPosition.y, s_ListenerPosition.z);
-        alListener3f(AL_VELOCITY, s_ListenerVelocity.x, s_ListenerVelocity.y, s_ListenerVelocity.z);
-        ALfloat orientation[] = {
-            s_ListenerForward.x, s_ListenerForward.y, s_ListenerForward.z,
-            s_ListenerUp.x, s_ListenerUp.y, s_ListenerUp.z
-        };
-        alListenerfv(AL_ORIENTATION, orientation);
+        // Set initial listener properties (the software mixer reads them every block)
+        if (backend == AudioBackend::OpenAL)
+        {
+            alListenerf(AL_GAIN, s_MasterVolume);
+            alListener3f(AL_POSITION, s_ListenerPosition.x, s_ListenerPosition.y, s_ListenerPosition.z);
+            alListener3f(AL_VELOCITY, s_ListenerVelocity.x, s_ListenerVelocity.y, s_ListenerVelocity.z);
+            ALfloat orientation[] = {
+                s_ListenerForward.x, s_ListenerForward.y, s_ListenerForward.z,
+                s_ListenerUp.x, s_ListenerUp.y, s_ListenerUp.z
+            };
+            alListenerfv(AL_ORIENTATION, orientation);
+        }
+
+        s_VoicePool = std::make_unique<VoicePool>();
 
         PIL_CORE_INFO("AudioEngine: Initialized successfully");
     }
@@ -79,20 +187,51 @@ namespace Pillar {
         PIL_CORE_INFO("AudioEngine: Shutting down...");
         
         s_TrackedSources.clear();
+        s_Streams.clear();
+        s_VoicePool.reset();
+        // AL buffers must be deleted while the context is still alive
+        ClearBufferCache();
         s_BusStates.assign(static_cast<size_t>(AudioBus::Count), AudioEngine::BusState{});
         
+        s_SoftwareMixer.reset();
         OpenALContext::Shutdown();
         PIL_CORE_INFO("AudioEngine: Shutdown complete");
     }
 
     bool AudioEngine::IsInitialized()
     {
-        return OpenALContext::IsInitialized();
+        return OpenALContext::IsInitialized() || s_SoftwareMixer != nullptr;
+    }
+
+    AudioBackend AudioEngine::GetBackend()
+    {
+        return s_Backend;
+    }
+
+    SoftwareMixer* AudioEngine::GetSoftwareMixer()
+    {
+        return s_SoftwareMixer.get();
     }
 
     std::shared_ptr<AudioBuffer> AudioEngine::CreateBuffer(const std::string& filepath)
     {
-        return AudioBuffer::Create(filepath);
+        return AcquireBuffer(filepath, false);
+    }
+
+    std::shared_ptr<AudioBuffer> AudioEngine::CreateBuffer(const std::string& filepath, const WavData& wavData)
+    {
+        return AcquireBuffer(filepath, false, &wavData);
+    }
+
+    std::shared_ptr<AudioStream> AudioEngine::CreateStream(const std::string& filepath, AudioBus bus)
+    {
+        auto stream = AudioStream::Create(filepath);
+        if (!stream)
+            return nullptr;
+
+        SetSourceBus(stream->GetSource(), bus);
+        s_Streams.push_back(stream);
+        return stream;
     }
 
     std::shared_ptr<AudioSource> AudioEngine::CreateSource()
@@ -105,37 +244,108 @@ namespace Pillar {
         return source;
     }
 
-    std::shared_ptr<AudioSource> AudioEngine::PlayOneShot(const std::string& filepath, float volume, float pitch, std::optional<glm::vec3> position, AudioBus bus)
+    VoiceHandle AudioEngine::PlayOneShot(const std::string& filepath, float volume, float pitch, std::optional<glm::vec3> position, AudioBus bus, int priority)
     {
-        if (!OpenALContext::IsInitialized())
+        if (!IsInitialized() || !s_VoicePool)
         {
             PIL_CORE_WARN("AudioEngine::PlayOneShot: Audio engine not initialized");
-            return nullptr;
+            return {};
         }
 
-        auto buffer = AudioBuffer::Create(filepath);
+        auto buffer = AcquireBuffer(filepath, false);
         if (!buffer)
         {
             PIL_CORE_WARN("AudioEngine::PlayOneShot: Failed to load buffer for '{0}'", filepath);
-            return nullptr;
+            return {};
         }
 
-        auto source = CreateSource();
-        if (!source)
-            return nullptr;
+        VoiceParams params;
+        params.Volume = std::clamp(volume, 0.0f, 1.0f);
+        params.Pitch = pitch;
+        params.Position = position;
+        params.Bus = bus;
+        params.Priority = priority;
+        return s_VoicePool->Play(buffer, params);
+    }
 
-        source->SetBuffer(buffer);
-        SetSourceBus(source, bus);
-        SetSourceVolume(source, volume);
-        source->SetPitch(pitch);
-        source->SetLooping(false);
-        if (position.has_value())
+    void AudioEngine::StopVoice(VoiceHandle voice)
+    {
+        if (s_VoicePool)
+            s_VoicePool->Stop(voice);
+    }
+
+    bool AudioEngine::IsVoicePlaying(VoiceHandle voice)
+    {
+        return s_VoicePool && s_VoicePool->IsActive(voice);
+    }
+
+    void AudioEngine::SetVoicePosition(VoiceHandle voice, const glm::vec3& position)
+    {
+        if (s_VoicePool)
+            s_VoicePool->SetPosition(voice, position);
+    }
+
+    VoicePool* AudioEngine::GetVoicePool()
+    {
+        return s_VoicePool.get();
+    }
+
+    size_t AudioEngine::PreloadBuffers(const std::vector<std::string>& filepaths, bool pin)
+    {
+        size_t loaded = 0;
+        for (const auto& filepath : filepaths)
         {
-            source->SetPosition(position.value());
+            if (AcquireBuffer(filepath, pin))
+                ++loaded;
         }
+        return loaded;
+    }
 
-        source->Play();
-        return source;
+    void AudioEngine::UnpinBuffers(const std::vector<std::string>& filepaths)
+    {
+        for (const auto& filepath : filepaths)
+        {
+            if (auto found = s_BufferLookup.find(filepath); found != s_BufferLookup.end())
+                found->second->Pinned = false;
+        }
+        EvictBuffers();
+    }
+
+    void AudioEngine::SetBufferCacheBudget(size_t bytes)
+    {
+        s_BufferCacheBudget = bytes;
+        EvictBuffers();
+    }
+
+    size_t AudioEngine::GetBufferCacheBudget()
+    {
+        return s_BufferCacheBudget;
+    }
+
+    size_t AudioEngine::GetBufferCacheMemory()
+    {
+        return s_BufferCacheBytes;
+    }
+
+    size_t AudioEngine::GetCachedBufferCount()
+    {
+        return s_BufferLRU.size();
+    }
+
+    bool AudioEngine::IsBufferCached(const std::string& filepath)
+    {
+        return s_BufferLookup.find(filepath) != s_BufferLookup.end();
+    }
+
+    void AudioEngine::TrimBufferCache()
+    {
+        for (auto it = s_BufferLRU.begin(); it != s_BufferLRU.end();)
+        {
+            if (IsInUse(*it))
+                ++it;
+            else
+                it = EraseCachedBuffer(it);
+        }
     }
 
     void AudioEngine::SetMasterVolume(float volume)
@@ -222,6 +432,21 @@ namespace Pillar {
 
     void AudioEngine::Update(float deltaSeconds)
     {
+        // Streams are fed every frame, paused game or not
+        for (size_t i = 0; i < s_Streams.size();)
+        {
+            if (auto stream = s_Streams[i].lock())
+            {
+                stream->Update();
+                ++i;
+            }
+            else
+            {
+                s_Streams[i] = s_Streams.back();
+                s_Streams.pop_back();
+            }
+        }
+
         if (deltaSeconds <= 0.0f)
             return;
 
@@ -249,6 +474,9 @@ namespace Pillar {
         {
             ApplyAllBusGains();
         }
+
+        if (s_VoicePool)
+            s_VoicePool->Update(deltaSeconds);
     }
 
     void AudioEngine::SetListenerPosition(const glm::vec3& position)
@@ -294,8 +522,21 @@ namespace Pillar {
         }
     }
 
+    glm::vec3 AudioEngine::GetListenerForward()
+    {
+        return s_ListenerForward;
+    }
+
+    glm::vec3 AudioEngine::GetListenerUp()
+    {
+        return s_ListenerUp;
+    }
+
     void AudioEngine::StopAllSounds()
     {
+        if (s_VoicePool)
+            s_VoicePool->StopAll();
+
         CleanupSources();
         for (auto& tracked : s_TrackedSources)
         {
@@ -308,6 +549,9 @@ namespace Pillar {
 
     void AudioEngine::PauseAllSounds()
     {
+        if (s_VoicePool)
+            s_VoicePool->PauseAll();
+
         CleanupSources();
         for (auto& tracked : s_TrackedSources)
         {
@@ -323,6 +567,9 @@ namespace Pillar {
 
     void AudioEngine::ResumeAllSounds()
     {
+        if (s_VoicePool)
+            s_VoicePool->ResumeAll();
+
         CleanupSources();
         for (auto& tracked : s_TrackedSources)
         {
@@ -396,6 +643,18 @@ namespace Pillar {
         return 0.0f;
     }
 
+    void AudioEngine::BeginUpdateBatch()
+    {
+        if (OpenALContext::IsInitialized())
+            OpenALContext::BeginDeferUpdates();
+    }
+
+    void AudioEngine::EndUpdateBatch()
+    {
+        if (OpenALContext::IsInitialized())
+            OpenALContext::EndDeferUpdates();
+    }
+
     void AudioEngine::RegisterSource(const std::shared_ptr<AudioSource>& source)
     {
         CleanupSources();
@@ -425,6 +684,9 @@ namespace Pillar {
 
     void AudioEngine::ApplyAllBusGains()
     {
+        if (s_VoicePool)
+            s_VoicePool->RefreshGains();
+
         CleanupSources();
         for (auto& tracked : s_TrackedSources)
         {
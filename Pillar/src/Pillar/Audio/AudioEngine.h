@@ -2,6 +2,7 @@
 
 #include "Pillar/Core.h"
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -11,6 +12,31 @@ namespace Pillar {
 
     class AudioBuffer;
     class AudioSource;
+    class AudioStream;
+    class SoftwareMixer;
+    class VoicePool;
+    struct WavData;
+
+    /**
+     * @brief Which implementation plays the engine's sources.
+     */
+    enum class AudioBackend
+    {
+        OpenAL = 0,     // Default output device through OpenAL
+        Software        // In-memory SoftwareMixer: no device, deterministic output
+    };
+
+    /**
+     * @brief Handle to a pooled voice (see VoicePool).
+     * Handles go stale once the voice finishes or is stopped; stale handles are ignored.
+     */
+    struct VoiceHandle
+    {
+        uint32_t Index = UINT32_MAX;
+        uint32_t Generation = 0;
+
+        bool IsValid() const { return Index != UINT32_MAX; }
+    };
 
     /**
      * @brief Static audio engine API for managing audio playback.
@@ -24,8 +50,10 @@ namespace Pillar {
         /**
          * @brief Initialize the audio engine.
          * Must be called before using any audio functionality.
+         * @param backend OpenAL for the output device, Software for tests and headless servers
+         *                (rendered with GetSoftwareMixer()->Render()).
          */
-        static void Init();
+        static void Init(AudioBackend backend = AudioBackend::OpenAL);
 
         /**
          * @brief Shutdown the audio engine.
@@ -40,12 +68,33 @@ namespace Pillar {
         static bool IsInitialized();
 
         /**
-         * @brief Create an audio buffer from a WAV file.
+         * @brief The backend chosen at Init().
+         */
+        static AudioBackend GetBackend();
+
+        /**
+         * @brief The software mixer (nullptr unless initialized with AudioBackend::Software).
+         */
+        static SoftwareMixer* GetSoftwareMixer();
+
+        /**
+         * @brief Get the audio buffer for a .wav or .ogg file, loading it on first use.
+         * Buffers are shared through the buffer cache, so repeated calls for the
+         * same path don't touch the disk again.
          * @param filepath Path to the audio file (relative to assets/audio/ or absolute).
-         * @return Shared pointer to the created audio buffer, or nullptr on failure.
+         * @return Shared pointer to the audio buffer, or nullptr on failure.
          */
         static std::shared_ptr<AudioBuffer> CreateBuffer(const std::string& filepath);
 
+        /**
+         * @brief Get the cached buffer for a path, creating it from already-decoded data on a miss.
+         * Lets loaders decode off the main thread and still share buffers through the cache.
+         * @param filepath Path the data was decoded from (the cache key).
+         * @param wavData Decoded samples; ignored when the path is already cached.
+         * @return Shared pointer to the audio buffer, or nullptr on failure.
+         */
+        static std::shared_ptr<AudioBuffer> CreateBuffer(const std::string& filepath, const WavData& wavData);
+
         /**
          * @brief Create an audio source for playback.
          * @return Shared pointer to the created audio source.
@@ -61,6 +110,15 @@ namespace Pillar {
             Count
         };
 
+        /**
+         * @brief Open a long track (e.g. music) for streaming playback.
+         * The engine keeps the stream fed from Update() for as long as the caller holds it.
+         * @param filepath Path to the audio file (relative to assets/audio/ or absolute).
+         * @param bus Bus the stream's source is routed to.
+         * @return Shared pointer to the stream, or nullptr on failure.
+         */
+        static std::shared_ptr<AudioStream> CreateStream(const std::string& filepath, AudioBus bus = AudioBus::Music);
+
         /**
          * @brief Set the master volume for all audio.
          * @param volume Volume level (0.0 = silent, 1.0 = full volume).
@@ -75,10 +133,52 @@ namespace Pillar {
 
         /**
          * @brief Simple one-shot playback helper.
-         * Creates a transient source, assigns the buffer, and plays immediately.
-         * @return The created source, or nullptr if the buffer fails to load or audio is not initialized.
+         * Plays the cached buffer on a voice from the shared voice pool. When the
+         * pool is exhausted, lower-priority voices lose their source first.
+         * @param priority Higher values win when sources are stolen.
+         * @return Handle to the voice, or an invalid handle if the buffer fails to load,
+         *         audio is not initialized, or the pool is full of higher-priority voices.
+         */
+        static VoiceHandle PlayOneShot(const std::string& filepath, float volume = 1.0f, float pitch = 1.0f, std::optional<glm::vec3> position = std::nullopt, AudioBus bus = AudioBus::SFX, int priority = 0);
+
+        static void StopVoice(VoiceHandle voice);
+        static bool IsVoicePlaying(VoiceHandle voice);
+        static void SetVoicePosition(VoiceHandle voice, const glm::vec3& position);
+
+        /**
+         * @brief The shared voice pool (nullptr before Init / after Shutdown).
+         */
+        static VoicePool* GetVoicePool();
+
+        // ==================== Buffer Cache ====================
+        // Buffers are keyed by the path they were requested with. An entry is
+        // in use while anything outside the cache holds its shared_ptr; unused
+        // entries are evicted least recently used first once the cache exceeds
+        // its byte budget. Preloaded entries are pinned until unpinned.
+
+        /**
+         * @brief Load a set of sounds (e.g. a level's sound bank) ahead of use.
+         * @param filepaths Paths to the audio files.
+         * @param pin Keep the buffers cached even while unused.
+         * @return Number of buffers that are now cached.
+         */
+        static size_t PreloadBuffers(const std::vector<std::string>& filepaths, bool pin = true);
+
+        /**
+         * @brief Make preloaded buffers evictable again.
+         */
+        static void UnpinBuffers(const std::vector<std::string>& filepaths);
+
+        static void SetBufferCacheBudget(size_t bytes);
+        static size_t GetBufferCacheBudget();
+        static size_t GetBufferCacheMemory();
+        static size_t GetCachedBufferCount();
+        static bool IsBufferCached(const std::string& filepath);
+
+        /**
+         * @brief Drop every cached buffer that nothing else references (pinned included).
          */
-        static std::shared_ptr<AudioSource> PlayOneShot(const std::string& filepath, float volume = 1.0f, float pitch = 1.0f, std::optional<glm::vec3> position = std::nullopt, AudioBus bus = AudioBus::SFX);
+        static void TrimBufferCache();
 
         /**
          * @brief Set the listener's position in 3D space.
@@ -105,6 +205,9 @@ namespace Pillar {
          */
         static void SetListenerOrientation(const glm::vec3& forward, const glm::vec3& up);
 
+        static glm::vec3 GetListenerForward();
+        static glm::vec3 GetListenerUp();
+
         /**
          * @brief Stop all currently playing audio sources.
          */
@@ -139,6 +242,15 @@ namespace Pillar {
         static void SetSourceVolume(const std::shared_ptr<AudioSource>& source, float volume);
         static float GetSourceUserVolume(const std::shared_ptr<AudioSource>& source);
 
+        // ==================== Update Batching ====================
+
+        /**
+         * @brief Group source property changes so the mixer applies them in one update.
+         * Pairs nest; the changes land at the outermost EndUpdateBatch().
+         */
+        static void BeginUpdateBatch();
+        static void EndUpdateBatch();
+
     private:
         struct BusState
         {
@@ -1,19 +1,34 @@
 #include "Pillar/Audio/AudioSource.h"
+#include "Pillar/Audio/AudioEngine.h"
 #include "Platform/OpenAL/OpenALSource.h"
-#include "Platform/OpenAL/OpenALContext.h"
+#include "Platform/Software/SoftwareMixer.h"
+#include "Platform/Software/SoftwareSource.h"
 #include "Pillar/Logger.h"
 
 namespace Pillar {
 
     std::shared_ptr<AudioSource> AudioSource::Create()
     {
-        if (!OpenALContext::IsInitialized())
+        if (!AudioEngine::IsInitialized())
         {
             PIL_CORE_ERROR("AudioSource::Create: Audio engine not initialized");
             return nullptr;
         }
 
-        return std::make_shared<OpenALSource>();
+        switch (AudioEngine::GetBackend())
+        {
+            case AudioBackend::OpenAL:
+                return std::make_shared<OpenALSource>();
+            case AudioBackend::Software:
+            {
+                auto source = std::make_shared<SoftwareSource>();
+                AudioEngine::GetSoftwareMixer()->AddSource(source);
+                return source;
+            }
+        }
+
+        PIL_CORE_ERROR("AudioSource::Create: Unknown audio backend");
+        return nullptr;
     }
 
 }
@@ -0,0 +1,32 @@
+#include "Pillar/Audio/AudioStream.h"
+#include "Pillar/Audio/AudioEngine.h"
+#include "Platform/OpenAL/OpenALStream.h"
+#include "Platform/Software/SoftwareStream.h"
+#include "Pillar/Logger.h"
+
+namespace Pillar {
+
+    std::shared_ptr<AudioStream> AudioStream::Create(const std::string& filepath)
+    {
+        if (!AudioEngine::IsInitialized())
+        {
+            PIL_CORE_ERROR("AudioStream::Create: Audio engine not initialized");
+            return nullptr;
+        }
+
+        std::shared_ptr<AudioStream> stream;
+        if (AudioEngine::GetBackend() == AudioBackend::Software)
+            stream = std::make_shared<SoftwareStream>(filepath);
+        else
+            stream = std::make_shared<OpenALStream>(filepath);
+
+        if (!stream->IsLoaded())
+        {
+            PIL_CORE_ERROR("AudioStream::Create: Failed to open audio file: {0}", filepath);
+            return nullptr;
+        }
+
+        return stream;
+    }
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include <memory>
+#include <string>
+
+namespace Pillar {
+
+    class AudioSource;
+
+    /**
+     * @brief Audio played by streaming it from disk instead of decoding it up front.
+     *
+     * Meant for music and other long tracks: only a few short chunks are
+     * resident at a time. Chunks are decoded on the shared ThreadPool (on the
+     * calling thread for AudioBackend::Software, to keep its output repeatable)
+     * and queued onto the source from Update(), which AudioEngine calls every
+     * frame for streams it created. Looping wraps inside the decoder, so the loop
+     * point has no gap.
+     *
+     * Volume and bus routing go through the underlying source
+     * (AudioEngine::SetSourceVolume / SetSourceBus on GetSource()).
+     */
+    class PIL_API AudioStream
+    {
+    public:
+        virtual ~AudioStream() = default;
+
+        // ==================== Playback Control ====================
+
+        /**
+         * @brief Start or resume playback. Only the first chunk is decoded before sound starts.
+         */
+        virtual void Play() = 0;
+
+        virtual void Pause() = 0;
+
+        /**
+         * @brief Stop playback and rewind to the beginning.
+         */
+        virtual void Stop() = 0;
+
+        /**
+         * @brief Jump to a position; keeps playing if the stream was playing.
+         * @param seconds Offset from the beginning (wrapped when looping, clamped otherwise).
+         */
+        virtual void Seek(float seconds) = 0;
+
+        virtual void SetLooping(bool loop) = 0;
+        virtual bool IsLooping() const = 0;
+
+        // ==================== State Queries ====================
+
+        virtual bool IsPlaying() const = 0;
+        virtual bool IsPaused() const = 0;
+        virtual bool IsLoaded() const = 0;
+
+        /**
+         * @brief Get the position of the sample currently being heard.
+         * @return Offset from the beginning in seconds.
+         */
+        virtual float GetPlaybackPosition() const = 0;
+
+        virtual float GetDuration() const = 0;
+        virtual const std::string& GetFilePath() const = 0;
+
+        /**
+         * @brief Get the source the stream plays on (for volume, pitch, position and bus routing).
+         */
+        virtual std::shared_ptr<AudioSource> GetSource() const = 0;
+
+        // ==================== Streaming ====================
+
+        /**
+         * @brief Recycle played buffers and queue freshly decoded chunks. Main thread only.
+         */
+        virtual void Update() = 0;
+
+        // ==================== Factory ====================
+
+        /**
+         * @brief Open a .wav or .ogg file for streaming.
+         * Prefer AudioEngine::CreateStream, which also keeps the stream updated.
+         * @param filepath Path to the audio file (relative to assets/audio/ or absolute).
+         * @return Shared pointer to the stream, or nullptr on failure.
+         */
+        static std::shared_ptr<AudioStream> Create(const std::string& filepath);
+    };
+
+}
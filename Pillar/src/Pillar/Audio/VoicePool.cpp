@@ -0,0 +1,359 @@
+#include "Pillar/Audio/VoicePool.h"
+#include "Pillar/Audio/AudioBuffer.h"
+#include "Pillar/Audio/AudioSource.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace Pillar {
+
+    VoicePool::VoicePool(uint32_t sourceCount, uint32_t maxVoices)
+    {
+        m_Sources.reserve(sourceCount);
+        for (uint32_t i = 0; i < sourceCount; ++i)
+        {
+            auto source = AudioSource::Create();
+            if (!source || source->GetSourceID() == 0)
+            {
+                PIL_CORE_WARN("VoicePool: Device ran out of sources, pooling {0} of {1}", i, sourceCount);
+                break;
+            }
+            m_Sources.push_back(std::move(source));
+        }
+
+        // Pop order hands out source 0 first
+        m_FreeSources.reserve(m_Sources.size());
+        for (uint32_t i = static_cast<uint32_t>(m_Sources.size()); i > 0; --i)
+            m_FreeSources.push_back(i - 1);
+        m_SourceOwner.assign(m_Sources.size(), InvalidIndex);
+
+        m_Voices.resize(std::max(maxVoices, 1u));
+        for (uint32_t i = 0; i < m_Voices.size(); ++i)
+            m_Voices[i].NextFree = i + 1 < m_Voices.size() ? i + 1 : InvalidIndex;
+        m_FreeVoice = 0;
+        m_Active.reserve(m_Voices.size());
+    }
+
+    VoicePool::~VoicePool()
+    {
+        StopAll();
+    }
+
+    VoiceHandle VoicePool::Play(const std::shared_ptr<AudioBuffer>& buffer, const VoiceParams& params)
+    {
+        if (!buffer)
+            return {};
+
+        if (m_FreeVoice == InvalidIndex)
+        {
+            // Every slot is taken; drop the least important voice if the new one outranks it
+            uint32_t victim = InvalidIndex;
+            for (uint32_t index : m_Active)
+            {
+                const Voice& voice = m_Voices[index];
+                if (voice.Params.Priority > params.Priority)
+                    continue;
+                if (victim == InvalidIndex || voice.Params.Priority < m_Voices[victim].Params.Priority ||
+                    (voice.Params.Priority == m_Voices[victim].Params.Priority && voice.Audibility < m_Voices[victim].Audibility))
+                    victim = index;
+            }
+            if (victim == InvalidIndex)
+                return {};
+            Release(victim);
+        }
+
+        const uint32_t index = m_FreeVoice;
+        Voice& voice = m_Voices[index];
+        m_FreeVoice = voice.NextFree;
+
+        voice.Buffer = buffer;
+        voice.Params = params;
+        voice.Elapsed = 0.0f;
+        voice.Duration = buffer->GetDuration();
+        voice.Source = InvalidIndex;
+        voice.NextFree = InvalidIndex;
+        voice.Active = true;
+        voice.ActiveIndex = static_cast<uint32_t>(m_Active.size());
+        voice.Audibility = ComputeAudibility(voice);
+        m_Active.push_back(index);
+
+        if (IsAudible(voice) && !m_Paused)
+            Realize(index, true);
+
+        return { index, voice.Generation };
+    }
+
+    void VoicePool::Stop(VoiceHandle handle)
+    {
+        if (Resolve(handle))
+            Release(handle.Index);
+    }
+
+    void VoicePool::SetPosition(VoiceHandle handle, const glm::vec3& position)
+    {
+        Voice* voice = Resolve(handle);
+        if (!voice)
+            return;
+
+        voice->Params.Position = position;
+        if (voice->Source != InvalidIndex)
+            m_Sources[voice->Source]->SetPosition(position);
+    }
+
+    bool VoicePool::IsActive(VoiceHandle handle) const
+    {
+        return Resolve(handle) != nullptr;
+    }
+
+    bool VoicePool::IsVirtual(VoiceHandle handle) const
+    {
+        const Voice* voice = Resolve(handle);
+        return voice && voice->Source == InvalidIndex;
+    }
+
+    void VoicePool::Update(float deltaSeconds)
+    {
+        if (m_Paused)
+            return;
+
+        const glm::vec3 listener = AudioEngine::GetListenerPosition();
+
+        // Advance cursors and retire finished voices; iterate backwards since
+        // Release swap-removes from m_Active
+        for (size_t i = m_Active.size(); i > 0; --i)
+        {
+            const uint32_t index = m_Active[i - 1];
+            Voice& voice = m_Voices[index];
+            voice.Elapsed += deltaSeconds * voice.Params.Pitch;
+
+            const bool real = voice.Source != InvalidIndex;
+            if (!voice.Params.Loop && (voice.Elapsed >= voice.Duration || (real && m_Sources[voice.Source]->IsStopped())))
+            {
+                Release(index);
+                continue;
+            }
+
+            voice.Audibility = ComputeAudibility(voice);
+            if (real && !IsAudible(voice))
+                Virtualize(index);
+            else if (real && !voice.Params.Position)
+                m_Sources[voice.Source]->SetPosition(listener);
+        }
+
+        // Give free sources to the most important audible virtual voices
+        if (GetVirtualVoiceCount() == 0)
+            return;
+
+        auto& waiting = m_Waiting;
+        waiting.clear();
+        for (uint32_t index : m_Active)
+        {
+            if (m_Voices[index].Source == InvalidIndex && IsAudible(m_Voices[index]))
+                waiting.push_back(index);
+        }
+        std::sort(waiting.begin(), waiting.end(), [this](uint32_t a, uint32_t b) {
+            const Voice& va = m_Voices[a];
+            const Voice& vb = m_Voices[b];
+            return va.Params.Priority != vb.Params.Priority ? va.Params.Priority > vb.Params.Priority : va.Audibility > vb.Audibility;
+        });
+
+        // Waiting voices only steal from strictly lower priorities, so equal
+        // voices don't trade sources back and forth every frame
+        for (uint32_t index : waiting)
+        {
+            if (!Realize(index, false))
+                break;
+        }
+    }
+
+    void VoicePool::StopAll()
+    {
+        while (!m_Active.empty())
+            Release(m_Active.back());
+        m_Paused = false;
+    }
+
+    void VoicePool::PauseAll()
+    {
+        if (m_Paused)
+            return;
+
+        m_Paused = true;
+        for (uint32_t index : m_Active)
+        {
+            const Voice& voice = m_Voices[index];
+            if (voice.Source != InvalidIndex)
+                m_Sources[voice.Source]->Pause();
+        }
+    }
+
+    void VoicePool::ResumeAll()
+    {
+        if (!m_Paused)
+            return;
+
+        m_Paused = false;
+        for (uint32_t index : m_Active)
+        {
+            const Voice& voice = m_Voices[index];
+            if (voice.Source != InvalidIndex)
+                m_Sources[voice.Source]->Play();
+        }
+    }
+
+    void VoicePool::RefreshGains()
+    {
+        for (uint32_t index : m_Active)
+        {
+            const Voice& voice = m_Voices[index];
+            if (voice.Source != InvalidIndex)
+                m_Sources[voice.Source]->SetVolume(ComputeGain(voice));
+        }
+    }
+
+    VoicePool::Voice* VoicePool::Resolve(VoiceHandle handle)
+    {
+        return const_cast<Voice*>(std::as_const(*this).Resolve(handle));
+    }
+
+    const VoicePool::Voice* VoicePool::Resolve(VoiceHandle handle) const
+    {
+        if (handle.Index >= m_Voices.size())
+            return nullptr;
+
+        const Voice& voice = m_Voices[handle.Index];
+        return voice.Active && voice.Generation == handle.Generation ? &voice : nullptr;
+    }
+
+    float VoicePool::ComputeGain(const Voice& voice) const
+    {
+        const float gain = voice.Params.Volume * AudioEngine::GetMasterVolume() * AudioEngine::GetBusVolume(voice.Params.Bus);
+        return std::clamp(gain, 0.0f, 1.0f);
+    }
+
+    float VoicePool::ComputeAudibility(const Voice& voice) const
+    {
+        const float gain = ComputeGain(voice);
+        if (!voice.Params.Position)
+            return gain;
+
+        // Same curve OpenAL applies (inverse distance, clamped)
+        const float distance = glm::length(*voice.Params.Position - AudioEngine::GetListenerPosition());
+        if (distance > voice.Params.MaxDistance)
+            return 0.0f;
+
+        const float minDistance = std::max(voice.Params.MinDistance, 0.0001f);
+        const float clamped = std::max(distance, minDistance);
+        return gain * minDistance / (minDistance + voice.Params.RolloffFactor * (clamped - minDistance));
+    }
+
+    bool VoicePool::Realize(uint32_t index, bool stealFromEqualPriority)
+    {
+        Voice& voice = m_Voices[index];
+
+        if (m_FreeSources.empty())
+        {
+            const uint32_t victim = FindStealCandidate(voice.Params.Priority, stealFromEqualPriority);
+            if (victim == InvalidIndex)
+                return false;
+            Virtualize(victim);
+        }
+
+        const uint32_t sourceIndex = m_FreeSources.back();
+        m_FreeSources.pop_back();
+        m_SourceOwner[sourceIndex] = index;
+        voice.Source = sourceIndex;
+
+        const auto& source = m_Sources[sourceIndex];
+        source->SetBuffer(voice.Buffer);
+        source->SetLooping(voice.Params.Loop);
+        source->SetPitch(voice.Params.Pitch);
+        source->SetVolume(ComputeGain(voice));
+        source->SetMinDistance(voice.Params.MinDistance);
+        source->SetMaxDistance(voice.Params.MaxDistance);
+        source->SetRolloffFactor(voice.Params.RolloffFactor);
+        source->SetPosition(voice.Params.Position.value_or(AudioEngine::GetListenerPosition()));
+
+        // Pick up where the virtual cursor got to
+        if (voice.Elapsed > 0.0f && voice.Duration > 0.0f)
+            source->SetPlaybackPosition(voice.Params.Loop ? std::fmod(voice.Elapsed, voice.Duration) : voice.Elapsed);
+
+        source->Play();
+        return true;
+    }
+
+    void VoicePool::Virtualize(uint32_t index)
+    {
+        Voice& voice = m_Voices[index];
+        if (voice.Source == InvalidIndex)
+            return;
+
+        const auto& source = m_Sources[voice.Source];
+        source->Stop();
+        source->SetBuffer(nullptr);
+
+        m_SourceOwner[voice.Source] = InvalidIndex;
+        m_FreeSources.push_back(voice.Source);
+        voice.Source = InvalidIndex;
+    }
+
+    void VoicePool::Release(uint32_t index)
+    {
+        Virtualize(index);
+
+        Voice& voice = m_Voices[index];
+        voice.Buffer.reset();
+        voice.Active = false;
+        ++voice.Generation;
+
+        // Swap-remove from the active list
+        const uint32_t moved = m_Active.back();
+        m_Active[voice.ActiveIndex] = moved;
+        m_Voices[moved].ActiveIndex = voice.ActiveIndex;
+        m_Active.pop_back();
+        voice.ActiveIndex = InvalidIndex;
+
+        voice.NextFree = m_FreeVoice;
+        m_FreeVoice = index;
+    }
+
+    uint32_t VoicePool::FindStealCandidate(int priority, bool includeEqualPriority) const
+    {
+        uint32_t victim = InvalidIndex;
+        for (uint32_t owner : m_SourceOwner)
+        {
+            if (owner == InvalidIndex)
+                continue;
+
+            const Voice& voice = m_Voices[owner];
+            if (voice.Params.Priority > priority || (!includeEqualPriority && voice.Params.Priority == priority))
+                continue;
+
+            if (victim == InvalidIndex)
+            {
+                victim = owner;
+                continue;
+            }
+
+            // Lowest priority, then quietest, then the one furthest through its sound
+            const Voice& best = m_Voices[victim];
+            if (voice.Params.Priority != best.Params.Priority)
+            {
+                if (voice.Params.Priority < best.Params.Priority)
+                    victim = owner;
+            }
+            else if (voice.Audibility != best.Audibility)
+            {
+                if (voice.Audibility < best.Audibility)
+                    victim = owner;
+            }
+            else if (voice.Elapsed > best.Elapsed)
+            {
+                victim = owner;
+            }
+        }
+        return victim;
+    }
+
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include "Pillar/Audio/AudioEngine.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Pillar {
+
+    class AudioBuffer;
+    class AudioSource;
+
+    /**
+     * @brief Playback settings for a pooled voice.
+     */
+    struct VoiceParams
+    {
+        float Volume = 1.0f;
+        float Pitch = 1.0f;
+        bool Loop = false;
+        std::optional<glm::vec3> Position;  // nullopt = 2D, follows the listener
+        AudioEngine::AudioBus Bus = AudioEngine::AudioBus::SFX;
+        int Priority = 0;                   // Higher priorities steal sources from lower ones
+        float MinDistance = 1.0f;
+        float MaxDistance = 100.0f;         // Beyond this the voice is virtualized
+        float RolloffFactor = 1.0f;
+    };
+
+    /**
+     * @brief Fixed pool of pre-generated audio sources shared by fire-and-forget voices.
+     *
+     * A voice is the logical sound; a source is the OpenAL object playing it.
+     * Voices that can't be heard (out of range, or too quiet after distance
+     * attenuation) are virtualized: they give their source back but keep their
+     * play cursor, and are re-bound at the right offset once they become
+     * audible again. When every source is busy, a new voice steals the source
+     * of the least important real voice (lowest priority, then quietest, then
+     * oldest) if that voice's priority is not higher; the stolen voice becomes
+     * virtual.
+     *
+     * Voice slots and sources are recycled through free lists, so playing and
+     * finishing a voice is O(1). Update() walks only the active voices.
+     */
+    class PIL_API VoicePool
+    {
+    public:
+        static constexpr uint32_t DefaultSourceCount = 32;
+        static constexpr uint32_t DefaultMaxVoices = 256;
+
+        /**
+         * @param sourceCount Sources generated up front (fewer if the device runs out).
+         * @param maxVoices Real plus virtual voices that can be alive at once.
+         */
+        VoicePool(uint32_t sourceCount = DefaultSourceCount, uint32_t maxVoices = DefaultMaxVoices);
+        ~VoicePool();
+
+        VoicePool(const VoicePool&) = delete;
+        VoicePool& operator=(const VoicePool&) = delete;
+
+        /**
+         * @brief Start a voice.
+         * @return Handle to the voice, or an invalid handle if the buffer is null
+         *         or every voice slot is taken by voices of higher priority.
+         */
+        VoiceHandle Play(const std::shared_ptr<AudioBuffer>& buffer, const VoiceParams& params);
+
+        void Stop(VoiceHandle handle);
+        void SetPosition(VoiceHandle handle, const glm::vec3& position);
+        bool IsActive(VoiceHandle handle) const;
+        bool IsVirtual(VoiceHandle handle) const;
+
+        /**
+         * @brief Advance play cursors, retire finished voices and re-balance
+         *        sources between real and virtual voices.
+         */
+        void Update(float deltaSeconds);
+
+        void StopAll();
+        void PauseAll();
+        void ResumeAll();
+
+        // Re-apply master/bus gains to the voices holding a source
+        void RefreshGains();
+
+        uint32_t GetSourceCount() const { return static_cast<uint32_t>(m_Sources.size()); }
+        uint32_t GetActiveVoiceCount() const { return static_cast<uint32_t>(m_Active.size()); }
+        uint32_t GetRealVoiceCount() const { return GetSourceCount() - static_cast<uint32_t>(m_FreeSources.size()); }
+        uint32_t GetVirtualVoiceCount() const { return GetActiveVoiceCount() - GetRealVoiceCount(); }
+
+        // Audibility (gain after distance attenuation) below which voices are virtualized
+        void SetVirtualizeThreshold(float threshold) { m_VirtualizeThreshold = threshold; }
+        float GetVirtualizeThreshold() const { return m_VirtualizeThreshold; }
+
+    private:
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+        struct Voice
+        {
+            std::shared_ptr<AudioBuffer> Buffer;
+            VoiceParams Params;
+            float Elapsed = 0.0f;       // Seconds of audio played, pitch included
+            float Duration = 0.0f;
+            float Audibility = 0.0f;
+            uint32_t Source = InvalidIndex;
+            uint32_t ActiveIndex = InvalidIndex;
+            uint32_t NextFree = InvalidIndex;
+            uint32_t Generation = 0;
+            bool Active = false;
+        };
+
+        Voice* Resolve(VoiceHandle handle);
+        const Voice* Resolve(VoiceHandle handle) const;
+
+        float ComputeAudibility(const Voice& voice) const;
+        float ComputeGain(const Voice& voice) const;
+        bool IsAudible(const Voice& voice) const { return voice.Audibility >= m_VirtualizeThreshold; }
+
+        bool Realize(uint32_t index, bool stealFromEqualPriority);
+        void Virtualize(uint32_t index);
+        void Release(uint32_t index);
+        uint32_t FindStealCandidate(int priority, bool includeEqualPriority) const;
+
+        std::vector<std::shared_ptr<AudioSource>> m_Sources;
+        std::vector<uint32_t> m_FreeSources;    // Stack of indices into m_Sources
+        std::vector<uint32_t> m_SourceOwner;    // Voice bound to each source
+
+        std::vector<Voice> m_Voices;
+        std::vector<uint32_t> m_Active;         // Indices into m_Voices
+        uint32_t m_FreeVoice = InvalidIndex;    // Head of the intrusive free list
+        std::vector<uint32_t> m_Waiting;        // Update() scratch: virtual voices to re-bind
+
+        float m_VirtualizeThreshold = 0.001f;
+        bool m_Paused = false;
+    };
+
+}
@@ -0,0 +1,66 @@
+#include "Pillar/Audio/VorbisDecoder.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+#include <climits>
+
+// Declarations only here; the implementation is compiled at the end of this file
+#define STB_VORBIS_HEADER_ONLY
+#include <stb_vorbis.c>
+
+namespace Pillar {
+
+    VorbisDecoder::~VorbisDecoder()
+    {
+        if (m_Vorbis)
+            stb_vorbis_close(m_Vorbis);
+    }
+
+    bool VorbisDecoder::Open(const std::string& filepath)
+    {
+        int error = 0;
+        m_Vorbis = stb_vorbis_open_filename(filepath.c_str(), &error, nullptr);
+        if (!m_Vorbis)
+        {
+            PIL_CORE_ERROR("VorbisDecoder: Failed to open {0} (stb_vorbis error {1})", filepath, error);
+            return false;
+        }
+
+        const stb_vorbis_info info = stb_vorbis_get_info(m_Vorbis);
+        m_SampleRate = static_cast<int>(info.sample_rate);
+        m_Channels = std::min(info.channels, 2);
+        m_FrameCount = stb_vorbis_stream_length_in_samples(m_Vorbis);
+        if (m_FrameCount == 0)
+        {
+            PIL_CORE_ERROR("VorbisDecoder: No samples in {0}", filepath);
+            return false;
+        }
+        return true;
+    }
+
+    uint64_t VorbisDecoder::ReadFrames(char* out, uint64_t frameCount)
+    {
+        auto* samples = reinterpret_cast<short*>(out);
+        uint64_t done = 0;
+        while (done < frameCount)
+        {
+            const auto shorts = static_cast<int>(std::min<uint64_t>((frameCount - done) * m_Channels, INT_MAX / 2));
+            const int frames = stb_vorbis_get_samples_short_interleaved(m_Vorbis, m_Channels, samples + done * m_Channels, shorts);
+            if (frames <= 0)
+                break;
+            done += static_cast<uint64_t>(frames);
+        }
+        return done;
+    }
+
+    bool VorbisDecoder::SeekFrame(uint64_t frame)
+    {
+        const auto target = static_cast<unsigned int>(std::min(frame, m_FrameCount));
+        if (target == 0)
+            return stb_vorbis_seek_start(m_Vorbis) != 0;
+        return stb_vorbis_seek(m_Vorbis, target) != 0;
+    }
+
+}
+
+#undef STB_VORBIS_HEADER_ONLY
+#include <stb_vorbis.c>
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Pillar/Audio/AudioDecoder.h"
+
+struct stb_vorbis;
+
+namespace Pillar {
+
+    /**
+     * @brief Ogg Vorbis decoder built on stb_vorbis' pull API.
+     *
+     * Decodes to 16-bit; files with more than two channels are mixed down
+     * to stereo. Seeking is sample-accurate.
+     */
+    class PIL_API VorbisDecoder : public AudioDecoder
+    {
+    public:
+        VorbisDecoder() = default;
+        ~VorbisDecoder();
+
+        VorbisDecoder(const VorbisDecoder&) = delete;
+        VorbisDecoder& operator=(const VorbisDecoder&) = delete;
+
+        /**
+         * @param filepath Resolved path to the .ogg file.
+         * @return true if the file holds a readable Vorbis stream.
+         */
+        bool Open(const std::string& filepath);
+
+        // AudioDecoder interface
+        int GetSampleRate() const override { return m_SampleRate; }
+        int GetChannels() const override { return m_Channels; }
+        int GetBitsPerSample() const override { return 16; }
+        uint64_t GetFrameCount() const override { return m_FrameCount; }
+        uint64_t ReadFrames(char* out, uint64_t frameCount) override;
+        bool SeekFrame(uint64_t frame) override;
+
+    private:
+        stb_vorbis* m_Vorbis = nullptr;
+        int m_SampleRate = 0;
+        int m_Channels = 0;
+        uint64_t m_FrameCount = 0;
+    };
+
+}
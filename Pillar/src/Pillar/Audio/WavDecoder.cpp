@@ -0,0 +1,318 @@
+#include "Pillar/Audio/WavDecoder.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Pillar {
+
+    namespace {
+
+        constexpr int s_StepTable[89] = {
+            7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+            50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+            253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+            1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+            3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+            12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+        };
+
+        constexpr int s_IndexTable[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+        inline int16_t DecodeNibble(uint8_t nibble, int& predictor, int& index)
+        {
+            const int step = s_StepTable[index];
+            int diff = step >> 3;
+            if (nibble & 4) diff += step;
+            if (nibble & 2) diff += step >> 1;
+            if (nibble & 1) diff += step >> 2;
+
+            predictor = std::clamp((nibble & 8) ? predictor - diff : predictor + diff, -32768, 32767);
+            index = std::clamp(index + s_IndexTable[nibble], 0, 88);
+            return static_cast<int16_t>(predictor);
+        }
+
+        inline uint8_t EncodeNibble(int sample, int& predictor, int& index)
+        {
+            int step = s_StepTable[index];
+            int diff = sample - predictor;
+            uint8_t nibble = 0;
+            if (diff < 0)
+            {
+                nibble = 8;
+                diff = -diff;
+            }
+            if (diff >= step) { nibble |= 4; diff -= step; }
+            step >>= 1;
+            if (diff >= step) { nibble |= 2; diff -= step; }
+            step >>= 1;
+            if (diff >= step) nibble |= 1;
+
+            // Track the decoder's state exactly so errors don't accumulate
+            DecodeNibble(nibble, predictor, index);
+            return nibble;
+        }
+
+        template<typename T>
+        void WriteValue(std::ofstream& file, T value)
+        {
+            file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+    }
+
+    // ==================== PcmWavDecoder ====================
+
+    bool PcmWavDecoder::Open(const std::string& filepath, const WavLayout& layout)
+    {
+        if ((layout.Channels != 1 && layout.Channels != 2) || (layout.BitsPerSample != 8 && layout.BitsPerSample != 16))
+        {
+            PIL_CORE_ERROR("PcmWavDecoder: Only 8/16-bit mono or stereo is supported ({0}ch, {1}-bit) in {2}",
+                layout.Channels, layout.BitsPerSample, filepath);
+            return false;
+        }
+
+        m_File.open(filepath, std::ios::binary);
+        if (!m_File.is_open())
+        {
+            PIL_CORE_ERROR("PcmWavDecoder: Failed to open file: {0}", filepath);
+            return false;
+        }
+
+        m_Layout = layout;
+        m_FrameCount = layout.DataSize / GetFrameSize();
+        return SeekFrame(0);
+    }
+
+    uint64_t PcmWavDecoder::ReadFrames(char* out, uint64_t frameCount)
+    {
+        const uint32_t frameSize = GetFrameSize();
+        const uint64_t frames = std::min(frameCount, m_FrameCount - m_Frame);
+        if (frames == 0)
+            return 0;
+
+        m_File.read(out, static_cast<std::streamsize>(frames * frameSize));
+        const uint64_t framesRead = static_cast<uint64_t>(m_File.gcount()) / frameSize;
+        m_Frame += framesRead;
+        return framesRead;
+    }
+
+    bool PcmWavDecoder::SeekFrame(uint64_t frame)
+    {
+        m_Frame = std::min(frame, m_FrameCount);
+        m_File.clear();
+        m_File.seekg(static_cast<std::streamoff>(m_Layout.DataOffset + m_Frame * GetFrameSize()));
+        return static_cast<bool>(m_File);
+    }
+
+    // ==================== ImaAdpcmDecoder ====================
+
+    bool ImaAdpcmDecoder::Open(const std::string& filepath, const WavLayout& layout)
+    {
+        if ((layout.Channels != 1 && layout.Channels != 2) || layout.BitsPerSample != 4)
+        {
+            PIL_CORE_ERROR("ImaAdpcmDecoder: Only 4-bit mono or stereo is supported ({0}ch, {1}-bit) in {2}",
+                layout.Channels, layout.BitsPerSample, filepath);
+            return false;
+        }
+
+        m_FramesPerBlock = FramesPerBlock(layout.BlockAlign, layout.Channels);
+        if (m_FramesPerBlock <= 1)
+        {
+            PIL_CORE_ERROR("ImaAdpcmDecoder: Invalid block size {0} in {1}", layout.BlockAlign, filepath);
+            return false;
+        }
+        if (layout.SamplesPerBlock != 0 && layout.SamplesPerBlock != m_FramesPerBlock)
+            PIL_CORE_WARN("ImaAdpcmDecoder: Header claims {0} samples per block, block size gives {1}", layout.SamplesPerBlock, m_FramesPerBlock);
+
+        m_File.open(filepath, std::ios::binary);
+        if (!m_File.is_open())
+        {
+            PIL_CORE_ERROR("ImaAdpcmDecoder: Failed to open file: {0}", filepath);
+            return false;
+        }
+
+        m_Layout = layout;
+        const uint64_t fullBlocks = layout.DataSize / layout.BlockAlign;
+        const auto remainder = static_cast<uint32_t>(layout.DataSize % layout.BlockAlign);
+        m_FrameCount = fullBlocks * m_FramesPerBlock + FramesPerBlock(remainder, layout.Channels);
+
+        // The fact chunk trims the silence padding the last block
+        if (layout.FactFrames != 0)
+            m_FrameCount = std::min<uint64_t>(m_FrameCount, layout.FactFrames);
+
+        m_BlockBytes.resize(layout.BlockAlign);
+        m_BlockSamples.resize(static_cast<size_t>(m_FramesPerBlock) * layout.Channels);
+        return SeekFrame(0);
+    }
+
+    uint64_t ImaAdpcmDecoder::ReadFrames(char* out, uint64_t frameCount)
+    {
+        const uint32_t frameSize = GetFrameSize();
+        uint64_t done = 0;
+        while (done < frameCount && m_Frame < m_FrameCount)
+        {
+            const uint64_t block = m_Frame / m_FramesPerBlock;
+            if (!LoadBlock(block))
+                break;
+
+            const uint64_t offset = m_Frame - block * m_FramesPerBlock;
+            if (offset >= m_LoadedFrames)
+                break;
+
+            const uint64_t frames = std::min({ m_LoadedFrames - offset, frameCount - done, m_FrameCount - m_Frame });
+            std::memcpy(out + done * frameSize, m_BlockSamples.data() + offset * m_Layout.Channels, static_cast<size_t>(frames * frameSize));
+            done += frames;
+            m_Frame += frames;
+        }
+        return done;
+    }
+
+    bool ImaAdpcmDecoder::SeekFrame(uint64_t frame)
+    {
+        // Blocks decode independently; the next read loads whichever one this lands in
+        m_Frame = std::min(frame, m_FrameCount);
+        return true;
+    }
+
+    bool ImaAdpcmDecoder::LoadBlock(uint64_t block)
+    {
+        if (block == m_LoadedBlock)
+            return m_LoadedFrames > 0;
+
+        const uint64_t start = block * m_Layout.BlockAlign;
+        const auto size = static_cast<uint32_t>(std::min<uint64_t>(m_Layout.BlockAlign, m_Layout.DataSize - start));
+
+        m_File.clear();
+        m_File.seekg(static_cast<std::streamoff>(m_Layout.DataOffset + start));
+        m_File.read(reinterpret_cast<char*>(m_BlockBytes.data()), size);
+
+        m_LoadedBlock = block;
+        m_LoadedFrames = DecodeBlock(m_BlockBytes.data(), static_cast<uint32_t>(m_File.gcount()), m_Layout.Channels, m_BlockSamples.data());
+        return m_LoadedFrames > 0;
+    }
+
+    uint32_t ImaAdpcmDecoder::FramesPerBlock(uint32_t blockAlign, int channels)
+    {
+        // A header sample per channel, then groups of 4 bytes (8 samples) per channel
+        const uint32_t headerSize = 4u * static_cast<uint32_t>(channels);
+        if (blockAlign < headerSize)
+            return 0;
+        return (blockAlign - headerSize) / headerSize * 8 + 1;
+    }
+
+    uint32_t ImaAdpcmDecoder::DecodeBlock(const uint8_t* block, uint32_t blockSize, int channels, int16_t* out)
+    {
+        const uint32_t frames = FramesPerBlock(blockSize, channels);
+        if (frames == 0)
+            return 0;
+
+        int predictor[2] = {};
+        int index[2] = {};
+        for (int c = 0; c < channels; ++c)
+        {
+            const uint8_t* header = block + c * 4;
+            predictor[c] = static_cast<int16_t>(header[0] | (header[1] << 8));
+            index[c] = std::min<int>(header[2], 88);
+            out[c] = static_cast<int16_t>(predictor[c]);
+        }
+
+        // Channels alternate every 4 bytes; within a byte the low nibble comes first
+        const uint8_t* data = block + 4 * channels;
+        for (uint32_t frame = 1; frame < frames; frame += 8)
+        {
+            for (int c = 0; c < channels; ++c)
+            {
+                int16_t* dst = out + static_cast<size_t>(frame) * channels + c;
+                for (int i = 0; i < 4; ++i)
+                {
+                    const uint8_t byte = *data++;
+                    dst[(2 * i) * channels] = DecodeNibble(byte & 0x0F, predictor[c], index[c]);
+                    dst[(2 * i + 1) * channels] = DecodeNibble(byte >> 4, predictor[c], index[c]);
+                }
+            }
+        }
+        return frames;
+    }
+
+    bool ImaAdpcmDecoder::Encode(const std::string& filepath, const int16_t* samples, uint64_t frameCount,
+                                 int channels, int sampleRate, uint32_t blockAlign)
+    {
+        const uint32_t headerSize = 4u * static_cast<uint32_t>(channels);
+        if ((channels != 1 && channels != 2) || blockAlign < 2 * headerSize || (blockAlign - headerSize) % headerSize != 0)
+        {
+            PIL_CORE_ERROR("ImaAdpcmDecoder: Can't encode {0}ch with {1}-byte blocks", channels, blockAlign);
+            return false;
+        }
+
+        std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            PIL_CORE_ERROR("ImaAdpcmDecoder: Failed to create file: {0}", filepath);
+            return false;
+        }
+
+        const uint32_t framesPerBlock = FramesPerBlock(blockAlign, channels);
+        const uint64_t blockCount = (frameCount + framesPerBlock - 1) / framesPerBlock;
+        const auto dataSize = static_cast<uint32_t>(blockCount * blockAlign);
+
+        // RIFF header, fmt with the samples-per-block extension, fact, data
+        file.write("RIFF", 4);
+        WriteValue<uint32_t>(file, 4 + (8 + 20) + (8 + 4) + (8 + dataSize));
+        file.write("WAVE", 4);
+        file.write("fmt ", 4);
+        WriteValue<uint32_t>(file, 20);
+        WriteValue<uint16_t>(file, FormatTag);
+        WriteValue<uint16_t>(file, static_cast<uint16_t>(channels));
+        WriteValue<uint32_t>(file, static_cast<uint32_t>(sampleRate));
+        WriteValue<uint32_t>(file, static_cast<uint32_t>(static_cast<uint64_t>(sampleRate) * blockAlign / framesPerBlock));
+        WriteValue<uint16_t>(file, static_cast<uint16_t>(blockAlign));
+        WriteValue<uint16_t>(file, 4);
+        WriteValue<uint16_t>(file, 2);
+        WriteValue<uint16_t>(file, static_cast<uint16_t>(framesPerBlock));
+        file.write("fact", 4);
+        WriteValue<uint32_t>(file, 4);
+        WriteValue<uint32_t>(file, static_cast<uint32_t>(frameCount));
+        file.write("data", 4);
+        WriteValue<uint32_t>(file, dataSize);
+
+        auto sampleAt = [&](uint64_t frame, int channel) -> int {
+            return frame < frameCount ? samples[frame * channels + channel] : 0;
+        };
+
+        int predictor[2] = {};
+        int index[2] = {};
+        std::vector<uint8_t> block(blockAlign);
+        for (uint64_t b = 0; b < blockCount; ++b)
+        {
+            const uint64_t first = b * framesPerBlock;
+            for (int c = 0; c < channels; ++c)
+            {
+                // Each block restarts from the exact first sample; the step index carries over
+                predictor[c] = sampleAt(first, c);
+                uint8_t* header = block.data() + c * 4;
+                header[0] = static_cast<uint8_t>(predictor[c] & 0xFF);
+                header[1] = static_cast<uint8_t>((predictor[c] >> 8) & 0xFF);
+                header[2] = static_cast<uint8_t>(index[c]);
+                header[3] = 0;
+            }
+
+            uint8_t* data = block.data() + headerSize;
+            for (uint32_t frame = 1; frame < framesPerBlock; frame += 8)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    for (uint32_t i = 0; i < 4; ++i)
+                    {
+                        const uint8_t low = EncodeNibble(sampleAt(first + frame + 2 * i, c), predictor[c], index[c]);
+                        const uint8_t high = EncodeNibble(sampleAt(first + frame + 2 * i + 1, c), predictor[c], index[c]);
+                        *data++ = static_cast<uint8_t>(low | (high << 4));
+                    }
+                }
+            }
+            file.write(reinterpret_cast<const char*>(block.data()), blockAlign);
+        }
+
+        return static_cast<bool>(file);
+    }
+
+}
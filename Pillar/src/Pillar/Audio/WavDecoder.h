@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Pillar/Audio/AudioDecoder.h"
+#include "Pillar/Audio/WavLoader.h"
+#include <fstream>
+#include <vector>
+
+namespace Pillar {
+
+    /**
+     * @brief Decoder for uncompressed 8/16-bit PCM WAV files (frames are copied straight from disk).
+     */
+    class PIL_API PcmWavDecoder : public AudioDecoder
+    {
+    public:
+        static constexpr uint16_t FormatTag = 1;
+
+        /**
+         * @param filepath Resolved path to the WAV file.
+         * @param layout Chunk layout from WavLoader::ReadLayout.
+         * @return true if the format is supported and the file is readable.
+         */
+        bool Open(const std::string& filepath, const WavLayout& layout);
+
+        // AudioDecoder interface
+        int GetSampleRate() const override { return static_cast<int>(m_Layout.SampleRate); }
+        int GetChannels() const override { return m_Layout.Channels; }
+        int GetBitsPerSample() const override { return m_Layout.BitsPerSample; }
+        uint64_t GetFrameCount() const override { return m_FrameCount; }
+        uint64_t ReadFrames(char* out, uint64_t frameCount) override;
+        bool SeekFrame(uint64_t frame) override;
+
+    private:
+        std::ifstream m_File;
+        WavLayout m_Layout;
+        uint64_t m_FrameCount = 0;
+        uint64_t m_Frame = 0;
+    };
+
+    /**
+     * @brief Decoder for IMA-ADPCM WAV files (format tag 0x11), 4 bits per sample.
+     *
+     * Each block starts with a predictor and step index per channel, so any
+     * block decodes on its own; seeking decodes only the block it lands in.
+     * Output is 16-bit.
+     */
+    class PIL_API ImaAdpcmDecoder : public AudioDecoder
+    {
+    public:
+        static constexpr uint16_t FormatTag = 0x11;
+
+        /**
+         * @param filepath Resolved path to the WAV file.
+         * @param layout Chunk layout from WavLoader::ReadLayout.
+         * @return true if the format is supported and the file is readable.
+         */
+        bool Open(const std::string& filepath, const WavLayout& layout);
+
+        // AudioDecoder interface
+        int GetSampleRate() const override { return static_cast<int>(m_Layout.SampleRate); }
+        int GetChannels() const override { return m_Layout.Channels; }
+        int GetBitsPerSample() const override { return 16; }
+        uint64_t GetFrameCount() const override { return m_FrameCount; }
+        uint64_t ReadFrames(char* out, uint64_t frameCount) override;
+        bool SeekFrame(uint64_t frame) override;
+
+        /**
+         * @brief Frames held by a block of the given size.
+         */
+        static uint32_t FramesPerBlock(uint32_t blockAlign, int channels);
+
+        /**
+         * @brief Decode one block into interleaved 16-bit samples.
+         * @param block Block bytes (may be a truncated final block).
+         * @param blockSize Number of bytes in block.
+         * @param channels 1 or 2.
+         * @param out Destination of FramesPerBlock(blockSize, channels) frames.
+         * @return Frames decoded.
+         */
+        static uint32_t DecodeBlock(const uint8_t* block, uint32_t blockSize, int channels, int16_t* out);
+
+        /**
+         * @brief Write 16-bit PCM as an IMA-ADPCM WAV file, a quarter of the PCM size.
+         * For asset conversion; the last block is padded with silence and the
+         * fact chunk records the real length.
+         * @param filepath Output path.
+         * @param samples Interleaved samples, frameCount * channels of them.
+         * @param frameCount Frames to encode.
+         * @param channels 1 or 2.
+         * @param sampleRate Sample rate in Hz.
+         * @param blockAlign Bytes per block (a multiple of 4 * channels).
+         * @return true if the file was written.
+         */
+        static bool Encode(const std::string& filepath, const int16_t* samples, uint64_t frameCount,
+                           int channels, int sampleRate, uint32_t blockAlign = 1024);
+
+    private:
+        bool LoadBlock(uint64_t block);
+
+        std::ifstream m_File;
+        WavLayout m_Layout;
+        uint32_t m_FramesPerBlock = 0;
+        uint64_t m_FrameCount = 0;
+        uint64_t m_Frame = 0;
+
+        std::vector<uint8_t> m_BlockBytes;
+        std::vector<int16_t> m_BlockSamples;
+        uint64_t m_LoadedBlock = UINT64_MAX;
+        uint32_t m_LoadedFrames = 0;
+    };
+
+}
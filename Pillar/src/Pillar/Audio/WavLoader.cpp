@@ -1,6 +1,7 @@
 #include "Pillar/Audio/WavLoader.h"
 #include "Pillar/Logger.h"
 #include <fstream>
+#include <algorithm>
 #include <cstring>
 
 namespace Pillar {
@@ -66,6 +67,126 @@ namespace Pillar {
         return true;
     }
 
+    bool WavLoader::ReadHeader(const std::string& filepath, WavData& outFormat, size_t& dataOffset, size_t& dataSize)
+    {
+        WavLayout layout;
+        if (!ReadLayout(filepath, layout))
+            return false;
+
+        if (!ParseFormat(layout.AudioFormat, layout.Channels, layout.SampleRate, layout.BitsPerSample, outFormat))
+            return false;
+
+        dataOffset = layout.DataOffset;
+        dataSize = layout.DataSize;
+        const int bytesPerSecond = outFormat.SampleRate * outFormat.Channels * (outFormat.BitsPerSample / 8);
+        outFormat.Duration = static_cast<float>(dataSize) / static_cast<float>(bytesPerSecond);
+        return true;
+    }
+
+    bool WavLoader::ReadLayout(const std::string& filepath, WavLayout& outLayout)
+    {
+        std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+        {
+            PIL_CORE_ERROR("WavLoader: Failed to open file: {0}", filepath);
+            return false;
+        }
+        const size_t fileSize = static_cast<size_t>(file.tellg());
+        file.seekg(0, std::ios::beg);
+
+        RIFFHeader riffHeader;
+        if (!file.read(reinterpret_cast<char*>(&riffHeader), sizeof(riffHeader)) ||
+            std::strncmp(riffHeader.ChunkID, "RIFF", 4) != 0 || std::strncmp(riffHeader.Format, "WAVE", 4) != 0)
+        {
+            PIL_CORE_ERROR("WavLoader: Not a RIFF/WAVE file: {0}", filepath);
+            return false;
+        }
+
+        // Walk the chunk headers, reading only the fmt and fact bodies
+        bool foundFmt = false;
+        size_t offset = sizeof(RIFFHeader);
+        while (offset + 8 <= fileSize)
+        {
+            char chunkID[4];
+            uint32_t chunkSize = 0;
+            file.seekg(static_cast<std::streamoff>(offset));
+            if (!file.read(chunkID, 4) || !file.read(reinterpret_cast<char*>(&chunkSize), 4))
+                break;
+
+            if (std::strncmp(chunkID, "fmt ", 4) == 0)
+            {
+                FmtChunk fmtChunk;
+                file.seekg(static_cast<std::streamoff>(offset));
+                if (chunkSize + 8 < sizeof(FmtChunk) || !file.read(reinterpret_cast<char*>(&fmtChunk), sizeof(fmtChunk)))
+                {
+                    PIL_CORE_ERROR("WavLoader: Truncated fmt chunk in {0}", filepath);
+                    return false;
+                }
+                outLayout.AudioFormat = fmtChunk.AudioFormat;
+                outLayout.Channels = fmtChunk.NumChannels;
+                outLayout.SampleRate = fmtChunk.SampleRate;
+                outLayout.BlockAlign = fmtChunk.BlockAlign;
+                outLayout.BitsPerSample = fmtChunk.BitsPerSample;
+
+                // Compressed formats append cbSize and the samples per block
+                uint16_t extension[2] = {};
+                if (chunkSize >= 20 && file.read(reinterpret_cast<char*>(extension), sizeof(extension)) && extension[0] >= 2)
+                    outLayout.SamplesPerBlock = extension[1];
+                foundFmt = true;
+            }
+            else if (std::strncmp(chunkID, "fact", 4) == 0 && chunkSize >= 4)
+            {
+                file.read(reinterpret_cast<char*>(&outLayout.FactFrames), sizeof(outLayout.FactFrames));
+            }
+            else if (std::strncmp(chunkID, "data", 4) == 0)
+            {
+                if (!foundFmt)
+                {
+                    PIL_CORE_ERROR("WavLoader: data chunk before fmt chunk in {0}", filepath);
+                    return false;
+                }
+
+                outLayout.DataOffset = offset + 8;
+                outLayout.DataSize = std::min<size_t>(chunkSize, fileSize - outLayout.DataOffset);
+                return true;
+            }
+
+            offset += 8 + chunkSize + (chunkSize % 2);
+        }
+
+        PIL_CORE_ERROR("WavLoader: {0} chunk not found in {1}", foundFmt ? "data" : "fmt", filepath);
+        return false;
+    }
+
+    bool WavLoader::ParseFormat(uint16_t audioFormat, uint16_t channels, uint32_t sampleRate, uint16_t bitsPerSample, WavData& outData)
+    {
+        // Check for PCM format (AudioFormat == 1)
+        if (audioFormat != 1)
+        {
+            PIL_CORE_ERROR("WavLoader: Only PCM format is supported (found format: {0})", audioFormat);
+            return false;
+        }
+
+        outData.Channels = channels;
+        outData.SampleRate = sampleRate;
+        outData.BitsPerSample = bitsPerSample;
+
+        // Validate supported formats
+        if (outData.Channels != 1 && outData.Channels != 2)
+        {
+            PIL_CORE_ERROR("WavLoader: Only mono and stereo are supported (found {0} channels)", outData.Channels);
+            return false;
+        }
+
+        if (outData.BitsPerSample != 8 && outData.BitsPerSample != 16)
+        {
+            PIL_CORE_ERROR("WavLoader: Only 8-bit and 16-bit samples are supported (found {0}-bit)", outData.BitsPerSample);
+            return false;
+        }
+
+        return true;
+    }
+
     bool WavLoader::ParseHeader(const char* data, size_t size, WavData& outData, size_t& dataOffset, size_t& dataSize)
     {
         // Minimum size check for RIFF header
@@ -110,30 +231,8 @@ namespace Pillar {
                 }
 
                 const FmtChunk* fmtChunk = reinterpret_cast<const FmtChunk*>(data + offset);
-                
-                // Check for PCM format (AudioFormat == 1)
-                if (fmtChunk->AudioFormat != 1)
-                {
-                    PIL_CORE_ERROR("WavLoader: Only PCM format is supported (found format: {0})", fmtChunk->AudioFormat);
-                    return false;
-                }
-
-                outData.Channels = fmtChunk->NumChannels;
-                outData.SampleRate = fmtChunk->SampleRate;
-                outData.BitsPerSample = fmtChunk->BitsPerSample;
-
-                // Validate supported formats
-                if (outData.Channels != 1 && outData.Channels != 2)
-                {
-                    PIL_CORE_ERROR("WavLoader: Only mono and stereo are supported (found {0} channels)", outData.Channels);
+                if (!ParseFormat(fmtChunk->AudioFormat, fmtChunk->NumChannels, fmtChunk->SampleRate, fmtChunk->BitsPerSample, outData))
                     return false;
-                }
-
-                if (outData.BitsPerSample != 8 && outData.BitsPerSample != 16)
-                {
-                    PIL_CORE_ERROR("WavLoader: Only 8-bit and 16-bit samples are supported (found {0}-bit)", outData.BitsPerSample);
-                    return false;
-                }
 
                 foundFmt = true;
             }
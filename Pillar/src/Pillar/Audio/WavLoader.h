@@ -18,6 +18,23 @@ namespace Pillar {
         float Duration = 0.0f;      // Duration in seconds
     };
 
+    /**
+     * @brief Raw fmt fields of a WAV file and where its sample data lives.
+     * Filled for any codec, so decoders for compressed WAV formats can reuse the chunk walk.
+     */
+    struct WavLayout
+    {
+        uint16_t AudioFormat = 0;   // 1 = PCM, 0x11 = IMA-ADPCM
+        uint16_t Channels = 0;
+        uint32_t SampleRate = 0;
+        uint16_t BlockAlign = 0;
+        uint16_t BitsPerSample = 0;
+        uint16_t SamplesPerBlock = 0;   // From the fmt extension (compressed formats only)
+        uint32_t FactFrames = 0;        // Frame count from the fact chunk, 0 if absent
+        size_t DataOffset = 0;
+        size_t DataSize = 0;
+    };
+
     /**
      * @brief Utility class for loading WAV audio files.
      * 
@@ -46,6 +63,25 @@ namespace Pillar {
          */
         static bool LoadFromMemory(const char* data, size_t size, WavData& outData);
 
+        /**
+         * @brief Read a WAV file's format and locate its sample data without loading it.
+         * Used for streaming playback; outFormat.Data is left empty.
+         * @param filepath Path to the WAV file.
+         * @param outFormat Output format (SampleRate, Channels, BitsPerSample, Duration).
+         * @param dataOffset Output byte offset of the first sample in the file.
+         * @param dataSize Output size of the sample data in bytes.
+         * @return true if the header is a supported PCM WAV, false otherwise.
+         */
+        static bool ReadHeader(const std::string& filepath, WavData& outFormat, size_t& dataOffset, size_t& dataSize);
+
+        /**
+         * @brief Walk a WAV file's chunks without checking the codec.
+         * @param filepath Path to the WAV file.
+         * @param outLayout Output fmt fields and data chunk location.
+         * @return true if both the fmt and data chunks were found, false otherwise.
+         */
+        static bool ReadLayout(const std::string& filepath, WavLayout& outLayout);
+
     private:
         // WAV file format structures
         #pragma pack(push, 1)
@@ -76,6 +112,7 @@ namespace Pillar {
         #pragma pack(pop)
 
         static bool ParseHeader(const char* data, size_t size, WavData& outData, size_t& dataOffset, size_t& dataSize);
+        static bool ParseFormat(uint16_t audioFormat, uint16_t channels, uint32_t sampleRate, uint16_t bitsPerSample, WavData& outData);
     };
 
 }
@@ -17,6 +17,7 @@
 #include "Components/Rendering/AnimationComponent.h"
 #include "Components/Audio/AudioSourceComponent.h"
 #include "Components/Audio/AudioListenerComponent.h"
+#include "Pillar/Utils/AssetManager.h"
 #include <box2d/box2d.h>
 
 namespace Pillar {
@@ -324,6 +325,7 @@ namespace Pillar {
 					{ "damage", b.Damage },
 					{ "lifetime", b.Lifetime },
 					{ "timeAlive", b.TimeAlive },
+					{ "radius", b.Radius },
 					{ "pierce", b.Pierce },
 					{ "maxHits", b.MaxHits },
 					{ "hitsRemaining", b.HitsRemaining }
@@ -338,6 +340,8 @@ namespace Pillar {
 					b.Lifetime = j["lifetime"].get<float>();
 				if (j.contains("timeAlive"))
 					b.TimeAlive = j["timeAlive"].get<float>();
+				if (j.contains("radius"))
+					b.Radius = j["radius"].get<float>();
 				if (j.contains("pierce"))
 					b.Pierce = j["pierce"].get<bool>();
 				if (j.contains("maxHits"))
@@ -352,6 +356,7 @@ namespace Pillar {
 				auto& d = dst.AddComponent<BulletComponent>(Entity(), s.Damage);
 				d.Lifetime = s.Lifetime;
 				d.TimeAlive = s.TimeAlive;
+				d.Radius = s.Radius;
 				d.Pierce = s.Pierce;
 				d.MaxHits = s.MaxHits;
 				d.HitsRemaining = s.HitsRemaining;
@@ -389,19 +394,10 @@ namespace Pillar {
 				if (j.contains("texturePath"))
 				{
 					s.TexturePath = j["texturePath"].get<std::string>();
-					// Try to load texture if path is not empty
-					if (!s.TexturePath.empty())
-					{
-						try
-						{
-							s.Texture = Texture2D::Create(s.TexturePath);
-						}
-						catch (const std::exception& e)
-						{
-							PIL_CORE_WARN("Failed to load texture '{}' for sprite: {}", s.TexturePath, e.what());
-							s.Texture = nullptr;
-						}
-					}
+					// Load in the background (shows the missing texture until uploaded);
+					// async scene loads upload it later on the main thread
+					if (!s.TexturePath.empty() && !ComponentRegistry::IsDeferringResourceLoads())
+						s.Texture = AssetManager::LoadTextureAsync(s.TexturePath);
 				}
 				if (j.contains("color"))
 					s.Color = JsonHelpers::DeserializeVec4(j["color"]);
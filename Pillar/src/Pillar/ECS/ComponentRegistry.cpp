@@ -2,6 +2,10 @@
 
 namespace Pillar {
 
+	namespace {
+		thread_local bool t_DeferResourceLoads = false;
+	}
+
 	ComponentRegistry& ComponentRegistry::Get()
 	{
 		static ComponentRegistry instance;
@@ -17,4 +21,73 @@ namespace Pillar {
 		}
 	}
 
+	void ComponentRegistry::CopyComponents(Entity src, Entity dst) const
+	{
+		auto& registry = src.GetScene()->GetRegistry();
+		for (const ComponentRegistration* registration : m_Table)
+		{
+			if (registration->Copy && registration->Has(registry, src))
+				registration->Copy(src, dst);
+		}
+	}
+
+	void ComponentRegistry::CopyAllComponents(Scene& src, Scene& dst, const std::vector<entt::entity>& entityMap) const
+	{
+		auto& srcRegistry = src.GetRegistry();
+		for (const ComponentRegistration* registration : m_Table)
+		{
+			if (!registration->Copy)
+				continue;
+
+			for (entt::entity entity : registration->Storage(srcRegistry))
+			{
+				if (entity == entt::tombstone)
+					continue;
+				const auto index = static_cast<size_t>(entt::to_entity(entity));
+				if (index >= entityMap.size() || entityMap[index] == entt::null)
+					continue;
+				registration->Copy(Entity(entity, &src), Entity(entityMap[index], &dst));
+			}
+		}
+	}
+
+	void ComponentRegistry::SerializeAllComponents(Scene& scene, const std::vector<uint32_t>& entityIndex, std::vector<json>& outEntities) const
+	{
+		auto& registry = scene.GetRegistry();
+		for (const ComponentRegistration* registration : m_Table)
+		{
+			if (!registration->Serialize)
+				continue;
+
+			for (entt::entity entity : registration->Storage(registry))
+			{
+				if (entity == entt::tombstone)
+					continue;
+				const auto index = static_cast<size_t>(entt::to_entity(entity));
+				if (index >= entityIndex.size() || entityIndex[index] == UINT32_MAX)
+					continue;
+
+				json componentJson = registration->Serialize(Entity(entity, &scene));
+				if (!componentJson.is_null())
+					outEntities[entityIndex[index]][registration->Name] = std::move(componentJson);
+			}
+		}
+	}
+
+	bool ComponentRegistry::IsDeferringResourceLoads()
+	{
+		return t_DeferResourceLoads;
+	}
+
+	ComponentRegistry::DeferResourceLoadsScope::DeferResourceLoadsScope()
+		: m_Previous(t_DeferResourceLoads)
+	{
+		t_DeferResourceLoads = true;
+	}
+
+	ComponentRegistry::DeferResourceLoadsScope::~DeferResourceLoadsScope()
+	{
+		t_DeferResourceLoads = m_Previous;
+	}
+
 } // namespace Pillar
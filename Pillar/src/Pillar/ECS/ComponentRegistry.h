@@ -3,10 +3,13 @@
 #include "Pillar/Core.h"
 #include "Entity.h"
 #include <nlohmann/json.hpp>
+#include <entt/entt.hpp>
+#include <cstdint>
 #include <functional>
 #include <unordered_map>
 #include <string>
 #include <typeindex>
+#include <vector>
 
 namespace Pillar {
 
@@ -32,6 +35,15 @@ namespace Pillar {
 		ComponentSerializeFunc Serialize;       // Serialize to JSON
 		ComponentDeserializeFunc Deserialize;   // Deserialize from JSON
 		ComponentCopyFunc Copy;                 // Copy between entities
+
+		uint32_t Id = 0;                        // Dense index into ComponentRegistry::GetRegistrationTable()
+		entt::sparse_set& (*Storage)(entt::registry&) = nullptr;   // The component's EnTT storage, set by Register<T>
+
+		// Typed presence check; avoids calling into the type-erased functions for absent components
+		bool Has(entt::registry& registry, entt::entity entity) const
+		{
+			return Storage(registry).contains(entity);
+		}
 	};
 
 	/**
@@ -110,8 +122,16 @@ namespace Pillar {
 			reg.Serialize = std::move(serialize);
 			reg.Deserialize = std::move(deserialize);
 			reg.Copy = std::move(copy);
+			reg.Storage = [](entt::registry& registry) -> entt::sparse_set& { return registry.storage<T>(); };
+
+			// Map nodes are stable, so the table can point into m_Registrations.
+			// Re-registering a key keeps its id.
+			auto [it, inserted] = m_Registrations.try_emplace(jsonKey);
+			reg.Id = inserted ? static_cast<uint32_t>(m_Table.size()) : it->second.Id;
+			it->second = std::move(reg);
+			if (inserted)
+				m_Table.push_back(&it->second);
 
-			m_Registrations[jsonKey] = std::move(reg);
 			m_TypeToKey[std::type_index(typeid(T))] = jsonKey;
 		}
 
@@ -123,6 +143,22 @@ namespace Pillar {
 			return m_Registrations;
 		}
 
+		/**
+		 * @brief All registrations indexed by id, in registration order
+		 *
+		 * Prefer this over GetRegistrations() for iteration: it is dense and its
+		 * order is deterministic, so every loader applies components in the same order.
+		 */
+		const std::vector<const ComponentRegistration*>& GetRegistrationTable() const
+		{
+			return m_Table;
+		}
+
+		const ComponentRegistration* GetRegistrationById(uint32_t id) const
+		{
+			return id < m_Table.size() ? m_Table[id] : nullptr;
+		}
+
 		/**
 		 * @brief Get registration by JSON key
 		 */
@@ -161,6 +197,55 @@ namespace Pillar {
 		 */
 		size_t GetRegistrationCount() const { return m_Registrations.size(); }
 
+		// ------------------------------------------------------------------
+		// Bulk operations. Each walks one component type's EnTT storage at a
+		// time, so per-component functions only run for entities that have it.
+		// ------------------------------------------------------------------
+
+		/**
+		 * @brief Copy every registered component src has onto dst
+		 */
+		void CopyComponents(Entity src, Entity dst) const;
+
+		/**
+		 * @brief Copy all registered components of a scene into another
+		 * @param entityMap Destination entity for each source entity, indexed by
+		 *        entt::to_entity(source); entt::null or out of range skips the entity
+		 */
+		void CopyAllComponents(Scene& src, Scene& dst, const std::vector<entt::entity>& entityMap) const;
+
+		/**
+		 * @brief Serialize all registered components of a scene
+		 * @param entityIndex Index into outEntities for each entity, indexed by
+		 *        entt::to_entity(entity); UINT32_MAX or out of range skips the entity
+		 * @param outEntities Entity objects; each component is stored under its key
+		 */
+		void SerializeAllComponents(Scene& scene, const std::vector<uint32_t>& entityIndex, std::vector<json>& outEntities) const;
+
+		/**
+		 * @brief Whether Deserialize functions on this thread must skip GPU/audio resource creation
+		 *
+		 * Set while a scene is built off the main thread (SceneManager::LoadSceneAsync).
+		 * Deserializers keep the asset path and leave the resource handle empty; the
+		 * loader creates the resources on the main thread afterwards.
+		 */
+		static bool IsDeferringResourceLoads();
+
+		/**
+		 * @brief RAII scope that defers resource loads on the current thread
+		 */
+		class PIL_API DeferResourceLoadsScope
+		{
+		public:
+			DeferResourceLoadsScope();
+			~DeferResourceLoadsScope();
+			DeferResourceLoadsScope(const DeferResourceLoadsScope&) = delete;
+			DeferResourceLoadsScope& operator=(const DeferResourceLoadsScope&) = delete;
+
+		private:
+			bool m_Previous;
+		};
+
 	private:
 		ComponentRegistry() = default;
 		~ComponentRegistry() = default;
@@ -168,6 +253,7 @@ namespace Pillar {
 		ComponentRegistry& operator=(const ComponentRegistry&) = delete;
 
 		std::unordered_map<std::string, ComponentRegistration> m_Registrations;
+		std::vector<const ComponentRegistration*> m_Table;
 		std::unordered_map<std::type_index, std::string> m_TypeToKey;
 		bool m_BuiltinsRegistered = false;
 	};
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Pillar/Audio/AudioSource.h"
+#include "Pillar/Audio/AudioBuffer.h"
+#include <glm/glm.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -12,10 +15,24 @@ namespace Pillar {
      * Allows entities to emit sounds in 2D or 3D space.
      * The AudioSystem will automatically update the source position
      * based on the entity's TransformComponent.
+     *
+     * Property changes reach the source only when flagged dirty, so use the
+     * setters (or MarkDirty() after writing fields directly) once the source
+     * exists. Positions are pushed only when the transform has moved.
      */
     struct AudioSourceComponent
     {
+        enum DirtyFlags : uint8_t
+        {
+            DirtyVolume      = 1 << 0,
+            DirtyPitch       = 1 << 1,
+            DirtyLoop        = 1 << 2,
+            DirtyAttenuation = 1 << 3,  // MinDistance, MaxDistance, RolloffFactor
+            DirtyAll         = DirtyVolume | DirtyPitch | DirtyLoop | DirtyAttenuation
+        };
+
         std::shared_ptr<AudioSource> Source;
+        std::shared_ptr<AudioBuffer> Buffer;    // Preloaded buffer (async scene loads); AudioSystem loads AudioFile if null
         std::string AudioFile;          // Path to audio file
         float Volume = 1.0f;
         float Pitch = 1.0f;
@@ -25,13 +42,19 @@ namespace Pillar {
         float MinDistance = 1.0f;       // Distance at which attenuation starts
         float MaxDistance = 100.0f;     // Distance at which sound is silent
         float RolloffFactor = 1.0f;     // How quickly sound fades
+
+        // Change tracking, consumed by AudioSystem
+        uint8_t Dirty = DirtyAll;
+        bool HasAppliedPosition = false;
+        glm::vec2 AppliedPosition = { 0.0f, 0.0f };    // Last position pushed to the source
         
         AudioSourceComponent() = default;
         AudioSourceComponent(const std::string& file) 
             : AudioFile(file) {}
         
         AudioSourceComponent(const AudioSourceComponent& other)
-            : AudioFile(other.AudioFile),
+            : Buffer(other.Buffer),
+              AudioFile(other.AudioFile),
               Volume(other.Volume),
               Pitch(other.Pitch),
               Loop(other.Loop),
@@ -39,7 +62,8 @@ namespace Pillar {
               Is3D(other.Is3D),
               MinDistance(other.MinDistance),
               MaxDistance(other.MaxDistance),
-              RolloffFactor(other.RolloffFactor)
+              RolloffFactor(other.RolloffFactor),
+              Dirty(DirtyAll)
         {
             // Note: Source is not copied, will be recreated by AudioSystem
         }
@@ -48,6 +72,7 @@ namespace Pillar {
         {
             if (this != &other)
             {
+                Buffer = other.Buffer;
                 AudioFile = other.AudioFile;
                 Volume = other.Volume;
                 Pitch = other.Pitch;
@@ -57,10 +82,28 @@ namespace Pillar {
                 MinDistance = other.MinDistance;
                 MaxDistance = other.MaxDistance;
                 RolloffFactor = other.RolloffFactor;
-                // Note: Source is not copied
+                // Note: Source is not copied; this one gets every property re-applied
+                Dirty = DirtyAll;
+                HasAppliedPosition = false;
             }
             return *this;
         }
+
+        void SetVolume(float volume) { Volume = volume; Dirty |= DirtyVolume; }
+        void SetPitch(float pitch) { Pitch = pitch; Dirty |= DirtyPitch; }
+        void SetLooping(bool loop) { Loop = loop; Dirty |= DirtyLoop; }
+        void SetMinDistance(float distance) { MinDistance = distance; Dirty |= DirtyAttenuation; }
+        void SetMaxDistance(float distance) { MaxDistance = distance; Dirty |= DirtyAttenuation; }
+        void SetRolloffFactor(float factor) { RolloffFactor = factor; Dirty |= DirtyAttenuation; }
+
+        void SetIs3D(bool is3D)
+        {
+            Is3D = is3D;
+            Dirty |= DirtyAttenuation;
+            HasAppliedPosition = false;
+        }
+
+        void MarkDirty(uint8_t flags = DirtyAll) { Dirty |= flags; }
     };
 
 } // namespace Pillar
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <entt/entt.hpp>
 
 namespace Pillar {
 
@@ -10,7 +11,19 @@ namespace Pillar {
 	struct HierarchyComponent
 	{
 		uint64_t ParentUUID = 0;
-		
+
+		// Runtime links, rebuilt by TransformHierarchySystem whenever ParentUUID
+		// changes (not serialized). Children of one parent form a singly linked
+		// sibling list starting at the parent's FirstChild.
+		entt::entity Parent = entt::null;
+		entt::entity FirstChild = entt::null;
+		entt::entity NextSibling = entt::null;
+		uint32_t Depth = 0;
+
+		// ParentUUID the links above were built for; a mismatch marks the
+		// hierarchy for relinking
+		uint64_t LinkedParentUUID = UINT64_MAX;
+
 		HierarchyComponent() = default;
 		HierarchyComponent(const HierarchyComponent&) = default;
 		HierarchyComponent(uint64_t parent)
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace Pillar {
+
+	/**
+	 * @brief Marks an entity parked in a TypedPool
+	 *
+	 * Pooled entities keep their components so they can be reused without
+	 * allocation. Hot-path systems exclude this tag from their views
+	 * (entt::exclude<InactiveTag>) so parked entities are never updated or drawn.
+	 */
+	struct InactiveTag {};
+
+} // namespace Pillar
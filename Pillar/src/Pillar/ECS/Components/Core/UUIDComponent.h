@@ -20,9 +20,9 @@ namespace Pillar {
 	private:
 		static uint64_t GenerateUUID()
 		{
-			static std::random_device rd;
-			static std::mt19937_64 gen(rd());
-			static std::uniform_int_distribution<uint64_t> dis;
+			// Per thread, so scenes can be built on a loader thread (SceneManager::LoadSceneAsync)
+			static thread_local std::mt19937_64 gen(std::random_device{}());
+			static thread_local std::uniform_int_distribution<uint64_t> dis;
 			return dis(gen);
 		}
 	};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Pillar {
+
+	/**
+	 * @brief World-space transform of an entity in a parent/child hierarchy
+	 *
+	 * Added and kept up to date by TransformHierarchySystem for every entity with
+	 * a HierarchyComponent (and for the parents they hang from). Runtime only -
+	 * it is derived from TransformComponent and never serialized.
+	 *
+	 * Position/Rotation/Scale are the decomposed world values used by 2D
+	 * renderers; Rotation adds up along the chain and Scale multiplies, which is
+	 * exact unless a rotated parent has non-uniform scale. Matrix is always exact.
+	 */
+	struct WorldTransformComponent
+	{
+		glm::mat4 Matrix = glm::mat4(1.0f);
+		glm::vec2 Position = { 0.0f, 0.0f };
+		float Rotation = 0.0f;      // Radians
+		glm::vec2 Scale = { 1.0f, 1.0f };
+
+		// Local TRS the world values were last computed from (change detection)
+		glm::vec2 LocalPosition = { 0.0f, 0.0f };
+		float LocalRotation = 0.0f;
+		glm::vec2 LocalScale = { 1.0f, 1.0f };
+
+		// Forces a recompute of this entity and its subtree on the next update
+		bool NeedsUpdate = true;
+
+		WorldTransformComponent() = default;
+		WorldTransformComponent(const WorldTransformComponent&) = default;
+	};
+
+} // namespace Pillar
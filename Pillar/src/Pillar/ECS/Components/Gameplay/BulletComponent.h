@@ -11,6 +11,7 @@ namespace Pillar {
 		float Damage = 10.0f;
 		float Lifetime = 5.0f;      // Auto-destroy after this many seconds
 		float TimeAlive = 0.0f;
+		float Radius = 0.0f;        // Swept-circle radius for hit tests (0 = thin ray)
 
 		bool Pierce = false;        // Penetrate through enemies
 		uint32_t MaxHits = 1;       // How many targets to hit before destruction
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace Pillar {
@@ -17,6 +20,81 @@ namespace Pillar {
 		Bounce       // Bouncing effect
 	};
 
+	/// Number of entries in a baked gradient/curve lookup table
+	constexpr uint32_t kParticleLUTSize = 256;
+
+	/**
+	 * @brief Fixed-size lookup table sampled uniformly over normalized time (0-1)
+	 *
+	 * Baked once from a ColorGradient or AnimationCurve and shared by every
+	 * particle that points at that gradient/curve. A sample is a clamp, one
+	 * multiply and a lerp between two neighbouring entries - no stop search
+	 * and no branching on the curve type.
+	 */
+	template<typename T>
+	struct ParticleLUT
+	{
+		static constexpr uint32_t kLanes = 8; // Particles processed per SampleBatch step
+
+		std::array<T, kParticleLUTSize> Samples{};
+
+		// Fill the table by evaluating fn at evenly spaced times in [0, 1]
+		template<typename Fn>
+		void Bake(Fn&& fn)
+		{
+			for (uint32_t i = 0; i < kParticleLUTSize; ++i)
+				Samples[i] = fn(static_cast<float>(i) / static_cast<float>(kParticleLUTSize - 1));
+		}
+
+		// Sample the table at normalized time t (clamped to 0-1)
+		T Sample(float t) const
+		{
+			uint32_t index;
+			float frac;
+			ToIndex(t, index, frac);
+			return Samples[index] + (Samples[index + 1] - Samples[index]) * frac;
+		}
+
+		/**
+		 * @brief Sample count times in lanes of kLanes particles at once
+		 * @param t Contiguous normalized times
+		 * @param out Contiguous output values (same length as t)
+		 *
+		 * Index/fraction computation and the lerp are split into separate
+		 * fixed-width loops so the compiler can vectorize each of them.
+		 */
+		void SampleBatch(const float* t, T* out, size_t count) const
+		{
+			size_t i = 0;
+			for (; i + kLanes <= count; i += kLanes)
+			{
+				uint32_t index[kLanes];
+				float frac[kLanes];
+				for (uint32_t lane = 0; lane < kLanes; ++lane)
+					ToIndex(t[i + lane], index[lane], frac[lane]);
+
+				for (uint32_t lane = 0; lane < kLanes; ++lane)
+				{
+					const T& a = Samples[index[lane]];
+					const T& b = Samples[index[lane] + 1];
+					out[i + lane] = a + (b - a) * frac[lane];
+				}
+			}
+
+			// Remainder that does not fill a whole lane group
+			for (; i < count; ++i)
+				out[i] = Sample(t[i]);
+		}
+
+	private:
+		static void ToIndex(float t, uint32_t& index, float& frac)
+		{
+			const float x = glm::clamp(t, 0.0f, 1.0f) * static_cast<float>(kParticleLUTSize - 1);
+			index = glm::min(static_cast<uint32_t>(x), kParticleLUTSize - 2);
+			frac = x - static_cast<float>(index);
+		}
+	};
+
 	/**
 	 * @brief Color gradient for smooth color transitions
 	 * 
@@ -79,6 +157,47 @@ namespace Pillar {
 		{
 			return Stops.size() >= 2;
 		}
+
+		/**
+		 * @brief Bake Stops into the lookup table used by Sample/SampleBatch
+		 *
+		 * ParticleSystem bakes lazily the first time it sees a gradient.
+		 * Editing Stops after baking invalidates the table; Sample detects
+		 * this and falls back to Evaluate until re-baked.
+		 */
+		void Bake()
+		{
+			m_LUT.Bake([this](float t) { return Evaluate(t); });
+			m_BakedStops = Stops;
+			m_Baked = true;
+		}
+
+		bool IsBaked() const
+		{
+			if (!m_Baked || m_BakedStops.size() != Stops.size())
+				return false;
+
+			for (size_t i = 0; i < Stops.size(); ++i)
+			{
+				if (m_BakedStops[i].Time != Stops[i].Time || m_BakedStops[i].Color != Stops[i].Color)
+					return false;
+			}
+			return true;
+		}
+
+		// Fast evaluation from the baked table (falls back to Evaluate if stale)
+		glm::vec4 Sample(float t) const
+		{
+			return IsBaked() ? m_LUT.Sample(t) : Evaluate(t);
+		}
+
+		// Baked lookup table (valid once IsBaked() is true)
+		const ParticleLUT<glm::vec4>& GetLUT() const { return m_LUT; }
+
+	private:
+		ParticleLUT<glm::vec4> m_LUT;
+		std::vector<ColorStop> m_BakedStops;
+		bool m_Baked = false;
 	};
 
 	/**
@@ -130,6 +249,40 @@ namespace Pillar {
 				return t;
 			}
 		}
+
+		/**
+		 * @brief Bake the curve into a lookup table used by Sample
+		 *
+		 * Changing Type or Strength after baking invalidates the table;
+		 * Sample detects this and falls back to Evaluate until re-baked.
+		 */
+		void Bake()
+		{
+			m_LUT.Bake([this](float t) { return Evaluate(t); });
+			m_BakedType = Type;
+			m_BakedStrength = Strength;
+			m_Baked = true;
+		}
+
+		bool IsBaked() const
+		{
+			return m_Baked && m_BakedType == Type && m_BakedStrength == Strength;
+		}
+
+		// Fast evaluation from the baked table (falls back to Evaluate if stale)
+		float Sample(float t) const
+		{
+			return IsBaked() ? m_LUT.Sample(t) : Evaluate(t);
+		}
+
+		// Baked lookup table (valid once IsBaked() is true)
+		const ParticleLUT<float>& GetLUT() const { return m_LUT; }
+
+	private:
+		ParticleLUT<float> m_LUT;
+		CurveType m_BakedType = CurveType::Linear;
+		float m_BakedStrength = 1.0f;
+		bool m_Baked = false;
 	};
 
 } // namespace Pillar
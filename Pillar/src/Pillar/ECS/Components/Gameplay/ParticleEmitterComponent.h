@@ -1,6 +1,7 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <string>
 
 namespace Pillar {
@@ -41,6 +42,7 @@ namespace Pillar {
 		bool BurstMode = false;                // One-shot emission?
 		int BurstCount = 100;                  // Particles in burst
 		bool BurstFired = false;               // Has burst been triggered?
+		uint32_t SpawnSequence = 0;            // Internal batch counter (seeds the emitter's random stream)
 
 		// === Emission Shape ===
 		EmissionShape Shape = EmissionShape::Point;
@@ -1,11 +1,18 @@
 #pragma once
 
 #include <entt/entt.hpp>
+#include <cstdint>
 #include <string>
 #include <functional>
 
 namespace Pillar {
 
+	/**
+	 * @brief Index of a clip compiled by AnimationSystem (see AnimationSystem::GetClipHandle)
+	 */
+	using AnimationClipHandle = uint32_t;
+	constexpr AnimationClipHandle InvalidAnimationClip = UINT32_MAX;
+
 	/**
 	 * @brief Component for controlling animation playback on entities
 	 * 
@@ -37,6 +44,13 @@ namespace Pillar {
 	EventCallback OnAnimationEvent;      // Callback for animation events
 	CompletionCallback OnAnimationComplete;  // Callback when animation finishes (non-looping only)
 
+	// Runtime cache owned by AnimationSystem: CurrentClipName resolved to a handle
+	// against a given library generation, and the frame last written to the sprite.
+	// Assign clips through Play()/SetClip() so the cache is refreshed.
+	AnimationClipHandle ClipHandle = InvalidAnimationClip;
+	uint32_t ClipGeneration = 0;         // 0 = not resolved yet
+	int AppliedFrame = -1;               // -1 = sprite not written yet
+
 	AnimationComponent() = default;
 	AnimationComponent(const AnimationComponent&) = default;
 
@@ -49,13 +63,24 @@ namespace Pillar {
 		{
 			if (CurrentClipName != clipName || restart)
 			{
-				CurrentClipName = clipName;
+				SetClip(clipName);
 				FrameIndex = 0;
 				PlaybackTime = 0.0f;
 				Playing = true;
 			}
 		}
 
+		/**
+		 * @brief Switch the clip without touching the playback state (editor, tools)
+		 */
+		void SetClip(const std::string& clipName)
+		{
+			CurrentClipName = clipName;
+			ClipHandle = InvalidAnimationClip;
+			ClipGeneration = 0;
+			AppliedFrame = -1;
+		}
+
 		/**
 		 * @brief Pause the current animation
 		 */
@@ -2,6 +2,7 @@
 
 #include "Pillar/Core.h"
 #include "Scene.h"
+#include "SceneSnapshot.h"
 #include "Pillar/Logger.h"
 #include "Components/Core/UUIDComponent.h"
 #include "Components/Core/TagComponent.h"
@@ -25,6 +26,7 @@ namespace Pillar {
 		T& AddComponent(Args&&... args)
 		{
 			PIL_CORE_ASSERT(!HasComponent<T>(), "Entity already has component!");
+			SceneSnapshot::RegisterComponentType<T>();
 			return m_Scene->m_Registry.emplace<T>(m_EntityHandle, std::forward<Args>(args)...);
 		}
 
@@ -77,6 +79,7 @@ namespace Pillar {
 		template<typename T, typename... Args>
 		T& AddOrReplaceComponent(Args&&... args)
 		{
+			SceneSnapshot::RegisterComponentType<T>();
 			return m_Scene->m_Registry.emplace_or_replace<T>(m_EntityHandle, std::forward<Args>(args)...);
 		}
 
@@ -97,9 +100,12 @@ namespace Pillar {
 
 		uint64_t UUID() const { return GetUUID(); }
 
-		std::string& Name() { return GetComponent<TagComponent>().Tag; }
 		const std::string& Name() const { return GetComponent<TagComponent>().Tag; }
-		void SetName(const std::string& name) { GetComponent<TagComponent>().Tag = name; }
+		// Patches the tag so Scene's name index follows the rename
+		void SetName(const std::string& name)
+		{
+			m_Scene->m_Registry.patch<TagComponent>(m_EntityHandle, [&name](TagComponent& tag) { tag.Tag = name; });
+		}
 
 		Scene* GetScene() const { return m_Scene; }
 
@@ -1,6 +1,7 @@
 #include "ObjectPool.h"
 #include "Scene.h"
 #include "Pillar/Logger.h"
+#include <algorithm>
 
 namespace Pillar {
 
@@ -44,6 +45,33 @@ Entity ObjectPool::Acquire()
 	return entity;
 }
 
+void ObjectPool::AcquireBatch(uint32_t count, std::vector<Entity>& outEntities)
+{
+	PIL_CORE_ASSERT(m_Scene, "ObjectPool not initialized! Call Init() first.");
+
+	if (count == 0)
+		return;
+
+	outEntities.reserve(outEntities.size() + count);
+
+	// Take a contiguous block from the back of the free list
+	const size_t fromPool = std::min<size_t>(count, m_AvailableEntities.size());
+	outEntities.insert(outEntities.end(), m_AvailableEntities.end() - fromPool, m_AvailableEntities.end());
+	m_AvailableEntities.resize(m_AvailableEntities.size() - fromPool);
+
+	// Pool exhausted - create the rest in one go
+	const uint32_t toCreate = count - static_cast<uint32_t>(fromPool);
+	for (uint32_t i = 0; i < toCreate; i++)
+		outEntities.push_back(CreateEntity());
+
+	if (toCreate > 0)
+	{
+		PIL_CORE_WARN("ObjectPool: Pool exhausted, created {0} new entities (total: {1})", toCreate, m_TotalEntities);
+	}
+
+	PIL_CORE_TRACE("ObjectPool: Acquired batch of {0} entities (available: {1})", count, m_AvailableEntities.size());
+}
+
 void ObjectPool::Release(Entity entity)
 {
 	PIL_CORE_ASSERT(m_Scene, "ObjectPool not initialized!");
@@ -25,6 +25,9 @@ namespace Pillar {
  * // When done, return to pool
  * bulletPool.Release(bullet);
  * @endcode
+ *
+ * @note Pooled entities stay visible to every view. For hot entity types prefer
+ *       TypedPool, which parks released entities under InactiveTag.
  */
 class PIL_API ObjectPool
 {
@@ -45,6 +48,17 @@ public:
 	 */
 	Entity Acquire();
 
+	/**
+	 * @brief Get several entities from the pool in one call
+	 * @param count Number of entities to acquire
+	 * @param outEntities Acquired entities are appended here
+	 *
+	 * Takes as many entities as possible from the free list in one block and
+	 * creates the remainder (if the pool runs dry) together, logging once per
+	 * batch instead of once per entity.
+	 */
+	void AcquireBatch(uint32_t count, std::vector<Entity>& outEntities);
+
 	/**
 	 * @brief Return an entity to the pool for reuse
 	 * @param entity The entity to return to the pool
@@ -108,11 +108,14 @@ namespace {
 			if (entity.HasComponent<Pillar::TagComponent>())
 				entityJson["tag"] = entity.GetComponent<Pillar::TagComponent>().Tag;
 
-			for (const auto& [key, registration] : registry.GetRegistrations())
+			for (const Pillar::ComponentRegistration* registration : registry.GetRegistrationTable())
 			{
-				json componentJson = registration.Serialize(entity);
+				if (!registration->Has(entity.GetScene()->GetRegistry(), entity))
+					continue;
+
+				json componentJson = registration->Serialize(entity);
 				if (!componentJson.is_null())
-					entityJson[key] = componentJson;
+					entityJson[registration->Name] = componentJson;
 			}
 
 			entitiesJson.push_back(entityJson);
@@ -169,11 +172,12 @@ namespace {
 			const auto& entityJson = prefabJson["entities"][i];
 			Pillar::Entity entity = created[i];
 
-			for (const auto& [key, registration] : registry.GetRegistrations())
+			for (const Pillar::ComponentRegistration* registration : registry.GetRegistrationTable())
 			{
-				if (entityJson.contains(key))
+				auto it = entityJson.find(registration->Name);
+				if (it != entityJson.end())
 				{
-					registration.Deserialize(entity, entityJson[key]);
+					registration->Deserialize(entity, *it);
 				}
 			}
 		}
@@ -1,6 +1,7 @@
 #include "Scene.h"
 #include "Entity.h"
 #include "ComponentRegistry.h"
+#include "SceneSnapshot.h"
 #include "Components/Core/TagComponent.h"
 #include "Components/Core/TransformComponent.h"
 #include "Components/Core/UUIDComponent.h"
@@ -15,6 +16,14 @@ namespace Pillar {
 	{
 		// Register cleanup callback for RigidbodyComponent
 		m_Registry.on_destroy<RigidbodyComponent>().connect<&Scene::OnRigidbodyDestroyed>(this);
+
+		// Keep the UUID and name lookup indices in sync
+		m_Registry.on_construct<UUIDComponent>().connect<&Scene::OnUUIDAdded>(this);
+		m_Registry.on_update<UUIDComponent>().connect<&Scene::OnUUIDAdded>(this);
+		m_Registry.on_destroy<UUIDComponent>().connect<&Scene::OnUUIDRemoved>(this);
+		m_Registry.on_construct<TagComponent>().connect<&Scene::OnTagAdded>(this);
+		m_Registry.on_update<TagComponent>().connect<&Scene::OnTagChanged>(this);
+		m_Registry.on_destroy<TagComponent>().connect<&Scene::OnTagRemoved>(this);
 		PIL_CORE_TRACE("Scene '{}' created", m_Name);
 	}
 
@@ -83,25 +92,21 @@ namespace Pillar {
 		Entity newEntity = CreateEntity(name + " (Copy)");
 
 		// Use ComponentRegistry to copy all registered components
-		auto& registry = ComponentRegistry::Get();
-		for (const auto& [key, registration] : registry.GetRegistrations())
-		{
-			if (registration.Copy)
-			{
-				registration.Copy(entity, newEntity);
-			}
-		}
+		ComponentRegistry::Get().CopyComponents(entity, newEntity);
 
 		return newEntity;
 	}
 
 	Entity Scene::FindEntityByName(const std::string& name)
 	{
-		auto view = m_Registry.view<TagComponent>();
-		for (auto entity : view)
+		auto it = m_EntitiesByName.find(name);
+		if (it == m_EntitiesByName.end())
+			return Entity();
+
+		// Skip entities renamed in place since they were indexed
+		for (entt::entity entity : it->second)
 		{
-			const auto& tag = view.get<TagComponent>(entity);
-			if (tag.Tag == name)
+			if (m_Registry.get<TagComponent>(entity).Tag == name)
 				return Entity(entity, this);
 		}
 		return Entity();
@@ -109,67 +114,50 @@ namespace Pillar {
 
 	Entity Scene::FindEntityByUUID(uint64_t uuid)
 	{
-		auto view = m_Registry.view<UUIDComponent>();
-		for (auto entity : view)
+		auto it = m_EntityByUUID.find(uuid);
+		if (it == m_EntityByUUID.end())
+			return Entity();
+
+		// on_update can't report the previous UUID, so a changed UUID leaves its
+		// old key behind; drop it when it is hit
+		if (m_Registry.get<UUIDComponent>(it->second).UUID != uuid)
 		{
-			const auto& uuidComp = view.get<UUIDComponent>(entity);
-			if (uuidComp.UUID == uuid)
-				return Entity(entity, this);
+			m_EntityByUUID.erase(it);
+			return Entity();
 		}
-		return Entity();
+		return Entity(it->second, this);
 	}
 
 	std::vector<Entity> Scene::GetAllEntities()
 	{
 		std::vector<Entity> entities;
+		GetAllEntities(entities);
+		return entities;
+	}
+
+	void Scene::GetAllEntities(std::vector<Entity>& outEntities)
+	{
+		outEntities.clear();
+		outEntities.reserve(GetEntityCount());
 		m_Registry.each([&](auto entityHandle) {
-			entities.emplace_back(entityHandle, this);
+			outEntities.emplace_back(entityHandle, this);
 		});
-		return entities;
 	}
 
 	size_t Scene::GetEntityCount() const
 	{
-		// Count alive entities by iterating
-		size_t count = 0;
-		auto view = m_Registry.view<entt::entity>();
-		for (auto entity : view)
-		{
-			if (m_Registry.valid(entity))
-				count++;
-		}
-		return count;
+		// The entity storage tracks how many of its slots are alive
+		return m_Registry.storage<entt::entity>()->in_use();
 	}
 
 	std::shared_ptr<Scene> Scene::Copy(const std::shared_ptr<Scene>& other)
 	{
-		// Ensure components are registered
-		ComponentRegistry::Get().EnsureBuiltinsRegistered();
-
 		auto newScene = std::make_shared<Scene>(other->m_Name);
+		newScene->m_RandomSeed = other->m_RandomSeed;
 
-		auto& srcRegistry = other->m_Registry;
-
-		// Copy all entities with their core components
-		auto view = srcRegistry.view<UUIDComponent, TagComponent>();
-		for (auto entityHandle : view)
-		{
-			auto& uuid = view.get<UUIDComponent>(entityHandle);
-			auto& tag = view.get<TagComponent>(entityHandle);
-			
-			Entity srcEntity(entityHandle, other.get());
-			Entity newEntity = newScene->CreateEntityWithUUID(uuid.UUID, tag.Tag);
-
-			// Use ComponentRegistry to copy all registered components
-			auto& compRegistry = ComponentRegistry::Get();
-			for (const auto& [key, registration] : compRegistry.GetRegistrations())
-			{
-				if (registration.Copy)
-				{
-					registration.Copy(srcEntity, newEntity);
-				}
-			}
-		}
+		// Storage-level copy: entities keep their identifiers and UUIDs, and the
+		// new scene's signals rebuild its lookup indices as components land
+		SceneSnapshot::CopyRegistry(other->m_Registry, newScene->m_Registry);
 
 		return newScene;
 	}
@@ -184,4 +172,64 @@ namespace Pillar {
 		}
 	}
 
+	void Scene::OnUUIDAdded(entt::registry& registry, entt::entity entity)
+	{
+		const uint64_t uuid = registry.get<UUIDComponent>(entity).UUID;
+		auto [it, inserted] = m_EntityByUUID.try_emplace(uuid, entity);
+		if (!inserted && it->second != entity)
+		{
+			if (registry.valid(it->second))
+				PIL_CORE_WARN("Scene '{}': duplicate UUID {}, lookups now resolve to the newer entity", m_Name, uuid);
+			it->second = entity;
+		}
+	}
+
+	void Scene::OnUUIDRemoved(entt::registry& registry, entt::entity entity)
+	{
+		auto it = m_EntityByUUID.find(registry.get<UUIDComponent>(entity).UUID);
+		if (it != m_EntityByUUID.end() && it->second == entity)
+			m_EntityByUUID.erase(it);
+	}
+
+	void Scene::OnTagAdded(entt::registry& registry, entt::entity entity)
+	{
+		const auto id = static_cast<size_t>(entt::to_entity(entity));
+		if (id >= m_NameSlots.size())
+			m_NameSlots.resize(id + 1);
+
+		auto& bucket = *m_EntitiesByName.try_emplace(registry.get<TagComponent>(entity).Tag).first;
+		m_NameSlots[id] = { &bucket, static_cast<uint32_t>(bucket.second.size()) };
+		bucket.second.push_back(entity);
+	}
+
+	void Scene::OnTagChanged(entt::registry& registry, entt::entity entity)
+	{
+		UnindexName(entity);
+		OnTagAdded(registry, entity);
+	}
+
+	void Scene::OnTagRemoved(entt::registry& registry, entt::entity entity)
+	{
+		UnindexName(entity);
+	}
+
+	void Scene::UnindexName(entt::entity entity)
+	{
+		const auto id = static_cast<size_t>(entt::to_entity(entity));
+		if (id >= m_NameSlots.size() || !m_NameSlots[id].Bucket)
+			return;
+
+		// Swap-remove from the bucket and patch the moved entity's slot
+		NameSlot& slot = m_NameSlots[id];
+		auto& entities = slot.Bucket->second;
+		const entt::entity moved = entities.back();
+		entities[slot.Index] = moved;
+		m_NameSlots[entt::to_entity(moved)].Index = slot.Index;
+		entities.pop_back();
+
+		if (entities.empty())
+			m_EntitiesByName.erase(slot.Bucket->first);
+		slot = NameSlot{};
+	}
+
 } // namespace Pillar
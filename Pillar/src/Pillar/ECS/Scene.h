@@ -4,6 +4,7 @@
 #include <entt/entt.hpp>
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace Pillar {
@@ -40,9 +41,13 @@ namespace Pillar {
 		Entity DuplicateEntity(Entity entity);
 
 		// Entity queries
+		// UUID and name lookups are O(1) hash lookups. The indices follow registry
+		// signals, so renames and UUID changes must go through Entity::SetName or
+		// registry.patch/replace to be seen (writing TagComponent::Tag in place is not).
 		Entity FindEntityByName(const std::string& name);
 		Entity FindEntityByUUID(uint64_t uuid);
 		std::vector<Entity> GetAllEntities();
+		void GetAllEntities(std::vector<Entity>& outEntities); // Reuses outEntities' capacity
 		size_t GetEntityCount() const;
 
 		// Entity iteration helpers
@@ -58,6 +63,10 @@ namespace Pillar {
 		const std::string& GetFilePath() const { return m_FilePath; }
 		void SetFilePath(const std::string& path) { m_FilePath = path; }
 		SceneState GetState() const { return m_State; }
+
+		// Base seed for deterministic per-entity random streams (see RandomStream::DeriveSeed)
+		uint64_t GetRandomSeed() const { return m_RandomSeed; }
+		void SetRandomSeed(uint64_t seed) { m_RandomSeed = seed; }
 		bool IsPlaying() const { return m_State == SceneState::Play; }
 		bool IsPaused() const { return m_State == SceneState::Paused; }
 
@@ -86,11 +95,35 @@ namespace Pillar {
 	private:
 		void OnRigidbodyDestroyed(entt::registry& registry, entt::entity entity);
 
+		// Lookup index maintenance (registry signals)
+		void OnUUIDAdded(entt::registry& registry, entt::entity entity);
+		void OnUUIDRemoved(entt::registry& registry, entt::entity entity);
+		void OnTagAdded(entt::registry& registry, entt::entity entity);
+		void OnTagChanged(entt::registry& registry, entt::entity entity);
+		void OnTagRemoved(entt::registry& registry, entt::entity entity);
+		void UnindexName(entt::entity entity);
+
+		using NameBucket = std::pair<const std::string, std::vector<entt::entity>>;
+
+		// Where an entity sits in the name index (map nodes are stable, so the
+		// bucket pointer survives rehashing)
+		struct NameSlot
+		{
+			NameBucket* Bucket = nullptr;
+			uint32_t Index = 0;
+		};
+
 	private:
+		// Declared before the registry so they outlive it during destruction
+		std::unordered_map<uint64_t, entt::entity> m_EntityByUUID;
+		std::unordered_map<std::string, std::vector<entt::entity>> m_EntitiesByName;
+		std::vector<NameSlot> m_NameSlots; // Indexed by entt::to_entity
+
 		entt::registry m_Registry;
 		std::string m_Name;
 		std::string m_FilePath;
 		SceneState m_State = SceneState::Edit;
+		uint64_t m_RandomSeed = 0;
 		PhysicsSystem* m_PhysicsSystem = nullptr;
 		AnimationSystem* m_AnimationSystem = nullptr;
 
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Chunked binary scene format (".pscene"), written by SceneSerializer::SerializeChunked.
+//
+// JSON stays the authoring format; this is the cooked runtime format. Data is
+// laid out per component type (SoA arrays plus an entity index array) so the
+// loader can read it straight out of a memory-mapped file and bulk-insert each
+// component type into its EnTT storage.
+//
+//   FileHeader
+//   scene name (NameSize bytes)                          padded to 8
+//   ChunkHeader + payload, ChunkCount times              each payload padded to 8
+//
+// Every array inside a payload starts on an 8-byte boundary, so arrays can be
+// read in place from the mapping. Entities are numbered 0..EntityCount-1 in file
+// order; chunks refer to them by that index. All values are little-endian.
+//
+// Chunks:
+//   UUID  Count = EntityCount   uint64 UUID[Count]                 (0 = generate)
+//   TAGS  Count = EntityCount   uint32 Offsets[Count + 1], char Data[]
+//   XFRM                        uint32 Entity[Count], float PositionX[], PositionY[],
+//                               Rotation[], ScaleX[], ScaleY[]
+//   HIER                        uint32 Entity[Count], uint64 ParentUUID[Count]
+//   VELO                        uint32 Entity[Count], float VelocityX[], VelocityY[],
+//                               AccelerationX[], AccelerationY[], Drag[], MaxSpeed[]
+//   SPRT                        uint32 Entity[Count], float Color[Count * 4], Size[Count * 2],
+//                               TexCoordMin[Count * 2], TexCoordMax[Count * 2], ZIndex[],
+//                               int32 OrderInLayer[], uint8 Flags[] (kSpriteFlag*),
+//                               uint32 PathOffsets[Count + 1], char PathData[],
+//                               uint32 LayerOffsets[Count + 1], char LayerData[]
+//   RGBD                        uint32 Entity[Count], uint8 BodyType[] (b2BodyType),
+//                               uint8 Flags[] (kRigidbodyFlag*), float GravityScale[],
+//                               LinearDamping[], AngularDamping[]
+//   COLL                        uint32 Entity[Count], uint8 Type[] (ColliderType),
+//                               uint8 Flags[] (kColliderFlag*), float OffsetX[], OffsetY[],
+//                               ShapeX[], ShapeY[], Density[], Friction[], Restitution[],
+//                               uint16 CategoryBits[], MaskBits[], int16 GroupIndex[],
+//                               uint32 VertexOffsets[Count + 1], float VertexX[], VertexY[]
+//         ShapeX is the radius for circles; (ShapeX, ShapeY) the half extents for boxes.
+//   CJSN  one per other registered component:
+//                               uint32 KeySize, char Key[KeySize], uint32 Entity[Count],
+//                               uint32 Offsets[Count + 1], uint8 MsgPack[]
+//         Each entity's component is the msgpack encoding of its ComponentRegistry
+//         JSON, so components without a native chunk still round-trip.
+//
+// Unknown chunk ids are skipped, so new native chunks can be added without
+// breaking older readers. Layout changes to existing chunks bump kFormatVersion.
+
+namespace Pillar::SceneChunks {
+
+	constexpr uint32_t MakeFourCC(char a, char b, char c, char d)
+	{
+		return static_cast<uint32_t>(static_cast<uint8_t>(a))
+			| (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8)
+			| (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16)
+			| (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+	}
+
+	constexpr uint32_t kMagic = MakeFourCC('P', 'S', 'C', 'N');
+	constexpr uint32_t kFormatVersion = 1;
+	constexpr size_t kAlignment = 8;
+
+	constexpr uint32_t kChunkUUID = MakeFourCC('U', 'U', 'I', 'D');
+	constexpr uint32_t kChunkTags = MakeFourCC('T', 'A', 'G', 'S');
+	constexpr uint32_t kChunkTransform = MakeFourCC('X', 'F', 'R', 'M');
+	constexpr uint32_t kChunkHierarchy = MakeFourCC('H', 'I', 'E', 'R');
+	constexpr uint32_t kChunkVelocity = MakeFourCC('V', 'E', 'L', 'O');
+	constexpr uint32_t kChunkSprite = MakeFourCC('S', 'P', 'R', 'T');
+	constexpr uint32_t kChunkRigidbody = MakeFourCC('R', 'G', 'B', 'D');
+	constexpr uint32_t kChunkCollider = MakeFourCC('C', 'O', 'L', 'L');
+	constexpr uint32_t kChunkComponentJson = MakeFourCC('C', 'J', 'S', 'N');
+
+	constexpr uint8_t kSpriteFlagLockUV = 1 << 0;
+	constexpr uint8_t kSpriteFlagFlipX = 1 << 1;
+	constexpr uint8_t kSpriteFlagFlipY = 1 << 2;
+	constexpr uint8_t kSpriteFlagVisible = 1 << 3;
+
+	constexpr uint8_t kRigidbodyFlagFixedRotation = 1 << 0;
+	constexpr uint8_t kRigidbodyFlagBullet = 1 << 1;
+	constexpr uint8_t kRigidbodyFlagEnabled = 1 << 2;
+
+	constexpr uint8_t kColliderFlagSensor = 1 << 0;
+
+	struct FileHeader
+	{
+		uint32_t Magic = kMagic;
+		uint32_t FormatVersion = kFormatVersion;
+		uint32_t EntityCount = 0;
+		uint32_t ChunkCount = 0;
+		uint64_t RandomSeed = 0;
+		uint32_t NameSize = 0;
+		uint32_t Reserved = 0;
+	};
+	static_assert(sizeof(FileHeader) == 32, "FileHeader layout is part of the file format");
+
+	struct ChunkHeader
+	{
+		uint32_t Id = 0;
+		uint32_t Count = 0;
+		uint64_t Size = 0;      // Payload bytes, including trailing padding
+	};
+	static_assert(sizeof(ChunkHeader) == 16, "ChunkHeader layout is part of the file format");
+
+	constexpr size_t AlignUp(size_t value)
+	{
+		return (value + kAlignment - 1) & ~(kAlignment - 1);
+	}
+
+} // namespace Pillar::SceneChunks
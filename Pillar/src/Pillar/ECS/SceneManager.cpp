@@ -1,9 +1,152 @@
 #include "SceneManager.h"
 #include "SceneSerializer.h"
+#include "ComponentRegistry.h"
+#include "Components/Rendering/SpriteComponent.h"
+#include "Components/Audio/AudioSourceComponent.h"
+#include "Pillar/Audio/AudioEngine.h"
+#include "Pillar/Audio/AudioDecoder.h"
+#include "Pillar/Audio/WavLoader.h"
+#include "Pillar/Renderer/Texture.h"
+#include "Pillar/Utils/AssetManager.h"
+#include "Pillar/Utils/ThreadPool.h"
 #include "Pillar/Logger.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace Pillar {
 
+	// Shared between the main thread and the loader task. The loader owns
+	// everything up to Stage == Uploading (published with release/acquire);
+	// from then on only the main thread touches it.
+	struct SceneManager::AsyncSceneLoad
+	{
+		// Decoded and uploaded by the AssetManager texture registry
+		struct PendingTexture
+		{
+			std::string Path;
+			TextureHandle Handle = InvalidTextureHandle;
+		};
+
+		struct DecodedAudio
+		{
+			std::string Path;
+			WavData Data;
+			bool Valid = false;
+		};
+
+		std::string FilePath;
+		std::string SceneName;
+		std::shared_ptr<Scene> LoadedScene;
+		AsyncSceneLoadCallback OnProgress;
+
+		std::atomic<AsyncSceneLoadStage> Stage{ AsyncSceneLoadStage::Parsing };
+		std::atomic<float> StageProgress{ 0.0f };
+		std::atomic<bool> Cancelled{ false };
+
+		std::vector<PendingTexture> Textures;
+		std::vector<DecodedAudio> Audio;
+
+		// Main thread only
+		size_t NextUpload = 0;
+		std::unordered_map<std::string, std::shared_ptr<AudioBuffer>> UploadedAudio;
+		AsyncSceneLoadStage ReportedStage = AsyncSceneLoadStage::Parsing;
+		float ReportedProgress = -1.0f;
+	};
+
+	namespace {
+
+		// Share of the whole load given to each stage, for progress reporting
+		constexpr float kParseShare = 0.6f;
+		constexpr float kDecodeShare = 0.25f;
+
+		float OverallProgress(AsyncSceneLoadStage stage, float stageProgress)
+		{
+			switch (stage)
+			{
+			case AsyncSceneLoadStage::Parsing:   return kParseShare * stageProgress;
+			case AsyncSceneLoadStage::Decoding:  return kParseShare + kDecodeShare * stageProgress;
+			case AsyncSceneLoadStage::Uploading: return kParseShare + kDecodeShare + (1.0f - kParseShare - kDecodeShare) * stageProgress;
+			case AsyncSceneLoadStage::Complete:  return 1.0f;
+			default:                             return 0.0f;
+			}
+		}
+
+		// Runs on a ThreadPool worker. Only touches the detached scene and the load state.
+		template<typename Load>
+		void BuildDetachedScene(Load& load)
+		{
+			{
+				// Sprites keep their TexturePath; textures are created on the main thread
+				ComponentRegistry::DeferResourceLoadsScope deferResources;
+				SceneSerializer serializer(load.LoadedScene.get());
+				bool loaded = serializer.DeserializeStreaming(load.FilePath, [&](const SceneLoadProgress& progress) {
+					load.StageProgress.store(progress.GetFraction(), std::memory_order_relaxed);
+				});
+				if (!loaded || load.Cancelled.load())
+				{
+					load.Stage.store(AsyncSceneLoadStage::Failed, std::memory_order_release);
+					return;
+				}
+			}
+
+			load.StageProgress.store(0.0f, std::memory_order_relaxed);
+			load.Stage.store(AsyncSceneLoadStage::Decoding, std::memory_order_release);
+
+			auto& registry = load.LoadedScene->GetRegistry();
+			std::unordered_set<std::string> texturePaths;
+			for (auto [entity, sprite] : registry.template view<SpriteComponent>().each())
+			{
+				if (!sprite.Texture && !sprite.TexturePath.empty())
+					texturePaths.insert(sprite.TexturePath);
+			}
+			std::unordered_set<std::string> audioPaths;
+			for (auto [entity, audio] : registry.template view<AudioSourceComponent>().each())
+			{
+				if (!audio.Buffer && !audio.AudioFile.empty())
+					audioPaths.insert(audio.AudioFile);
+			}
+
+			// Textures go through the shared registry, so paths already loaded elsewhere
+			// are reused and uploads share AssetManager's per-frame budget
+			std::vector<TextureHandle> textureHandles;
+			for (const auto& path : texturePaths)
+			{
+				TextureHandle handle = AssetManager::GetTextureHandle(path);
+				load.Textures.push_back({ path, handle });
+				textureHandles.push_back(handle);
+			}
+			AssetManager::PrefetchTextures(textureHandles);
+
+			for (const auto& path : audioPaths)
+				load.Audio.push_back({ path, {}, false });
+
+			const size_t total = load.Audio.size();
+			std::atomic<size_t> decoded{ 0 };
+			ThreadPool::Get().ParallelFor(total, 1, [&](size_t begin, size_t end) {
+				for (size_t i = begin; i < end && !load.Cancelled.load(std::memory_order_relaxed); ++i)
+				{
+					auto& audio = load.Audio[i];
+					audio.Valid = AudioDecoder::Decode(AssetManager::GetAudioPath(audio.Path), audio.Data);
+					size_t done = decoded.fetch_add(1) + 1;
+					load.StageProgress.store(static_cast<float>(done) / static_cast<float>(total), std::memory_order_relaxed);
+				}
+			});
+
+			if (load.Cancelled.load())
+			{
+				load.Stage.store(AsyncSceneLoadStage::Failed, std::memory_order_release);
+				return;
+			}
+
+			load.StageProgress.store(0.0f, std::memory_order_relaxed);
+			load.Stage.store(AsyncSceneLoadStage::Uploading, std::memory_order_release);
+		}
+
+	} // namespace
+
 	std::string SceneManager::s_EmptyString;
 
 	SceneManager& SceneManager::Get()
@@ -67,6 +210,7 @@ namespace Pillar {
 
 	void SceneManager::Clear()
 	{
+		CancelAsyncLoad();
 		m_Scenes.clear();
 		m_ActiveScene = nullptr;
 		m_PendingScene.clear();
@@ -133,15 +277,167 @@ namespace Pillar {
 		PIL_CORE_INFO("Scene change requested to '{}'", sceneName);
 	}
 
-	void SceneManager::LoadSceneAsync(const std::string& filepath, const std::string& sceneName)
+	void SceneManager::LoadSceneAsync(const std::string& filepath, const std::string& sceneName, AsyncSceneLoadCallback onProgress)
+	{
+		if (m_AsyncLoad)
+		{
+			PIL_CORE_WARN("Cancelling async load of '{}' in favour of '{}'", m_AsyncLoad->FilePath, filepath);
+			CancelAsyncLoad();
+		}
+
+		// Registration must not race with the loader thread's lookups
+		ComponentRegistry::Get().EnsureBuiltinsRegistered();
+
+		auto load = std::make_shared<AsyncSceneLoad>();
+		load->FilePath = filepath;
+		load->SceneName = sceneName.empty() ? filepath : sceneName;
+		load->LoadedScene = std::make_shared<Scene>(load->SceneName);
+		load->OnProgress = std::move(onProgress);
+		m_AsyncLoad = load;
+
+		ThreadPool::Get().Submit([load]() {
+			try
+			{
+				BuildDetachedScene(*load);
+			}
+			catch (const std::exception& e)
+			{
+				PIL_CORE_ERROR("Async load of '{}' failed: {}", load->FilePath, e.what());
+				load->Stage.store(AsyncSceneLoadStage::Failed, std::memory_order_release);
+			}
+		});
+
+		PIL_CORE_INFO("Loading scene '{}' from '{}' in the background", load->SceneName, filepath);
+	}
+
+	float SceneManager::GetAsyncLoadProgress() const
 	{
-		// In a full implementation, this would use async loading
-		// For now, we'll do synchronous loading
-		LoadScene(filepath, sceneName);
+		if (!m_AsyncLoad)
+			return 0.0f;
+		return OverallProgress(m_AsyncLoad->Stage.load(std::memory_order_acquire), m_AsyncLoad->StageProgress.load(std::memory_order_relaxed));
+	}
+
+	void SceneManager::CancelAsyncLoad()
+	{
+		if (!m_AsyncLoad)
+			return;
+
+		// The loader task holds its own reference and bails out at its next check
+		m_AsyncLoad->Cancelled.store(true);
+		m_AsyncLoad.reset();
+	}
+
+	void SceneManager::UpdateAsyncLoad()
+	{
+		auto load = m_AsyncLoad;
+		AsyncSceneLoadStage stage = load->Stage.load(std::memory_order_acquire);
+
+		if (stage == AsyncSceneLoadStage::Uploading)
+		{
+			// Textures are uploaded by AssetManager::ProcessTextureUploads; only wait for them here
+			size_t texturesSettled = 0;
+			for (const auto& texture : load->Textures)
+			{
+				TextureLoadState state = AssetManager::GetTextureState(texture.Handle);
+				if (state == TextureLoadState::Ready || state == TextureLoadState::Failed)
+					++texturesSettled;
+				else if (state == TextureLoadState::Unloaded)
+					AssetManager::PrefetchTexture(texture.Handle);   // Unloaded since the prefetch
+			}
+
+			// Create audio buffers until this frame's budget is spent
+			// (always at least one, so a tiny budget still makes progress)
+			const size_t audioCount = load->Audio.size();
+			const auto start = std::chrono::steady_clock::now();
+			while (load->NextUpload < audioCount)
+			{
+				auto& audio = load->Audio[load->NextUpload++];
+				if (audio.Valid && AudioEngine::IsInitialized())
+					load->UploadedAudio[audio.Path] = AudioEngine::CreateBuffer(audio.Path, audio.Data);
+				audio.Data = {};
+
+				std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+				if (elapsed.count() >= m_AsyncUploadBudgetMs)
+					break;
+			}
+
+			const size_t total = load->Textures.size() + audioCount;
+			const size_t done = texturesSettled + load->NextUpload;
+			load->StageProgress.store(total > 0 ? static_cast<float>(done) / static_cast<float>(total) : 1.0f);
+			if (done == total)
+				stage = AsyncSceneLoadStage::Complete;
+		}
+
+		if (stage == AsyncSceneLoadStage::Failed)
+			PIL_CORE_ERROR("Failed to load scene '{}' from '{}'", load->SceneName, load->FilePath);
+
+		float progress = OverallProgress(stage, load->StageProgress.load(std::memory_order_relaxed));
+		if (load->OnProgress && (stage != load->ReportedStage || progress != load->ReportedProgress))
+		{
+			load->ReportedStage = stage;
+			load->ReportedProgress = progress;
+			load->OnProgress({ load->SceneName, stage, progress });
+		}
+
+		if (stage == AsyncSceneLoadStage::Complete)
+			FinishAsyncLoad(*load);
+
+		if (stage == AsyncSceneLoadStage::Complete || stage == AsyncSceneLoadStage::Failed)
+		{
+			// A callback may already have started another load
+			if (m_AsyncLoad == load)
+				m_AsyncLoad.reset();
+		}
+	}
+
+	void SceneManager::FinishAsyncLoad(AsyncSceneLoad& load)
+	{
+		auto scene = load.LoadedScene;
+		auto& registry = scene->GetRegistry();
+		std::unordered_map<std::string, std::shared_ptr<Texture2D>> textures;
+		for (const auto& texture : load.Textures)
+			textures[texture.Path] = AssetManager::GetTexture(texture.Handle);   // Missing texture if decoding failed
+		for (auto [entity, sprite] : registry.view<SpriteComponent>().each())
+		{
+			if (sprite.Texture || sprite.TexturePath.empty())
+				continue;
+			auto it = textures.find(sprite.TexturePath);
+			if (it != textures.end())
+				sprite.Texture = it->second;
+		}
+		for (auto [entity, audio] : registry.view<AudioSourceComponent>().each())
+		{
+			if (audio.Buffer || audio.AudioFile.empty())
+				continue;
+			auto it = load.UploadedAudio.find(audio.AudioFile);
+			if (it != load.UploadedAudio.end())
+				audio.Buffer = it->second;
+		}
+
+		scene->SetFilePath(load.FilePath);
+		if (m_Scenes.find(load.SceneName) != m_Scenes.end())
+			PIL_CORE_WARN("Async load replaces existing scene '{}'", load.SceneName);
+		m_Scenes[load.SceneName] = scene;
+
+		if (m_OnSceneLoaded)
+		{
+			m_OnSceneLoaded(scene);
+		}
+
+		PIL_CORE_INFO("Loaded scene '{}' from '{}' asynchronously", load.SceneName, load.FilePath);
+
+		// Swap at the usual sync point
+		RequestSceneChange(load.SceneName);
 	}
 
 	void SceneManager::OnUpdate(float deltaTime)
 	{
+		// Main-thread half of LoadSceneAsync (uploads, registration)
+		if (m_AsyncLoad)
+		{
+			UpdateAsyncLoad();
+		}
+
 		// Handle pending scene changes at safe point in frame
 		if (m_IsTransitioning)
 		{
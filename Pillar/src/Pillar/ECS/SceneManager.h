@@ -13,6 +13,25 @@ namespace Pillar {
 	// Scene transition callback type
 	using SceneTransitionCallback = std::function<void(const std::string& fromScene, const std::string& toScene)>;
 
+	enum class AsyncSceneLoadStage
+	{
+		Parsing,     // Loader thread: building entities into a detached Scene
+		Decoding,    // Loader thread + pool: decoding textures and audio
+		Uploading,   // Main thread: creating GPU/audio resources within the frame budget
+		Complete,    // Scene registered and change requested
+		Failed
+	};
+
+	struct AsyncSceneLoadProgress
+	{
+		std::string SceneName;
+		AsyncSceneLoadStage Stage = AsyncSceneLoadStage::Parsing;
+		float Progress = 0.0f;       // Whole load, 0..1
+	};
+
+	// Always invoked on the main thread, from OnUpdate()
+	using AsyncSceneLoadCallback = std::function<void(const AsyncSceneLoadProgress&)>;
+
 	class PIL_API SceneManager
 	{
 	public:
@@ -33,9 +52,26 @@ namespace Pillar {
 
 		// Scene transitions
 		void RequestSceneChange(const std::string& sceneName);
-		void LoadSceneAsync(const std::string& filepath, const std::string& sceneName = "");
 		bool IsTransitioning() const { return m_IsTransitioning; }
 
+		/**
+		 * @brief Load a scene file without stalling the frame
+		 *
+		 * The scene is parsed into a detached Scene on a ThreadPool worker and its
+		 * audio is decoded in parallel there. Textures are prefetched through the
+		 * AssetManager registry and uploaded by AssetManager::ProcessTextureUploads
+		 * under its byte budget. OnUpdate() creates the audio buffers, spending at
+		 * most the upload budget per frame, and once every texture is uploaded
+		 * registers the scene and requests a change to it, so the swap happens at
+		 * the usual ProcessPendingSceneChange point. Starting a new load cancels the
+		 * one in flight.
+		 */
+		void LoadSceneAsync(const std::string& filepath, const std::string& sceneName = "", AsyncSceneLoadCallback onProgress = nullptr);
+		bool IsLoading() const { return m_AsyncLoad != nullptr; }
+		float GetAsyncLoadProgress() const;
+		void SetAsyncUploadBudget(float milliseconds) { m_AsyncUploadBudgetMs = milliseconds; }
+		float GetAsyncUploadBudget() const { return m_AsyncUploadBudgetMs; }
+
 		// Update (handles pending scene changes)
 		void OnUpdate(float deltaTime);
 
@@ -60,6 +96,11 @@ namespace Pillar {
 
 		void ProcessPendingSceneChange();
 
+		struct AsyncSceneLoad;
+		void UpdateAsyncLoad();
+		void FinishAsyncLoad(AsyncSceneLoad& load);
+		void CancelAsyncLoad();
+
 	private:
 		std::unordered_map<std::string, std::shared_ptr<Scene>> m_Scenes;
 		std::shared_ptr<Scene> m_ActiveScene;
@@ -68,6 +109,10 @@ namespace Pillar {
 		std::string m_PendingScene;
 		bool m_IsTransitioning = false;
 
+		// Async loading (one load in flight)
+		std::shared_ptr<AsyncSceneLoad> m_AsyncLoad;
+		float m_AsyncUploadBudgetMs = 2.0f;
+
 		// Callbacks
 		SceneTransitionCallback m_OnSceneChange;
 		std::function<void(std::shared_ptr<Scene>)> m_OnSceneLoaded;
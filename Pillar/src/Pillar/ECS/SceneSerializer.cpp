@@ -4,11 +4,19 @@
 #include "Components/Core/TagComponent.h"
 #include "Components/Core/TransformComponent.h"
 #include "Components/Core/UUIDComponent.h"
+#include "Components/Core/HierarchyComponent.h"
+#include "Components/Physics/VelocityComponent.h"
+#include "Components/Physics/RigidbodyComponent.h"
+#include "Components/Physics/ColliderComponent.h"
+#include "Components/Rendering/SpriteComponent.h"
+#include "SceneChunkFormat.h"
 #include "Pillar/Logger.h"
 #include "Pillar/Utils/AssetManager.h"
+#include "Pillar/Utils/MappedFile.h"
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <sstream>
-#include <iomanip>
 #include <filesystem>
 #include <iterator>
 #include <vector>
@@ -25,14 +33,17 @@ namespace {
 		sceneJson["scene"] = {
 			{ "name", scene->GetName() },
 			{ "version", Pillar::SceneSerializer::GetCurrentVersion() },
-			{ "schema", "scene" }
+			{ "schema", "scene" },
+			{ "randomSeed", scene->GetRandomSeed() }
 		};
 
-		json entitiesJson = json::array();
-
+		// Entity objects in registry order; components are then filled in one
+		// component type at a time from that type's storage
+		std::vector<json> entities;
+		std::vector<uint32_t> entityIndex;
 		scene->GetRegistry().each([&](auto entityHandle) {
 			Pillar::Entity entity(entityHandle, scene);
-			json entityJson;
+			json entityJson = json::object();
 
 			if (entity.HasComponent<Pillar::UUIDComponent>())
 			{
@@ -44,21 +55,72 @@ namespace {
 				entityJson["tag"] = entity.GetComponent<Pillar::TagComponent>().Tag;
 			}
 
-			auto& registry = Pillar::ComponentRegistry::Get();
-			for (const auto& [key, registration] : registry.GetRegistrations())
+			const auto index = static_cast<size_t>(entt::to_entity(entityHandle));
+			if (index >= entityIndex.size())
+				entityIndex.resize(index + 1, UINT32_MAX);
+			entityIndex[index] = static_cast<uint32_t>(entities.size());
+			entities.push_back(std::move(entityJson));
+		});
+
+		Pillar::ComponentRegistry::Get().SerializeAllComponents(*scene, entityIndex, entities);
+
+		json entitiesJson = json::array();
+		for (auto& entityJson : entities)
+			entitiesJson.push_back(std::move(entityJson));
+
+		sceneJson["entities"] = std::move(entitiesJson);
+		return sceneJson;
+	}
+
+	// Writes `value` as dump(2) would, continuing lines at `indent`
+	void WriteIndented(std::ostream& out, const json& value, const char* indent)
+	{
+		const std::string text = value.dump(2);
+		size_t start = 0;
+		for (size_t newline = text.find('\n'); newline != std::string::npos; newline = text.find('\n', start))
+		{
+			out.write(text.data() + start, static_cast<std::streamsize>(newline + 1 - start));
+			out << indent;
+			start = newline + 1;
+		}
+		out.write(text.data() + start, static_cast<std::streamsize>(text.size() - start));
+	}
+
+	// Same layout as `out << std::setw(2) << sceneJson`, except "scene" comes first.
+	// nlohmann sorts keys, which would put it after "entities", and the streaming
+	// loader needs the version before it builds any entity.
+	void WriteSceneJson(std::ostream& out, const json& sceneJson)
+	{
+		bool first = true;
+		auto writeMember = [&](const std::string& key, const json& value) {
+			out << (first ? "{\n  " : ",\n  ") << json(key).dump() << ": ";
+			first = false;
+
+			if (!value.is_array() || value.empty())
 			{
-				json componentJson = registration.Serialize(entity);
-				if (!componentJson.is_null())
-				{
-					entityJson[key] = componentJson;
-				}
+				WriteIndented(out, value, "  ");
+				return;
 			}
 
-			entitiesJson.push_back(entityJson);
-		});
+			// One element at a time so the entity list is never dumped into a single string
+			out << '[';
+			for (size_t i = 0; i < value.size(); ++i)
+			{
+				out << (i == 0 ? "\n    " : ",\n    ");
+				WriteIndented(out, value[i], "    ");
+			}
+			out << "\n  ]";
+		};
 
-		sceneJson["entities"] = entitiesJson;
-		return sceneJson;
+		auto sceneIt = sceneJson.find("scene");
+		if (sceneIt != sceneJson.end())
+			writeMember("scene", *sceneIt);
+		for (auto it = sceneJson.begin(); it != sceneJson.end(); ++it)
+		{
+			if (it != sceneIt)
+				writeMember(it.key(), it.value());
+		}
+		out << (first ? "{}" : "\n}");
 	}
 
 	std::filesystem::path ResolveSavePath(const std::string& filepath)
@@ -105,6 +167,8 @@ namespace {
 			const auto& sceneMeta = sceneJson["scene"];
 			if (sceneMeta.contains("name"))
 				scene->SetName(sceneMeta["name"].get<std::string>());
+			if (sceneMeta.contains("randomSeed"))
+				scene->SetRandomSeed(sceneMeta["randomSeed"].get<uint64_t>());
 		}
 
 		if (!sceneJson.contains("entities"))
@@ -124,11 +188,12 @@ namespace {
 				scene->CreateEntityWithUUID(uuid, tag) :
 				scene->CreateEntity(tag);
 
-			for (const auto& [key, registration] : registry.GetRegistrations())
+			for (const Pillar::ComponentRegistration* registration : registry.GetRegistrationTable())
 			{
-				if (entityJson.contains(key))
+				auto it = entityJson.find(registration->Name);
+				if (it != entityJson.end())
 				{
-					registration.Deserialize(entity, entityJson[key]);
+					registration->Deserialize(entity, *it);
 				}
 			}
 		}
@@ -136,6 +201,799 @@ namespace {
 		PIL_CORE_INFO("Scene deserialized from JSON ({} entities)", scene->GetEntityCount());
 		return true;
 	}
+
+	// ------------------------------------------------------------------
+	// Chunked binary format (layout documented in SceneChunkFormat.h)
+	// ------------------------------------------------------------------
+
+	namespace Chunks = Pillar::SceneChunks;
+
+	// Appends 8-byte aligned arrays and chunk headers to a byte buffer
+	class ChunkWriter
+	{
+	public:
+		explicit ChunkWriter(std::vector<uint8_t>& out) : m_Out(out) {}
+
+		void WriteBytes(const void* data, size_t size)
+		{
+			const auto* bytes = static_cast<const uint8_t*>(data);
+			m_Out.insert(m_Out.end(), bytes, bytes + size);
+			m_Out.resize(Chunks::AlignUp(m_Out.size()), 0);
+		}
+
+		template<typename T>
+		void WriteArray(const std::vector<T>& values)
+		{
+			WriteBytes(values.data(), values.size() * sizeof(T));
+		}
+
+		template<typename T>
+		void WriteValue(const T& value)
+		{
+			WriteBytes(&value, sizeof(T));
+		}
+
+		// Reserve a chunk header; EndChunk fills in the payload size
+		size_t BeginChunk(uint32_t id, uint32_t count)
+		{
+			Chunks::ChunkHeader header;
+			header.Id = id;
+			header.Count = count;
+			const size_t offset = m_Out.size();
+			WriteValue(header);
+			++m_ChunkCount;
+			return offset;
+		}
+
+		void EndChunk(size_t headerOffset)
+		{
+			Chunks::ChunkHeader header;
+			std::memcpy(&header, m_Out.data() + headerOffset, sizeof(header));
+			header.Size = m_Out.size() - headerOffset - sizeof(header);
+			std::memcpy(m_Out.data() + headerOffset, &header, sizeof(header));
+		}
+
+		uint32_t GetChunkCount() const { return m_ChunkCount; }
+
+	private:
+		std::vector<uint8_t>& m_Out;
+		uint32_t m_ChunkCount = 0;
+	};
+
+	// Bounds-checked cursor over a chunk payload; arrays are returned in place
+	class ChunkReader
+	{
+	public:
+		ChunkReader(const uint8_t* data, size_t size) : m_Data(data), m_Size(size) {}
+
+		template<typename T>
+		const T* ReadArray(size_t count)
+		{
+			const size_t bytes = count * sizeof(T);
+			if (count > m_Size / sizeof(T) || m_Offset + bytes > m_Size)
+			{
+				m_Failed = true;
+				return nullptr;
+			}
+			const T* result = reinterpret_cast<const T*>(m_Data + m_Offset);
+			m_Offset = std::min(m_Size, Chunks::AlignUp(m_Offset + bytes));
+			return result;
+		}
+
+		template<typename T>
+		bool ReadValue(T& value)
+		{
+			const T* ptr = ReadArray<T>(1);
+			if (!ptr)
+				return false;
+			std::memcpy(&value, ptr, sizeof(T));
+			return true;
+		}
+
+		bool Failed() const { return m_Failed; }
+
+	private:
+		const uint8_t* m_Data;
+		size_t m_Size;
+		size_t m_Offset = 0;
+		bool m_Failed = false;
+	};
+
+	// Components with a native SoA chunk; everything else goes through CJSN
+	bool HasNativeChunk(const std::string& key)
+	{
+		return key == "transform" || key == "hierarchy" || key == "velocity"
+			|| key == "sprite" || key == "rigidbody" || key == "collider";
+	}
+
+	// Offsets[Count + 1] followed by the concatenated strings (layout shared by TAGS/SPRT)
+	void AppendString(std::vector<uint32_t>& offsets, std::string& data, const std::string& value)
+	{
+		data += value;
+		offsets.push_back(static_cast<uint32_t>(data.size()));
+	}
+
+	bool ReadStrings(ChunkReader& reader, uint32_t count, const uint32_t*& offsets, const char*& text)
+	{
+		offsets = reader.ReadArray<uint32_t>(static_cast<size_t>(count) + 1);
+		if (!offsets)
+			return false;
+		text = reader.ReadArray<char>(offsets[count]);
+		if (!text && offsets[count] > 0)
+			return false;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (offsets[i] > offsets[i + 1] || offsets[i + 1] > offsets[count])
+				return false;
+		}
+		return true;
+	}
+
+	template<typename Component, typename Fn>
+	void CollectIndexed(entt::registry& registry, const std::vector<uint32_t>& indexOf,
+		std::vector<uint32_t>& indices, Fn&& append)
+	{
+		auto view = registry.view<Component>();
+		for (auto [entity, component] : view.each())
+		{
+			indices.push_back(indexOf[entt::to_entity(entity)]);
+			append(component);
+		}
+	}
+
+	std::vector<uint8_t> BuildSceneChunks(Pillar::Scene* scene)
+	{
+		auto& registry = scene->GetRegistry();
+
+		// Number entities in registry order
+		std::vector<entt::entity> entities;
+		entities.reserve(scene->GetEntityCount());
+		registry.each([&](auto entityHandle) { entities.push_back(entityHandle); });
+
+		std::vector<uint32_t> indexOf;
+		for (uint32_t i = 0; i < entities.size(); ++i)
+		{
+			const auto id = static_cast<size_t>(entt::to_entity(entities[i]));
+			if (id >= indexOf.size())
+				indexOf.resize(id + 1, UINT32_MAX);
+			indexOf[id] = i;
+		}
+
+		const uint32_t entityCount = static_cast<uint32_t>(entities.size());
+		const std::string& name = scene->GetName();
+
+		std::vector<uint8_t> out;
+		out.reserve(sizeof(Chunks::FileHeader) + entityCount * 64);
+		out.resize(sizeof(Chunks::FileHeader), 0);
+		ChunkWriter writer(out);
+		writer.WriteBytes(name.data(), name.size());
+
+		// UUID
+		{
+			std::vector<uint64_t> uuids(entityCount, 0);
+			for (uint32_t i = 0; i < entityCount; ++i)
+			{
+				if (const auto* uuid = registry.try_get<Pillar::UUIDComponent>(entities[i]))
+					uuids[i] = uuid->UUID;
+			}
+			const size_t chunk = writer.BeginChunk(Chunks::kChunkUUID, entityCount);
+			writer.WriteArray(uuids);
+			writer.EndChunk(chunk);
+		}
+
+		// TAGS
+		{
+			std::vector<uint32_t> offsets(1, 0);
+			offsets.reserve(entityCount + 1);
+			std::string data;
+			static const std::string kNoTag;
+			for (uint32_t i = 0; i < entityCount; ++i)
+			{
+				const auto* tag = registry.try_get<Pillar::TagComponent>(entities[i]);
+				AppendString(offsets, data, tag ? tag->Tag : kNoTag);
+			}
+			const size_t chunk = writer.BeginChunk(Chunks::kChunkTags, entityCount);
+			writer.WriteArray(offsets);
+			writer.WriteBytes(data.data(), data.size());
+			writer.EndChunk(chunk);
+		}
+
+		// XFRM
+		{
+			std::vector<uint32_t> indices;
+			std::vector<float> px, py, rot, sx, sy;
+			CollectIndexed<Pillar::TransformComponent>(registry, indexOf, indices, [&](const Pillar::TransformComponent& t) {
+				px.push_back(t.Position.x);
+				py.push_back(t.Position.y);
+				rot.push_back(t.Rotation);
+				sx.push_back(t.Scale.x);
+				sy.push_back(t.Scale.y);
+			});
+			const size_t chunk = writer.BeginChunk(Chunks::kChunkTransform, static_cast<uint32_t>(indices.size()));
+			writer.WriteArray(indices);
+			writer.WriteArray(px);
+			writer.WriteArray(py);
+			writer.WriteArray(rot);
+			writer.WriteArray(sx);
+			writer.WriteArray(sy);
+			writer.EndChunk(chunk);
+		}
+
+		// HIER
+		{
+			std::vector<uint32_t> indices;
+			std::vector<uint64_t> parents;
+			CollectIndexed<Pillar::HierarchyComponent>(registry, indexOf, indices, [&](const Pillar::HierarchyComponent& h) {
+				parents.push_back(h.ParentUUID);
+			});
+			if (!indices.empty())
+			{
+				const size_t chunk = writer.BeginChunk(Chunks::kChunkHierarchy, static_cast<uint32_t>(indices.size()));
+				writer.WriteArray(indices);
+				writer.WriteArray(parents);
+				writer.EndChunk(chunk);
+			}
+		}
+
+		// VELO
+		{
+			std::vector<uint32_t> indices;
+			std::vector<float> vx, vy, ax, ay, drag, maxSpeed;
+			CollectIndexed<Pillar::VelocityComponent>(registry, indexOf, indices, [&](const Pillar::VelocityComponent& v) {
+				vx.push_back(v.Velocity.x);
+				vy.push_back(v.Velocity.y);
+				ax.push_back(v.Acceleration.x);
+				ay.push_back(v.Acceleration.y);
+				drag.push_back(v.Drag);
+				maxSpeed.push_back(v.MaxSpeed);
+			});
+			if (!indices.empty())
+			{
+				const size_t chunk = writer.BeginChunk(Chunks::kChunkVelocity, static_cast<uint32_t>(indices.size()));
+				writer.WriteArray(indices);
+				writer.WriteArray(vx);
+				writer.WriteArray(vy);
+				writer.WriteArray(ax);
+				writer.WriteArray(ay);
+				writer.WriteArray(drag);
+				writer.WriteArray(maxSpeed);
+				writer.EndChunk(chunk);
+			}
+		}
+
+		// SPRT
+		{
+			std::vector<uint32_t> indices;
+			std::vector<float> color, size, uvMin, uvMax, zIndex;
+			std::vector<int32_t> orderInLayer;
+			std::vector<uint8_t> flags;
+			std::vector<uint32_t> pathOffsets(1, 0), layerOffsets(1, 0);
+			std::string paths, layers;
+			CollectIndexed<Pillar::SpriteComponent>(registry, indexOf, indices, [&](const Pillar::SpriteComponent& s) {
+				color.insert(color.end(), { s.Color.x, s.Color.y, s.Color.z, s.Color.w });
+				size.insert(size.end(), { s.Size.x, s.Size.y });
+				uvMin.insert(uvMin.end(), { s.TexCoordMin.x, s.TexCoordMin.y });
+				uvMax.insert(uvMax.end(), { s.TexCoordMax.x, s.TexCoordMax.y });
+				zIndex.push_back(s.ZIndex);
+				orderInLayer.push_back(s.OrderInLayer);
+				flags.push_back(static_cast<uint8_t>(
+					(s.LockUV ? Chunks::kSpriteFlagLockUV : 0)
+					| (s.FlipX ? Chunks::kSpriteFlagFlipX : 0)
+					| (s.FlipY ? Chunks::kSpriteFlagFlipY : 0)
+					| (s.Visible ? Chunks::kSpriteFlagVisible : 0)));
+				AppendString(pathOffsets, paths, s.TexturePath);
+				AppendString(layerOffsets, layers, s.Layer);
+			});
+			if (!indices.empty())
+			{
+				const size_t chunk = writer.BeginChunk(Chunks::kChunkSprite, static_cast<uint32_t>(indices.size()));
+				writer.WriteArray(indices);
+				writer.WriteArray(color);
+				writer.WriteArray(size);
+				writer.WriteArray(uvMin);
+				writer.WriteArray(uvMax);
+				writer.WriteArray(zIndex);
+				writer.WriteArray(orderInLayer);
+				writer.WriteArray(flags);
+				writer.WriteArray(pathOffsets);
+				writer.WriteBytes(paths.data(), paths.size());
+				writer.WriteArray(layerOffsets);
+				writer.WriteBytes(layers.data(), layers.size());
+				writer.EndChunk(chunk);
+			}
+		}
+
+		// RGBD
+		{
+			std::vector<uint32_t> indices;
+			std::vector<uint8_t> bodyType, flags;
+			std::vector<float> gravityScale, linearDamping, angularDamping;
+			CollectIndexed<Pillar::RigidbodyComponent>(registry, indexOf, indices, [&](const Pillar::RigidbodyComponent& rb) {
+				bodyType.push_back(static_cast<uint8_t>(rb.BodyType));
+				flags.push_back(static_cast<uint8_t>(
+					(rb.FixedRotation ? Chunks::kRigidbodyFlagFixedRotation : 0)
+					| (rb.IsBullet ? Chunks::kRigidbodyFlagBullet : 0)
+					| (rb.IsEnabled ? Chunks::kRigidbodyFlagEnabled : 0)));
+				gravityScale.push_back(rb.GravityScale);
+				linearDamping.push_back(rb.LinearDamping);
+				angularDamping.push_back(rb.AngularDamping);
+			});
+			if (!indices.empty())
+			{
+				const size_t chunk = writer.BeginChunk(Chunks::kChunkRigidbody, static_cast<uint32_t>(indices.size()));
+				writer.WriteArray(indices);
+				writer.WriteArray(bodyType);
+				writer.WriteArray(flags);
+				writer.WriteArray(gravityScale);
+				writer.WriteArray(linearDamping);
+				writer.WriteArray(angularDamping);
+				writer.EndChunk(chunk);
+			}
+		}
+
+		// COLL
+		{
+			std::vector<uint32_t> indices;
+			std::vector<uint8_t> type, flags;
+			std::vector<float> ox, oy, shapeX, shapeY, density, friction, restitution;
+			std::vector<uint16_t> category, mask;
+			std::vector<int16_t> group;
+			std::vector<uint32_t> vertexOffsets(1, 0);
+			std::vector<float> vertexX, vertexY;
+			CollectIndexed<Pillar::ColliderComponent>(registry, indexOf, indices, [&](const Pillar::ColliderComponent& c) {
+				type.push_back(static_cast<uint8_t>(c.Type));
+				flags.push_back(c.IsSensor ? Chunks::kColliderFlagSensor : 0);
+				ox.push_back(c.Offset.x);
+				oy.push_back(c.Offset.y);
+				shapeX.push_back(c.Type == Pillar::ColliderType::Box ? c.HalfExtents.x : c.Radius);
+				shapeY.push_back(c.Type == Pillar::ColliderType::Box ? c.HalfExtents.y : 0.0f);
+				density.push_back(c.Density);
+				friction.push_back(c.Friction);
+				restitution.push_back(c.Restitution);
+				category.push_back(c.CategoryBits);
+				mask.push_back(c.MaskBits);
+				group.push_back(c.GroupIndex);
+				for (const auto& vertex : c.Vertices)
+				{
+					vertexX.push_back(vertex.x);
+					vertexY.push_back(vertex.y);
+				}
+				vertexOffsets.push_back(static_cast<uint32_t>(vertexX.size()));
+			});
+			if (!indices.empty())
+			{
+				const size_t chunk = writer.BeginChunk(Chunks::kChunkCollider, static_cast<uint32_t>(indices.size()));
+				writer.WriteArray(indices);
+				writer.WriteArray(type);
+				writer.WriteArray(flags);
+				writer.WriteArray(ox);
+				writer.WriteArray(oy);
+				writer.WriteArray(shapeX);
+				writer.WriteArray(shapeY);
+				writer.WriteArray(density);
+				writer.WriteArray(friction);
+				writer.WriteArray(restitution);
+				writer.WriteArray(category);
+				writer.WriteArray(mask);
+				writer.WriteArray(group);
+				writer.WriteArray(vertexOffsets);
+				writer.WriteArray(vertexX);
+				writer.WriteArray(vertexY);
+				writer.EndChunk(chunk);
+			}
+		}
+
+		// CJSN - one chunk per remaining registered component
+		for (const Pillar::ComponentRegistration* registration : Pillar::ComponentRegistry::Get().GetRegistrationTable())
+		{
+			const std::string& key = registration->Name;
+			if (HasNativeChunk(key) || !registration->Serialize)
+				continue;
+
+			std::vector<uint32_t> indices;
+			std::vector<uint32_t> offsets(1, 0);
+			std::vector<uint8_t> blobs;
+			for (uint32_t i = 0; i < entityCount; ++i)
+			{
+				if (!registration->Has(registry, entities[i]))
+					continue;
+
+				json componentJson = registration->Serialize(Pillar::Entity(entities[i], scene));
+				if (componentJson.is_null())
+					continue;
+
+				json::to_msgpack(componentJson, blobs);
+				indices.push_back(i);
+				offsets.push_back(static_cast<uint32_t>(blobs.size()));
+			}
+			if (indices.empty())
+				continue;
+
+			const size_t chunk = writer.BeginChunk(Chunks::kChunkComponentJson, static_cast<uint32_t>(indices.size()));
+			writer.WriteValue(static_cast<uint32_t>(key.size()));
+			writer.WriteBytes(key.data(), key.size());
+			writer.WriteArray(indices);
+			writer.WriteArray(offsets);
+			writer.WriteArray(blobs);
+			writer.EndChunk(chunk);
+		}
+
+		Chunks::FileHeader header;
+		header.EntityCount = entityCount;
+		header.ChunkCount = writer.GetChunkCount();
+		header.RandomSeed = scene->GetRandomSeed();
+		header.NameSize = static_cast<uint32_t>(name.size());
+		std::memcpy(out.data(), &header, sizeof(header));
+		return out;
+	}
+
+	bool ValidIndices(const uint32_t* indices, uint32_t count, uint32_t entityCount)
+	{
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (indices[i] >= entityCount)
+				return false;
+		}
+		return true;
+	}
+
+	// Gather the entities a chunk refers to
+	void GatherEntities(const std::vector<entt::entity>& entities, const uint32_t* indices, uint32_t count,
+		std::vector<entt::entity>& out)
+	{
+		out.resize(count);
+		for (uint32_t i = 0; i < count; ++i)
+			out[i] = entities[indices[i]];
+	}
+
+	bool PopulateSceneFromChunks(Pillar::Scene* scene, const uint8_t* data, size_t size)
+	{
+		if (!data || size < sizeof(Chunks::FileHeader))
+		{
+			PIL_CORE_ERROR("Chunked scene: file too small");
+			return false;
+		}
+
+		Chunks::FileHeader header;
+		std::memcpy(&header, data, sizeof(header));
+		if (header.Magic != Chunks::kMagic)
+		{
+			PIL_CORE_ERROR("Chunked scene: bad magic");
+			return false;
+		}
+		if (header.FormatVersion != Chunks::kFormatVersion)
+		{
+			PIL_CORE_ERROR("Chunked scene: format version {} unsupported (expected {}); re-cook it from JSON",
+				header.FormatVersion, Chunks::kFormatVersion);
+			return false;
+		}
+
+		ChunkReader file(data, size);
+		file.ReadArray<Chunks::FileHeader>(1);
+		const char* name = file.ReadArray<char>(header.NameSize);
+
+		// Locate every chunk up front so the core chunks can be applied first
+		struct ChunkRef
+		{
+			Chunks::ChunkHeader Header;
+			const uint8_t* Payload = nullptr;
+		};
+		std::vector<ChunkRef> chunks;
+		chunks.reserve(header.ChunkCount);
+		for (uint32_t i = 0; i < header.ChunkCount && !file.Failed(); ++i)
+		{
+			ChunkRef ref;
+			if (!file.ReadValue(ref.Header))
+				break;
+			ref.Payload = file.ReadArray<uint8_t>(static_cast<size_t>(ref.Header.Size));
+			chunks.push_back(ref);
+		}
+		if (file.Failed() || !name)
+		{
+			PIL_CORE_ERROR("Chunked scene: truncated file");
+			return false;
+		}
+
+		auto findChunk = [&chunks](uint32_t id) -> const ChunkRef* {
+			for (const auto& chunk : chunks)
+			{
+				if (chunk.Header.Id == id)
+					return &chunk;
+			}
+			return nullptr;
+		};
+
+		auto& registry = scene->GetRegistry();
+		registry.clear();
+		scene->SetName(std::string(name, header.NameSize));
+		scene->SetRandomSeed(header.RandomSeed);
+
+		const uint32_t entityCount = header.EntityCount;
+		auto fail = [&](const char* what) {
+			PIL_CORE_ERROR("Chunked scene: malformed {} chunk", what);
+			registry.clear();
+			return false;
+		};
+
+		std::vector<entt::entity> entities(entityCount);
+		registry.create(entities.begin(), entities.end());
+
+		// Core components every scene entity has (matches Scene::CreateEntity)
+		{
+			std::vector<Pillar::UUIDComponent> uuids;
+			uuids.reserve(entityCount);
+			const ChunkRef* chunk = findChunk(Chunks::kChunkUUID);
+			const uint64_t* raw = nullptr;
+			if (chunk)
+			{
+				ChunkReader reader(chunk->Payload, static_cast<size_t>(chunk->Header.Size));
+				raw = reader.ReadArray<uint64_t>(entityCount);
+				if (!raw || chunk->Header.Count != entityCount)
+					return fail("UUID");
+			}
+			for (uint32_t i = 0; i < entityCount; ++i)
+			{
+				if (raw && raw[i] != 0)
+					uuids.emplace_back(raw[i]);
+				else
+					uuids.emplace_back();
+			}
+			registry.insert<Pillar::UUIDComponent>(entities.begin(), entities.end(), uuids.begin());
+		}
+
+		{
+			std::vector<Pillar::TagComponent> tags(entityCount, Pillar::TagComponent("Entity"));
+			if (const ChunkRef* chunk = findChunk(Chunks::kChunkTags))
+			{
+				ChunkReader reader(chunk->Payload, static_cast<size_t>(chunk->Header.Size));
+				const uint32_t* offsets = nullptr;
+				const char* text = nullptr;
+				if (chunk->Header.Count != entityCount || !ReadStrings(reader, entityCount, offsets, text))
+					return fail("TAGS");
+				for (uint32_t i = 0; i < entityCount; ++i)
+					tags[i].Tag.assign(text + offsets[i], offsets[i + 1] - offsets[i]);
+			}
+			registry.insert<Pillar::TagComponent>(entities.begin(), entities.end(), tags.begin());
+		}
+
+		{
+			std::vector<Pillar::TransformComponent> transforms(entityCount);
+			if (const ChunkRef* chunk = findChunk(Chunks::kChunkTransform))
+			{
+				const uint32_t count = chunk->Header.Count;
+				ChunkReader reader(chunk->Payload, static_cast<size_t>(chunk->Header.Size));
+				const uint32_t* indices = reader.ReadArray<uint32_t>(count);
+				const float* px = reader.ReadArray<float>(count);
+				const float* py = reader.ReadArray<float>(count);
+				const float* rot = reader.ReadArray<float>(count);
+				const float* sx = reader.ReadArray<float>(count);
+				const float* sy = reader.ReadArray<float>(count);
+				if (reader.Failed() || !ValidIndices(indices, count, entityCount))
+					return fail("XFRM");
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					auto& t = transforms[indices[i]];
+					t.Position = { px[i], py[i] };
+					t.Rotation = rot[i];
+					t.Scale = { sx[i], sy[i] };
+				}
+			}
+			registry.insert<Pillar::TransformComponent>(entities.begin(), entities.end(), transforms.begin());
+		}
+
+		std::vector<entt::entity> targets;
+		if (const ChunkRef* chunk = findChunk(Chunks::kChunkHierarchy))
+		{
+			const uint32_t count = chunk->Header.Count;
+			ChunkReader reader(chunk->Payload, static_cast<size_t>(chunk->Header.Size));
+			const uint32_t* indices = reader.ReadArray<uint32_t>(count);
+			const uint64_t* parents = reader.ReadArray<uint64_t>(count);
+			if (reader.Failed() || !ValidIndices(indices, count, entityCount))
+				return fail("HIER");
+
+			std::vector<Pillar::HierarchyComponent> components(parents, parents + count);
+			GatherEntities(entities, indices, count, targets);
+			registry.insert<Pillar::HierarchyComponent>(targets.begin(), targets.end(), components.begin());
+		}
+
+		if (const ChunkRef* chunk = findChunk(Chunks::kChunkVelocity))
+		{
+			const uint32_t count = chunk->Header.Count;
+			ChunkReader reader(chunk->Payload, static_cast<size_t>(chunk->Header.Size));
+			const uint32_t* indices = reader.ReadArray<uint32_t>(count);
+			const float* vx = reader.ReadArray<float>(count);
+			const float* vy = reader.ReadArray<float>(count);
+			const float* ax = reader.ReadArray<float>(count);
+			const float* ay = reader.ReadArray<float>(count);
+			const float* drag = reader.ReadArray<float>(count);
+			const float* maxSpeed = reader.ReadArray<float>(count);
+			if (reader.Failed() || !ValidIndices(indices, count, entityCount))
+				return fail("VELO");
+
+			std::vector<Pillar::VelocityComponent> components(count);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				auto& v = components[i];
+				v.Velocity = { vx[i], vy[i] };
+				v.Acceleration = { ax[i], ay[i] };
+				v.Drag = drag[i];
+				v.MaxSpeed = maxSpeed[i];
+			}
+			GatherEntities(entities, indices, count, targets);
+			registry.insert<Pillar::VelocityComponent>(targets.begin(), targets.end(), components.begin());
+		}
+
+		if (const ChunkRef* chunk = findChunk(Chunks::kChunkSprite))
+		{
+			const uint32_t count = chunk->Header.Count;
+			ChunkReader reader(chunk->Payload, static_cast<size_t>(chunk->Header.Size));
+			const uint32_t* indices = reader.ReadArray<uint32_t>(count);
+			const float* color = reader.ReadArray<float>(static_cast<size_t>(count) * 4);
+			const float* size = reader.ReadArray<float>(static_cast<size_t>(count) * 2);
+			const float* uvMin = reader.ReadArray<float>(static_cast<size_t>(count) * 2);
+			const float* uvMax = reader.ReadArray<float>(static_cast<size_t>(count) * 2);
+			const float* zIndex = reader.ReadArray<float>(count);
+			const int32_t* orderInLayer = reader.ReadArray<int32_t>(count);
+			const uint8_t* flags = reader.ReadArray<uint8_t>(count);
+			const uint32_t* pathOffsets = nullptr;
+			const uint32_t* layerOffsets = nullptr;
+			const char* paths = nullptr;
+			const char* layers = nullptr;
+			if (reader.Failed() || !ReadStrings(reader, count, pathOffsets, paths)
+				|| !ReadStrings(reader, count, layerOffsets, layers) || !ValidIndices(indices, count, entityCount))
+				return fail("SPRT");
+
+			// Same texture handling as the "sprite" registry entry
+			const bool loadTextures = !Pillar::ComponentRegistry::IsDeferringResourceLoads();
+			std::vector<Pillar::SpriteComponent> components(count);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				auto& s = components[i];
+				s.Color = { color[i * 4], color[i * 4 + 1], color[i * 4 + 2], color[i * 4 + 3] };
+				s.Size = { size[i * 2], size[i * 2 + 1] };
+				s.TexCoordMin = { uvMin[i * 2], uvMin[i * 2 + 1] };
+				s.TexCoordMax = { uvMax[i * 2], uvMax[i * 2 + 1] };
+				s.ZIndex = zIndex[i];
+				s.OrderInLayer = orderInLayer[i];
+				s.LockUV = (flags[i] & Chunks::kSpriteFlagLockUV) != 0;
+				s.FlipX = (flags[i] & Chunks::kSpriteFlagFlipX) != 0;
+				s.FlipY = (flags[i] & Chunks::kSpriteFlagFlipY) != 0;
+				s.Visible = (flags[i] & Chunks::kSpriteFlagVisible) != 0;
+				s.TexturePath.assign(paths + pathOffsets[i], pathOffsets[i + 1] - pathOffsets[i]);
+				s.Layer.assign(layers + layerOffsets[i], layerOffsets[i + 1] - layerOffsets[i]);
+				if (loadTextures && !s.TexturePath.empty())
+					s.Texture = Pillar::AssetManager::LoadTextureAsync(s.TexturePath);
+			}
+			GatherEntities(entities, indices, count, targets);
+			registry.insert<Pillar::SpriteComponent>(targets.begin(), targets.end(), components.begin());
+		}
+
+		if (const ChunkRef* chunk = findChunk(Chunks::kChunkRigidbody))
+		{
+			const uint32_t count = chunk->Header.Count;
+			ChunkReader reader(chunk->Payload, static_cast<size_t>(chunk->Header.Size));
+			const uint32_t* indices = reader.ReadArray<uint32_t>(count);
+			const uint8_t* bodyType = reader.ReadArray<uint8_t>(count);
+			const uint8_t* flags = reader.ReadArray<uint8_t>(count);
+			const float* gravityScale = reader.ReadArray<float>(count);
+			const float* linearDamping = reader.ReadArray<float>(count);
+			const float* angularDamping = reader.ReadArray<float>(count);
+			if (reader.Failed() || !ValidIndices(indices, count, entityCount))
+				return fail("RGBD");
+
+			// RigidbodyComponent is not copyable (it owns a b2Body*), so emplace rather than insert
+			registry.storage<Pillar::RigidbodyComponent>().reserve(count);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				if (bodyType[i] > b2_dynamicBody)
+					return fail("RGBD");
+
+				auto& rb = registry.emplace<Pillar::RigidbodyComponent>(entities[indices[i]], static_cast<b2BodyType>(bodyType[i]));
+				rb.FixedRotation = (flags[i] & Chunks::kRigidbodyFlagFixedRotation) != 0;
+				rb.IsBullet = (flags[i] & Chunks::kRigidbodyFlagBullet) != 0;
+				rb.IsEnabled = (flags[i] & Chunks::kRigidbodyFlagEnabled) != 0;
+				rb.GravityScale = gravityScale[i];
+				rb.LinearDamping = linearDamping[i];
+				rb.AngularDamping = angularDamping[i];
+			}
+		}
+
+		if (const ChunkRef* chunk = findChunk(Chunks::kChunkCollider))
+		{
+			const uint32_t count = chunk->Header.Count;
+			ChunkReader reader(chunk->Payload, static_cast<size_t>(chunk->Header.Size));
+			const uint32_t* indices = reader.ReadArray<uint32_t>(count);
+			const uint8_t* type = reader.ReadArray<uint8_t>(count);
+			const uint8_t* flags = reader.ReadArray<uint8_t>(count);
+			const float* ox = reader.ReadArray<float>(count);
+			const float* oy = reader.ReadArray<float>(count);
+			const float* shapeX = reader.ReadArray<float>(count);
+			const float* shapeY = reader.ReadArray<float>(count);
+			const float* density = reader.ReadArray<float>(count);
+			const float* friction = reader.ReadArray<float>(count);
+			const float* restitution = reader.ReadArray<float>(count);
+			const uint16_t* category = reader.ReadArray<uint16_t>(count);
+			const uint16_t* mask = reader.ReadArray<uint16_t>(count);
+			const int16_t* group = reader.ReadArray<int16_t>(count);
+			const uint32_t* vertexOffsets = reader.ReadArray<uint32_t>(static_cast<size_t>(count) + 1);
+			const float* vertexX = vertexOffsets ? reader.ReadArray<float>(vertexOffsets[count]) : nullptr;
+			const float* vertexY = vertexOffsets ? reader.ReadArray<float>(vertexOffsets[count]) : nullptr;
+			if (reader.Failed() || !ValidIndices(indices, count, entityCount))
+				return fail("COLL");
+
+			std::vector<Pillar::ColliderComponent> components(count);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				if (type[i] > static_cast<uint8_t>(Pillar::ColliderType::Polygon)
+					|| vertexOffsets[i] > vertexOffsets[i + 1] || vertexOffsets[i + 1] > vertexOffsets[count])
+					return fail("COLL");
+
+				auto& c = components[i];
+				c.Type = static_cast<Pillar::ColliderType>(type[i]);
+				c.Offset = { ox[i], oy[i] };
+				if (c.Type == Pillar::ColliderType::Box)
+					c.HalfExtents = { shapeX[i], shapeY[i] };
+				else
+					c.Radius = shapeX[i];
+				c.Density = density[i];
+				c.Friction = friction[i];
+				c.Restitution = restitution[i];
+				c.CategoryBits = category[i];
+				c.MaskBits = mask[i];
+				c.GroupIndex = group[i];
+				c.IsSensor = (flags[i] & Chunks::kColliderFlagSensor) != 0;
+				for (uint32_t v = vertexOffsets[i]; v < vertexOffsets[i + 1]; ++v)
+					c.Vertices.emplace_back(vertexX[v], vertexY[v]);
+			}
+			GatherEntities(entities, indices, count, targets);
+			registry.insert<Pillar::ColliderComponent>(targets.begin(), targets.end(), components.begin());
+		}
+
+		// Remaining components through their registry deserializers, in file order
+		auto& componentRegistry = Pillar::ComponentRegistry::Get();
+		for (const auto& chunk : chunks)
+		{
+			if (chunk.Header.Id != Chunks::kChunkComponentJson)
+				continue;
+
+			const uint32_t count = chunk.Header.Count;
+			ChunkReader reader(chunk.Payload, static_cast<size_t>(chunk.Header.Size));
+			uint32_t keySize = 0;
+			reader.ReadValue(keySize);
+			const char* keyData = reader.ReadArray<char>(keySize);
+			const uint32_t* indices = reader.ReadArray<uint32_t>(count);
+			const uint32_t* offsets = reader.ReadArray<uint32_t>(static_cast<size_t>(count) + 1);
+			const uint8_t* blobs = offsets ? reader.ReadArray<uint8_t>(offsets[count]) : nullptr;
+			if (reader.Failed() || !ValidIndices(indices, count, entityCount))
+				return fail("CJSN");
+
+			const std::string key(keyData, keySize);
+			const Pillar::ComponentRegistration* registration = componentRegistry.GetRegistration(key);
+			if (!registration || !registration->Deserialize)
+			{
+				PIL_CORE_WARN("Chunked scene: no registration for component '{}', skipped", key);
+				continue;
+			}
+
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				if (offsets[i] > offsets[i + 1] || offsets[i + 1] > offsets[count])
+					return fail("CJSN");
+				try
+				{
+					json componentJson = json::from_msgpack(blobs + offsets[i], blobs + offsets[i + 1]);
+					registration->Deserialize(Pillar::Entity(entities[indices[i]], scene), componentJson);
+				}
+				catch (const std::exception& e)
+				{
+					PIL_CORE_ERROR("Chunked scene: failed to load component '{}': {}", key, e.what());
+				}
+			}
+		}
+
+		PIL_CORE_INFO("Scene deserialized from chunks ({} entities, {} chunks)", entityCount, chunks.size());
+		return true;
+	}
 }
 
 namespace Pillar {
@@ -176,7 +1034,8 @@ namespace Pillar {
 			return false;
 		}
 
-		file << std::setw(2) << sceneJson << std::endl;
+		WriteSceneJson(file, sceneJson);
+		file << std::endl;
 		file.close();
 
 		PIL_CORE_INFO("Scene serialized to: {}", fullPath.string());
@@ -216,6 +1075,42 @@ namespace Pillar {
 		return PopulateSceneFromJson(m_Scene, sceneJson);
 	}
 
+	bool SceneSerializer::DeserializeStreaming(const std::string& filepath, const SceneLoadProgressCallback& onProgress)
+	{
+		auto fullPath = ResolveLoadPath(filepath);
+
+		std::ifstream file(fullPath, std::ios::binary);
+		if (!file.is_open())
+		{
+			PIL_CORE_ERROR("Failed to open file for reading: {}", fullPath.string());
+			return false;
+		}
+
+		// Decide on the loader before building anything: migrations rewrite the
+		// document, so they need the DOM path
+		std::string fileVersion = s_CurrentVersion;
+		SceneStreamLoader::ReadFileVersion(file, fileVersion);
+		if (fileVersion != s_CurrentVersion && s_MigrationCallback)
+		{
+			file.close();
+			return Deserialize(filepath);
+		}
+
+		file.clear();
+		file.seekg(0);
+
+		std::error_code ec;
+		auto fileSize = std::filesystem::file_size(fullPath, ec);
+
+		SceneStreamLoader loader(m_Scene);
+		if (!loader.Load(file, ec ? 0 : static_cast<size_t>(fileSize), onProgress))
+			return false;
+
+		if (loader.NeedsMigration())
+			PIL_CORE_WARN("Scene version {} differs from runtime {}; no migration registered", loader.GetFileVersion(), s_CurrentVersion);
+		return true;
+	}
+
 	bool SceneSerializer::SerializeBinary(const std::string& filepath)
 	{
 		json sceneJson = BuildSceneJson(m_Scene);
@@ -284,10 +1179,70 @@ namespace Pillar {
 		return PopulateSceneFromJson(m_Scene, sceneJson);
 	}
 
+	bool SceneSerializer::SerializeChunked(const std::string& filepath)
+	{
+		std::vector<uint8_t> data = BuildSceneChunks(m_Scene);
+		auto fullPath = ResolveSavePath(filepath);
+
+		std::filesystem::path dir = fullPath.parent_path();
+		if (!dir.empty() && !std::filesystem::exists(dir))
+		{
+			try
+			{
+				std::filesystem::create_directories(dir);
+			}
+			catch (const std::filesystem::filesystem_error& e)
+			{
+				PIL_CORE_ERROR("Failed to create directory '{}': {}", dir.string(), e.what());
+				return false;
+			}
+		}
+
+		std::ofstream file(fullPath, std::ios::binary);
+		if (!file.is_open())
+		{
+			PIL_CORE_ERROR("Failed to open file for writing: {}", fullPath.string());
+			return false;
+		}
+
+		file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+		file.close();
+
+		PIL_CORE_INFO("Scene serialized to chunked binary: {} ({} bytes)", fullPath.string(), data.size());
+		return true;
+	}
+
+	bool SceneSerializer::DeserializeChunked(const std::string& filepath)
+	{
+		auto fullPath = ResolveLoadPath(filepath);
+
+		// Chunk arrays are read straight out of the mapping
+		MappedFile file;
+		if (!file.Open(fullPath.string()))
+		{
+			PIL_CORE_ERROR("Failed to open chunked scene: {}", fullPath.string());
+			return false;
+		}
+
+		return PopulateSceneFromChunks(m_Scene, file.Data(), file.Size());
+	}
+
+	std::vector<uint8_t> SceneSerializer::SerializeChunkedToBuffer()
+	{
+		return BuildSceneChunks(m_Scene);
+	}
+
+	bool SceneSerializer::DeserializeChunkedFromMemory(const uint8_t* data, size_t size)
+	{
+		return PopulateSceneFromChunks(m_Scene, data, size);
+	}
+
 	std::string SceneSerializer::SerializeToString()
 	{
 		json sceneJson = BuildSceneJson(m_Scene);
-		return sceneJson.dump(2);
+		std::ostringstream out;
+		WriteSceneJson(out, sceneJson);
+		return out.str();
 	}
 
 	bool SceneSerializer::DeserializeFromString(const std::string& data)
@@ -2,8 +2,12 @@
 
 #include "Pillar/Core.h"
 #include "Scene.h"
+#include "SceneStreamLoader.h"
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <functional>
+#include <vector>
 #include <nlohmann/json_fwd.hpp>
 
 namespace Pillar {
@@ -19,10 +23,23 @@ namespace Pillar {
 		bool Serialize(const std::string& filepath);
 		bool Deserialize(const std::string& filepath);
 
+		// Streaming JSON load (see SceneStreamLoader). Creates entities as they are
+		// parsed instead of building a DOM of the file first; falls back to
+		// Deserialize() when the file needs a migration.
+		bool DeserializeStreaming(const std::string& filepath, const SceneLoadProgressCallback& onProgress = nullptr);
+
 		// Binary serialization (faster, smaller) - for runtime
 		bool SerializeBinary(const std::string& filepath);
 		bool DeserializeBinary(const std::string& filepath);
 
+		// Chunked binary format (cooked runtime scenes, see SceneChunkFormat.h).
+		// Component data is stored per type as SoA arrays; loading memory-maps the
+		// file and bulk-inserts each component type, without building a JSON DOM.
+		bool SerializeChunked(const std::string& filepath);
+		bool DeserializeChunked(const std::string& filepath);
+		std::vector<uint8_t> SerializeChunkedToBuffer();
+		bool DeserializeChunkedFromMemory(const uint8_t* data, size_t size);
+
 		// Serialize to/from string (for network, clipboard, etc.)
 		std::string SerializeToString();
 		bool DeserializeFromString(const std::string& data);
@@ -0,0 +1,165 @@
+#include "SceneSnapshot.h"
+#include "Scene.h"
+#include "ComponentRegistry.h"
+#include "Components/Core/TagComponent.h"
+#include "Components/Core/UUIDComponent.h"
+#include "Components/Core/InactiveTag.h"
+#include "Components/Core/WorldTransformComponent.h"
+#include "Components/Physics/RigidbodyComponent.h"
+#include "Pillar/Logger.h"
+#include <mutex>
+#include <unordered_map>
+
+namespace Pillar {
+
+	namespace {
+
+		struct StorageFactoryTable
+		{
+			std::mutex Mutex;
+			std::unordered_map<entt::id_type, SceneSnapshot::StorageFactory> Factories;
+		};
+
+		StorageFactoryTable& GetStorageFactories()
+		{
+			static StorageFactoryTable table;
+			return table;
+		}
+
+		// Make sure dst has a typed storage for every type the engine knows about,
+		// so untyped pushes from the source storages have somewhere to land
+		void EnsureStorages(entt::registry& registry)
+		{
+			for (const ComponentRegistration* registration : ComponentRegistry::Get().GetRegistrationTable())
+				registration->Storage(registry);
+
+			registry.storage<TagComponent>();
+			registry.storage<UUIDComponent>();
+			registry.storage<InactiveTag>();
+			registry.storage<WorldTransformComponent>();
+		}
+
+		// b2Body pointers belong to the physics world, so rigidbodies are copied
+		// without one (the component isn't copy constructible for that reason)
+		void CopyRigidbodies(entt::registry& src, entt::registry& dst)
+		{
+			const entt::sparse_set& bodies = src.storage<RigidbodyComponent>();
+			for (auto it = bodies.rbegin(), last = bodies.rend(); it != last; ++it)
+			{
+				// Rigidbodies are deleted in place, so removed ones leave tombstones
+				if (*it == entt::tombstone)
+					continue;
+
+				const auto& s = src.get<RigidbodyComponent>(*it);
+				auto& d = dst.emplace<RigidbodyComponent>(*it, s.BodyType);
+				d.FixedRotation = s.FixedRotation;
+				d.GravityScale = s.GravityScale;
+				d.LinearDamping = s.LinearDamping;
+				d.AngularDamping = s.AngularDamping;
+				d.IsBullet = s.IsBullet;
+				d.IsEnabled = s.IsEnabled;
+			}
+		}
+
+	} // namespace
+
+	void SceneSnapshot::RegisterStorageFactory(entt::id_type id, StorageFactory factory)
+	{
+		StorageFactoryTable& table = GetStorageFactories();
+		std::lock_guard<std::mutex> lock(table.Mutex);
+		table.Factories.emplace(id, factory);
+	}
+
+	void SceneSnapshot::Capture(Scene& scene)
+	{
+		CopyRegistry(scene.GetRegistry(), m_Registry);
+		m_Name = scene.GetName();
+		m_FilePath = scene.GetFilePath();
+		m_RandomSeed = scene.GetRandomSeed();
+		m_Captured = true;
+	}
+
+	void SceneSnapshot::Restore(Scene& scene)
+	{
+		if (!m_Captured)
+		{
+			PIL_CORE_WARN("SceneSnapshot: nothing captured, '{}' left unchanged", scene.GetName());
+			return;
+		}
+
+		CopyRegistry(m_Registry, scene.GetRegistry());
+		scene.SetName(m_Name);
+		scene.SetFilePath(m_FilePath);
+		scene.SetRandomSeed(m_RandomSeed);
+	}
+
+	void SceneSnapshot::Clear()
+	{
+		m_Registry.clear();
+		m_Name.clear();
+		m_FilePath.clear();
+		m_RandomSeed = 0;
+		m_Captured = false;
+	}
+
+	size_t SceneSnapshot::GetEntityCount() const
+	{
+		return m_Registry.storage<entt::entity>()->in_use();
+	}
+
+	void SceneSnapshot::CopyRegistry(entt::registry& src, entt::registry& dst)
+	{
+		ComponentRegistry::Get().EnsureBuiltinsRegistered();
+
+		// Destroy signals on dst still run (rigidbody cleanup, lookup indices)
+		dst.clear();
+
+		// Recreate the same identifiers; the hint is always free after clear()
+		src.each([&](entt::entity entity) {
+			dst.create(entity);
+		});
+
+		EnsureStorages(dst);
+
+		const entt::id_type rigidbodyId = entt::type_hash<RigidbodyComponent>::value();
+		for (auto [id, storage] : src.storage())
+		{
+			if (storage.empty() || id == rigidbodyId || storage.type() == entt::type_id<entt::entity>())
+				continue;
+
+			entt::sparse_set* target = dst.storage(id);
+			if (!target)
+			{
+				StorageFactoryTable& table = GetStorageFactories();
+				std::lock_guard<std::mutex> lock(table.Mutex);
+				auto factory = table.Factories.find(id);
+				if (factory != table.Factories.end())
+					target = &factory->second(dst);
+			}
+			if (!target)
+			{
+				PIL_CORE_WARN("SceneSnapshot: no storage for '{}', its components are not copied", storage.type().name());
+				continue;
+			}
+
+			// Reverse iteration walks the packed array front to back, so the copy
+			// keeps the source's packing order
+			for (auto it = storage.rbegin(), last = storage.rend(); it != last; ++it)
+			{
+				if (*it == entt::tombstone)
+					continue;
+
+				// push() copy-constructs from the element; it refuses types that
+				// can't be copied
+				if (target->push(*it, storage.value(*it)) == target->end())
+				{
+					PIL_CORE_WARN("SceneSnapshot: '{}' is not copy constructible, its components are not copied", storage.type().name());
+					break;
+				}
+			}
+		}
+
+		CopyRigidbodies(src, dst);
+	}
+
+} // namespace Pillar
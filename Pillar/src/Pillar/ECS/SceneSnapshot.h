@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <string>
+
+namespace Pillar {
+
+	class Scene;
+
+	/**
+	 * @brief Storage-level copy of a scene's registry, used to enter and leave play mode
+	 *
+	 * Capture() copies every component storage wholesale: entities keep their
+	 * identifiers and each storage keeps its packing order, so nothing that
+	 * refers to an entity (hierarchy parents, editor selection, UUID lookups)
+	 * needs remapping. Restore() clears the live registry and pushes the stored
+	 * components back in place, so the Scene object, and every pointer to it,
+	 * survives the round trip.
+	 *
+	 * Runtime-only handles are not captured: RigidbodyComponent is copied
+	 * field-wise with a null b2Body (bodies are owned by the physics world), and
+	 * AudioSourceComponent's copy constructor drops its playing AudioSource.
+	 * Storages of types that aren't copy constructible are skipped with a warning.
+	 *
+	 * The target registry needs a typed storage for each component type before
+	 * it can take copies. Entity::AddComponent records a storage factory for
+	 * every type it sees, and ComponentRegistry covers the serialized ones; a
+	 * type only ever emplaced straight into the registry needs
+	 * RegisterComponentType<T>() or its components are dropped (with a warning).
+	 */
+	class PIL_API SceneSnapshot
+	{
+	public:
+		SceneSnapshot() = default;
+
+		void Capture(Scene& scene);
+
+		/**
+		 * @brief Replace the scene's entities with the captured ones
+		 *
+		 * The snapshot is left intact, so it can be restored more than once.
+		 * Systems holding runtime state (physics bodies, audio voices) should be
+		 * detached first.
+		 */
+		void Restore(Scene& scene);
+
+		void Clear();
+		bool IsCaptured() const { return m_Captured; }
+		size_t GetEntityCount() const;
+
+		/**
+		 * @brief Clear dst and copy every entity and component storage of src into it
+		 *
+		 * Entity identifiers are preserved. Used by Capture/Restore and Scene::Copy.
+		 */
+		static void CopyRegistry(entt::registry& src, entt::registry& dst);
+
+		/** @brief Let snapshots create T's storage in a registry that has none yet */
+		template<typename T>
+		static void RegisterComponentType()
+		{
+			static const bool registered = (RegisterStorageFactory(entt::type_hash<T>::value(),
+				[](entt::registry& registry) -> entt::sparse_set& { return registry.storage<T>(); }), true);
+			(void)registered;
+		}
+
+		using StorageFactory = entt::sparse_set& (*)(entt::registry&);
+		static void RegisterStorageFactory(entt::id_type id, StorageFactory factory);
+
+	private:
+		entt::registry m_Registry;
+		std::string m_Name;
+		std::string m_FilePath;
+		uint64_t m_RandomSeed = 0;
+		bool m_Captured = false;
+	};
+
+} // namespace Pillar
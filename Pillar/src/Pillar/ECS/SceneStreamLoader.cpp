@@ -0,0 +1,524 @@
+#include "SceneStreamLoader.h"
+#include "Scene.h"
+#include "Entity.h"
+#include "ComponentRegistry.h"
+#include "SceneSerializer.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace {
+
+	constexpr uint32_t kProgressInterval = 4096;
+
+	// Registration resolved once per load. Rank is the registration id, which is
+	// the order PopulateSceneFromJson applies components in.
+	struct ComponentHandle
+	{
+		const std::string* Key = nullptr;
+		const Pillar::ComponentRegistration* Registration = nullptr;
+		uint32_t Rank = 0;
+	};
+
+	struct PendingComponent
+	{
+		const ComponentHandle* Handle;
+		json Data;
+	};
+
+	class SceneSaxHandler : public nlohmann::json_sax<json>
+	{
+	public:
+		SceneSaxHandler(Pillar::Scene* scene, std::istream& stream, size_t totalBytes, const Pillar::SceneLoadProgressCallback& onProgress)
+			: m_Scene(scene), m_Stream(stream), m_TotalBytes(totalBytes), m_OnProgress(onProgress)
+		{
+			const auto& registrations = Pillar::ComponentRegistry::Get().GetRegistrationTable();
+			m_Handles.reserve(registrations.size());
+			for (const Pillar::ComponentRegistration* registration : registrations)
+				m_Handles.push_back({ &registration->Name, registration, registration->Id });
+
+			std::sort(m_Handles.begin(), m_Handles.end(),
+				[](const ComponentHandle& a, const ComponentHandle& b) { return *a.Key < *b.Key; });
+		}
+
+		uint32_t GetEntityCount() const { return m_EntityCount; }
+		const json& GetSceneMeta() const { return m_SceneMeta; }
+
+		void ReportProgress(bool finished = false)
+		{
+			if (!m_OnProgress)
+				return;
+
+			Pillar::SceneLoadProgress progress;
+			progress.TotalBytes = m_TotalBytes;
+			progress.EntitiesLoaded = m_EntityCount;
+			if (finished)
+			{
+				progress.BytesRead = m_TotalBytes;
+			}
+			else
+			{
+				// The SAX input adapter reads the streambuf directly, so its position is the parse position
+				auto pos = m_Stream.rdbuf()->pubseekoff(0, std::ios::cur, std::ios::in);
+				progress.BytesRead = pos >= 0 ? static_cast<size_t>(pos) : 0;
+				if (m_TotalBytes > 0)
+					progress.BytesRead = std::min(progress.BytesRead, m_TotalBytes);
+			}
+			m_OnProgress(progress);
+		}
+
+		// --- json_sax interface -------------------------------------------
+
+		bool null() override { return Value(nullptr); }
+		bool boolean(bool val) override { return Value(val); }
+		bool number_integer(number_integer_t val) override { return Value(val); }
+		bool number_unsigned(number_unsigned_t val) override { return Value(val); }
+		bool number_float(number_float_t val, const string_t&) override { return Value(val); }
+		bool string(string_t& val) override { return Value(std::move(val)); }
+		bool binary(binary_t& val) override { return Value(json::binary(static_cast<binary_t::container_type&>(val))); }
+
+		bool start_object(std::size_t) override
+		{
+			switch (m_State)
+			{
+			case State::Root:
+				m_State = State::TopLevel;
+				return true;
+			case State::Entities:
+				m_State = State::Entity;
+				m_UUID = 0;
+				m_Tag = "Entity";
+				m_KeyCursor = 0;
+				m_Pending.clear();
+				return true;
+			case State::Capture:
+				return BeginContainer(json::object());
+			default:
+				// Object value for a top-level or entity key
+				if (m_State == State::TopLevel && m_Target == Target::Entities)
+				{
+					PIL_CORE_ERROR("Scene JSON: 'entities' must be an array");
+					return false;
+				}
+				BeginCapture();
+				return BeginContainer(json::object());
+			}
+		}
+
+		bool end_object() override
+		{
+			switch (m_State)
+			{
+			case State::Capture:
+				return EndContainer();
+			case State::Entity:
+				FinishEntity();
+				m_State = State::Entities;
+				return true;
+			case State::TopLevel:
+				m_State = State::Done;
+				return true;
+			default:
+				return true;
+			}
+		}
+
+		bool start_array(std::size_t) override
+		{
+			switch (m_State)
+			{
+			case State::TopLevel:
+				if (m_Target == Target::Entities)
+				{
+					m_State = State::Entities;
+					return true;
+				}
+				BeginCapture();
+				return BeginContainer(json::array());
+			case State::Entity:
+				BeginCapture();
+				return BeginContainer(json::array());
+			case State::Capture:
+				return BeginContainer(json::array());
+			case State::Entities:
+				// Non-object entries are skipped
+				BeginCapture();
+				m_Target = Target::Skip;
+				return BeginContainer(json::array());
+			default:
+				PIL_CORE_ERROR("Scene JSON: root must be an object");
+				return false;
+			}
+		}
+
+		bool end_array() override
+		{
+			switch (m_State)
+			{
+			case State::Capture:
+				return EndContainer();
+			case State::Entities:
+				m_State = State::TopLevel;
+				return true;
+			default:
+				return true;
+			}
+		}
+
+		bool key(string_t& val) override
+		{
+			switch (m_State)
+			{
+			case State::Capture:
+				m_CaptureKey = std::move(val);
+				return true;
+			case State::TopLevel:
+				if (val == "entities")
+					m_Target = Target::Entities;
+				else if (val == "scene")
+					m_Target = Target::SceneMeta;
+				else
+					m_Target = Target::Skip;
+				return true;
+			case State::Entity:
+				if (val == "uuid")
+					m_Target = Target::UUID;
+				else if (val == "tag")
+					m_Target = Target::Tag;
+				else
+				{
+					m_Handle = Resolve(val);
+					m_Target = m_Handle ? Target::Component : Target::Skip;
+				}
+				return true;
+			default:
+				return true;
+			}
+		}
+
+		bool parse_error(std::size_t position, const std::string&, const nlohmann::json::exception& ex) override
+		{
+			PIL_CORE_ERROR("JSON parse error at byte {}: {}", position, ex.what());
+			return false;
+		}
+
+	private:
+		enum class State { Root, TopLevel, Entities, Entity, Capture, Done };
+		enum class Target { Skip, SceneMeta, Entities, UUID, Tag, Component };
+
+		// Serialized keys come out of nlohmann's sorted objects, so the next key is
+		// almost always at or just after the cursor.
+		const ComponentHandle* Resolve(const std::string& key)
+		{
+			auto first = m_Handles.begin() + std::min(m_KeyCursor, m_Handles.size());
+			if (first != m_Handles.end() && *first->Key == key)
+			{
+				m_KeyCursor = static_cast<size_t>(first - m_Handles.begin()) + 1;
+				return &*first;
+			}
+
+			auto it = std::lower_bound(first, m_Handles.end(), key,
+				[](const ComponentHandle& h, const std::string& k) { return *h.Key < k; });
+			if (it == m_Handles.end() || *it->Key != key)
+			{
+				it = std::lower_bound(m_Handles.begin(), first, key,
+					[](const ComponentHandle& h, const std::string& k) { return *h.Key < k; });
+				if (it == first || *it->Key != key)
+					return nullptr;
+			}
+
+			m_KeyCursor = static_cast<size_t>(it - m_Handles.begin()) + 1;
+			return &*it;
+		}
+
+		bool Value(json value)
+		{
+			if (m_State == State::Capture)
+			{
+				json& parent = *m_CaptureStack.back();
+				if (parent.is_array())
+					parent.push_back(std::move(value));
+				else
+					parent[m_CaptureKey] = std::move(value);
+				return true;
+			}
+
+			if (m_State == State::Entity || m_State == State::TopLevel)
+				Deliver(std::move(value));
+			return true;
+		}
+
+		void BeginCapture()
+		{
+			m_ReturnState = m_State;
+			m_State = State::Capture;
+			m_Capture = nullptr;
+			m_CaptureStack.clear();
+		}
+
+		bool BeginContainer(json container)
+		{
+			if (m_CaptureStack.empty())
+			{
+				m_Capture = std::move(container);
+				m_CaptureStack.push_back(&m_Capture);
+				return true;
+			}
+
+			// Containers are never moved while open: only closed siblings can
+			// reallocate, which is the same invariant nlohmann's DOM parser relies on.
+			json& parent = *m_CaptureStack.back();
+			if (parent.is_array())
+			{
+				parent.push_back(std::move(container));
+				m_CaptureStack.push_back(&parent.back());
+			}
+			else
+			{
+				json& child = parent[m_CaptureKey];
+				child = std::move(container);
+				m_CaptureStack.push_back(&child);
+			}
+			return true;
+		}
+
+		bool EndContainer()
+		{
+			m_CaptureStack.pop_back();
+			if (m_CaptureStack.empty())
+			{
+				m_State = m_ReturnState;
+				if (m_State == State::Entities)
+					m_Capture = nullptr;    // Skipped non-object entity entry
+				else
+					Deliver(std::move(m_Capture));
+			}
+			return true;
+		}
+
+		void Deliver(json value)
+		{
+			switch (m_Target)
+			{
+			case Target::SceneMeta:
+				m_SceneMeta = std::move(value);
+				break;
+			case Target::UUID:
+				if (value.is_number_unsigned() || value.is_number_integer())
+					m_UUID = value.get<uint64_t>();
+				break;
+			case Target::Tag:
+				if (value.is_string())
+					m_Tag = value.get<std::string>();
+				break;
+			case Target::Component:
+				m_Pending.push_back({ m_Handle, std::move(value) });
+				break;
+			default:
+				break;
+			}
+			m_Target = Target::Skip;
+		}
+
+		void FinishEntity()
+		{
+			Pillar::Entity entity = m_UUID != 0 ?
+				m_Scene->CreateEntityWithUUID(m_UUID, m_Tag) :
+				m_Scene->CreateEntity(m_Tag);
+
+			std::sort(m_Pending.begin(), m_Pending.end(),
+				[](const PendingComponent& a, const PendingComponent& b) { return a.Handle->Rank < b.Handle->Rank; });
+
+			for (auto& pending : m_Pending)
+			{
+				try
+				{
+					pending.Handle->Registration->Deserialize(entity, pending.Data);
+				}
+				catch (const json::exception& e)
+				{
+					PIL_CORE_ERROR("Scene JSON: failed to load component '{}': {}", *pending.Handle->Key, e.what());
+				}
+			}
+			m_Pending.clear();
+
+			if (++m_EntityCount % kProgressInterval == 0)
+				ReportProgress();
+		}
+
+		Pillar::Scene* m_Scene;
+		std::istream& m_Stream;
+		size_t m_TotalBytes;
+		const Pillar::SceneLoadProgressCallback& m_OnProgress;
+
+		std::vector<ComponentHandle> m_Handles;
+		size_t m_KeyCursor = 0;
+
+		State m_State = State::Root;
+		State m_ReturnState = State::Root;
+		Target m_Target = Target::Skip;
+		const ComponentHandle* m_Handle = nullptr;
+
+		json m_Capture;
+		std::vector<json*> m_CaptureStack;
+		std::string m_CaptureKey;
+
+		// Current entity; cleared once it has been created
+		uint64_t m_UUID = 0;
+		std::string m_Tag;
+		std::vector<PendingComponent> m_Pending;
+
+		json m_SceneMeta;
+		uint32_t m_EntityCount = 0;
+	};
+
+	// Walks the top level until "scene" closes, ignoring everything else
+	class SceneVersionScanner : public nlohmann::json_sax<json>
+	{
+	public:
+		bool Found() const { return m_Found; }
+		const std::string& GetVersion() const { return m_Version; }
+
+		bool null() override { return Value(); }
+		bool boolean(bool) override { return Value(); }
+		bool number_integer(number_integer_t) override { return Value(); }
+		bool number_unsigned(number_unsigned_t) override { return Value(); }
+		bool number_float(number_float_t, const string_t&) override { return Value(); }
+		bool binary(binary_t&) override { return Value(); }
+
+		bool string(string_t& val) override
+		{
+			if (m_VersionNext)
+			{
+				m_Version = std::move(val);
+				m_Found = true;
+			}
+			return Value();
+		}
+
+		bool start_object(std::size_t) override
+		{
+			++m_Depth;
+			return Value();
+		}
+
+		bool end_object() override
+		{
+			// Returning false stops the parse once the scene metadata is read
+			return --m_Depth != 1 || !m_InScene;
+		}
+
+		bool start_array(std::size_t) override
+		{
+			++m_Depth;
+			return Value();
+		}
+
+		bool end_array() override
+		{
+			--m_Depth;
+			return true;
+		}
+
+		bool key(string_t& val) override
+		{
+			if (m_Depth == 1)
+				m_InScene = val == "scene";
+			m_VersionNext = m_Depth == 2 && m_InScene && val == "version";
+			return true;
+		}
+
+		bool parse_error(std::size_t, const std::string&, const nlohmann::json::exception&) override
+		{
+			return false;
+		}
+
+	private:
+		bool Value()
+		{
+			m_VersionNext = false;
+			return true;
+		}
+
+		uint32_t m_Depth = 0;
+		bool m_InScene = false;
+		bool m_VersionNext = false;
+		bool m_Found = false;
+		std::string m_Version;
+	};
+
+}
+
+namespace Pillar {
+
+	SceneStreamLoader::SceneStreamLoader(Scene* scene)
+		: m_Scene(scene)
+	{
+	}
+
+	bool SceneStreamLoader::Load(std::istream& stream, size_t totalBytes, const SceneLoadProgressCallback& onProgress)
+	{
+		ComponentRegistry::Get().EnsureBuiltinsRegistered();
+		m_Scene->GetRegistry().clear();
+		m_FileVersion = SceneSerializer::GetCurrentVersion();
+		m_NeedsMigration = false;
+		m_EntityCount = 0;
+
+		SceneSaxHandler handler(m_Scene, stream, totalBytes, onProgress);
+		bool parsed = false;
+		try
+		{
+			parsed = json::sax_parse(stream, &handler);
+		}
+		catch (const json::exception& e)
+		{
+			PIL_CORE_ERROR("Scene JSON stream error: {}", e.what());
+		}
+
+		if (!parsed)
+		{
+			m_Scene->GetRegistry().clear();
+			return false;
+		}
+
+		const json& sceneMeta = handler.GetSceneMeta();
+		if (sceneMeta.is_object())
+		{
+			if (sceneMeta.contains("name") && sceneMeta["name"].is_string())
+				m_Scene->SetName(sceneMeta["name"].get<std::string>());
+			if (sceneMeta.contains("randomSeed") && sceneMeta["randomSeed"].is_number_integer())
+				m_Scene->SetRandomSeed(sceneMeta["randomSeed"].get<uint64_t>());
+			if (sceneMeta.contains("version") && sceneMeta["version"].is_string())
+				m_FileVersion = sceneMeta["version"].get<std::string>();
+		}
+		m_NeedsMigration = m_FileVersion != SceneSerializer::GetCurrentVersion();
+		m_EntityCount = handler.GetEntityCount();
+
+		handler.ReportProgress(true);
+		PIL_CORE_INFO("Scene streamed from JSON ({} entities)", m_EntityCount);
+		return true;
+	}
+
+	bool SceneStreamLoader::ReadFileVersion(std::istream& stream, std::string& version)
+	{
+		SceneVersionScanner scanner;
+		try
+		{
+			json::sax_parse(stream, &scanner);
+		}
+		catch (const json::exception&)
+		{
+			// Load() reports malformed files
+		}
+
+		if (!scanner.Found())
+			return false;
+		version = scanner.GetVersion();
+		return true;
+	}
+
+} // namespace Pillar
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <string>
+
+namespace Pillar {
+
+	class Scene;
+
+	/**
+	 * @brief Progress of a scene load, reported periodically while loading
+	 */
+	struct SceneLoadProgress
+	{
+		size_t BytesRead = 0;
+		size_t TotalBytes = 0;        // 0 if unknown
+		uint32_t EntitiesLoaded = 0;
+
+		float GetFraction() const
+		{
+			return TotalBytes > 0 ? static_cast<float>(BytesRead) / static_cast<float>(TotalBytes) : 0.0f;
+		}
+	};
+
+	using SceneLoadProgressCallback = std::function<void(const SceneLoadProgress&)>;
+
+	/**
+	 * @brief Streams a JSON scene into a Scene without building a DOM of the file
+	 *
+	 * Built on nlohmann::json::sax_parse. Entities are created as soon as their
+	 * closing brace is read, so peak memory is the scene itself plus one entity's
+	 * worth of component JSON, instead of the whole document.
+	 *
+	 * Component keys are resolved once per load into handles (registration
+	 * pointer + the order SceneSerializer applies them in); per entity the loader
+	 * only compares keys against that table, hinted by the previous key since
+	 * serialized keys arrive sorted.
+	 *
+	 * The scene is cleared before parsing starts; on a parse error it is left
+	 * empty. Migrations need the whole document, so callers check
+	 * ReadFileVersion() first and use the DOM loader for files that need one.
+	 * Load() still sets NeedsMigration() if the versions differ.
+	 */
+	class PIL_API SceneStreamLoader
+	{
+	public:
+		explicit SceneStreamLoader(Scene* scene);
+
+		/**
+		 * @brief Parse a JSON scene from a stream
+		 * @param totalBytes Stream size for progress fractions (0 if unknown)
+		 * @param onProgress Called every few thousand entities and once at the end
+		 */
+		bool Load(std::istream& stream, size_t totalBytes = 0, const SceneLoadProgressCallback& onProgress = nullptr);
+
+		/**
+		 * @brief Read "scene"."version" without creating any entities
+		 * @return true if the version was found; `version` is left untouched otherwise
+		 *
+		 * SceneSerializer writes "scene" first, so this stops within the first few
+		 * hundred bytes. Files with "scene" after "entities" are tokenized up to it
+		 * without building anything. The stream is left mid-file; seek back before Load().
+		 */
+		static bool ReadFileVersion(std::istream& stream, std::string& version);
+
+		const std::string& GetFileVersion() const { return m_FileVersion; }
+		bool NeedsMigration() const { return m_NeedsMigration; }
+		uint32_t GetEntityCount() const { return m_EntityCount; }
+
+	private:
+		Scene* m_Scene;
+		std::string m_FileVersion;
+		bool m_NeedsMigration = false;
+		uint32_t m_EntityCount = 0;
+	};
+
+} // namespace Pillar
@@ -16,31 +16,9 @@ void BulletPool::Init(Scene* scene, uint32_t initialCapacity)
 
 	m_Scene = scene;
 
-	// Set up initialization callback to add bullet components
-	m_Pool.SetInitCallback([this](Entity entity) {
-		entity.AddComponent<TransformComponent>();
-		entity.AddComponent<VelocityComponent>();
-		entity.AddComponent<BulletComponent>();
-		// Note: Sprite component will be added when rendering system is implemented
-	});
-
-	// Set up reset callback to reset bullet state when returned to pool
-	m_Pool.SetResetCallback([](Entity entity) {
-		auto& transform = entity.GetComponent<TransformComponent>();
-		transform.Position = glm::vec2(0.0f);
-		transform.Rotation = 0.0f;
-		transform.Dirty = true;
-
-		auto& velocity = entity.GetComponent<VelocityComponent>();
-		velocity.Velocity = glm::vec2(0.0f);
-
-		auto& bullet = entity.GetComponent<BulletComponent>();
-		bullet.TimeAlive = 0.0f;
-		bullet.HitsRemaining = bullet.MaxHits;
-	});
-
-	// Initialize the underlying pool
-	m_Pool.Init(scene, initialCapacity);
+	// Released bullets are reset to default components (TimeAlive 0, HitsRemaining = MaxHits).
+	// Note: Sprite component will be added when rendering system is implemented
+	m_Pool.Init(scene, initialCapacity, true);
 
 	PIL_CORE_INFO("BulletPool initialized with {0} bullets", initialCapacity);
 }
@@ -95,36 +73,9 @@ void ParticlePool::Init(Scene* scene, uint32_t initialCapacity)
 
 	m_Scene = scene;
 
-	// Set up initialization callback
-	m_Pool.SetInitCallback([this](Entity entity) {
-		entity.AddComponent<TransformComponent>();
-		entity.AddComponent<VelocityComponent>();
-		entity.AddComponent<SpriteComponent>();
-		entity.AddComponent<ParticleComponent>();
-	});
-
-	// Set up reset callback
-	m_Pool.SetResetCallback([](Entity entity) {
-		auto& transform = entity.GetComponent<TransformComponent>();
-		transform.Position = glm::vec2(0.0f);
-		transform.Scale = glm::vec2(1.0f);
-		transform.Rotation = 0.0f;
-		transform.Dirty = true;
-
-		auto& velocity = entity.GetComponent<VelocityComponent>();
-		velocity.Velocity = glm::vec2(0.0f);
-		velocity.Acceleration = glm::vec2(0.0f);
-
-		auto& particle = entity.GetComponent<ParticleComponent>();
-		particle.Age = 0.0f;
-		particle.Dead = false;
-
-		auto& sprite = entity.GetComponent<SpriteComponent>();
-		sprite.Color = glm::vec4(1.0f);
-	});
-
-	// Initialize the underlying pool
-	m_Pool.Init(scene, initialCapacity);
+	// Released particles are reset to default components (Age 0, not Dead,
+	// no gradient/curves, white sprite)
+	m_Pool.Init(scene, initialCapacity, true);
 
 	PIL_CORE_INFO("ParticlePool initialized with {0} particles", initialCapacity);
 }
@@ -173,9 +124,87 @@ Entity ParticlePool::SpawnParticle(
 	return particle;
 }
 
+uint32_t ParticlePool::SpawnBatch(const ParticleSpawnBatch& batch, std::vector<Entity>* outEntities)
+{
+	const uint32_t count = batch.Count;
+	if (count == 0)
+		return 0;
+
+	// Reserve all slots up front
+	m_BatchEntities.clear();
+	m_Pool.AcquireBatch(count, m_BatchEntities);
+
+	auto& registry = m_Scene->GetRegistry();
+	auto& transforms = registry.storage<TransformComponent>();
+	auto& velocities = registry.storage<VelocityComponent>();
+	auto& sprites = registry.storage<SpriteComponent>();
+	auto& particles = registry.storage<ParticleComponent>();
+
+	// Commit one component type at a time
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		auto& transform = transforms.get(m_BatchEntities[i]);
+		transform.Position = batch.Positions[i];
+		transform.Scale = glm::vec2(batch.Sizes[i]);
+		transform.Rotation = 0.0f;
+		transform.Dirty = true;
+	}
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		auto& vel = velocities.get(m_BatchEntities[i]);
+		vel.Velocity = batch.Velocities[i];
+		vel.Acceleration = batch.Gravity;
+	}
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		auto& sprite = sprites.get(m_BatchEntities[i]);
+		sprite.Color = batch.Colors[i];
+		sprite.Size = glm::vec2(batch.Sizes[i]);
+	}
+
+	const float rotationSpeed = glm::radians(batch.RotationSpeed);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const glm::vec4& color = batch.Colors[i];
+		const float size = batch.Sizes[i];
+
+		auto& particleComp = particles.get(m_BatchEntities[i]);
+		particleComp.Lifetime = batch.Lifetimes[i];
+		particleComp.Age = 0.0f;
+		particleComp.Dead = false;
+		particleComp.StartColor = color;
+		particleComp.EndColor = glm::vec4(color.r, color.g, color.b, 0.0f);
+		particleComp.FadeOut = batch.FadeOut;
+		particleComp.StartSize = glm::vec2(size);
+		particleComp.EndSize = glm::vec2(size * batch.EndScale);
+		particleComp.ScaleOverTime = batch.ScaleOverTime;
+		particleComp.StartRotation = 0.0f;
+		particleComp.EndRotation = rotationSpeed * batch.Lifetimes[i];
+		particleComp.RotateOverTime = batch.RotateOverTime;
+		particleComp.UseColorGradient = batch.UseColorGradient;
+		particleComp.ColorGradientPtr = batch.ColorGradientPtr;
+		particleComp.SizeCurve = batch.SizeCurve;
+		particleComp.RotationCurve = batch.RotationCurve;
+	}
+
+	if (outEntities)
+		outEntities->insert(outEntities->end(), m_BatchEntities.begin(), m_BatchEntities.end());
+
+	PIL_CORE_TRACE("ParticlePool: Spawned batch of {0} particles", count);
+
+	return count;
+}
+
 void ParticlePool::ReturnParticle(Entity particle)
 {
 	m_Pool.Release(particle);
 }
 
+void ParticlePool::ReturnParticles(const std::vector<Entity>& particles)
+{
+	m_Pool.ReleaseBatch(particles);
+}
+
 } // namespace Pillar
@@ -1,17 +1,24 @@
 #pragma once
 
-#include "ObjectPool.h"
+#include "TypedPool.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
 #include "Pillar/ECS/Components/Physics/VelocityComponent.h"
 #include "Pillar/ECS/Components/Gameplay/BulletComponent.h"
+#include "Pillar/ECS/Components/Gameplay/ParticleComponent.h"
+#include "Pillar/ECS/Components/Rendering/SpriteComponent.h"
+#include <vector>
 
 namespace Pillar {
 
+struct ColorGradient;
+struct AnimationCurve;
+
 /**
  * @brief Specialized object pool for bullet entities
  * 
  * This pool manages bullet entities with all required components pre-attached.
  * Bullets are light entities that use raycasting for collision detection.
+ * Pooled bullets carry InactiveTag and are skipped by the bullet systems.
  * 
  * Note: Rendering components will be added when rendering system is complete.
  */
@@ -66,14 +73,59 @@ public:
 	void Clear() { m_Pool.Clear(); }
 
 private:
-	ObjectPool m_Pool;
+	TypedPool<TransformComponent, VelocityComponent, BulletComponent> m_Pool;
 	Scene* m_Scene = nullptr;
 };
 
+/**
+ * @brief Structure-of-arrays spawn data for ParticlePool::SpawnBatch
+ *
+ * Per-particle attributes live in parallel arrays that are Count long.
+ * The emitter-wide settings are applied to every particle in the batch.
+ */
+struct ParticleSpawnBatch
+{
+	uint32_t Count = 0;
+
+	// Per-particle attributes
+	std::vector<glm::vec2> Positions;
+	std::vector<glm::vec2> Velocities;
+	std::vector<glm::vec4> Colors;
+	std::vector<float> Sizes;
+	std::vector<float> Lifetimes;
+
+	// Emitter-wide parameters
+	glm::vec2 Gravity = glm::vec2(0.0f, -2.0f);
+	bool FadeOut = true;
+	bool ScaleOverTime = false;
+	float EndScale = 0.5f;               // End size multiplier
+	bool RotateOverTime = false;
+	float RotationSpeed = 0.0f;          // Degrees per second
+	bool UseColorGradient = false;
+	ColorGradient* ColorGradientPtr = nullptr;
+	AnimationCurve* SizeCurve = nullptr;
+	AnimationCurve* RotationCurve = nullptr;
+
+	/**
+	 * @brief Size all per-particle arrays for count particles
+	 * Capacity is kept between batches, so steady-state spawning does not allocate.
+	 */
+	void Resize(uint32_t count)
+	{
+		Count = count;
+		Positions.resize(count);
+		Velocities.resize(count);
+		Colors.resize(count);
+		Sizes.resize(count);
+		Lifetimes.resize(count);
+	}
+};
+
 /**
  * @brief Specialized object pool for particle entities
  * 
  * Particles are purely visual light entities with simple physics.
+ * Pooled particles carry InactiveTag and are skipped by update and render systems.
  * 
  * Note: Rendering components will be added when rendering system is complete.
  */
@@ -107,12 +159,29 @@ public:
 		float lifetime = 1.0f
 	);
 
+	/**
+	 * @brief Spawn a whole batch of particles at once
+	 * @param batch Per-particle attributes and shared emitter parameters
+	 * @param outEntities Optional list that receives the spawned entities
+	 * @return Number of particles spawned (batch.Count)
+	 *
+	 * Reserves all pool slots in one go, then writes each component type in
+	 * its own tight loop instead of touching four components per particle.
+	 */
+	uint32_t SpawnBatch(const ParticleSpawnBatch& batch, std::vector<Entity>* outEntities = nullptr);
+
 	/**
 	 * @brief Return a particle to the pool
 	 * @param particle The particle entity to return
 	 */
 	void ReturnParticle(Entity particle);
 
+	/**
+	 * @brief Return many particles to the pool at once
+	 * @param particles The particle entities to return
+	 */
+	void ReturnParticles(const std::vector<Entity>& particles);
+
 	/**
 	 * @brief Get pool statistics
 	 */
@@ -126,8 +195,9 @@ public:
 	void Clear() { m_Pool.Clear(); }
 
 private:
-	ObjectPool m_Pool;
+	TypedPool<TransformComponent, VelocityComponent, SpriteComponent, ParticleComponent> m_Pool;
 	Scene* m_Scene = nullptr;
+	std::vector<Entity> m_BatchEntities; // Scratch list reused by SpawnBatch
 };
 
 } // namespace Pillar
@@ -4,10 +4,19 @@
 #include "Pillar/ECS/Components/Rendering/SpriteComponent.h"
 #include "Pillar/Utils/AnimationLoader.h"
 #include "Pillar/Logger.h"
-#include "Pillar/Renderer/Texture.h"
+#include "Pillar/Utils/Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 
 namespace Pillar {
 
+	namespace {
+		// Shared by every AnimationSystem so a component copied between scenes never
+		// mistakes another library's generation for its own; 0 means "unresolved"
+		std::atomic<uint32_t> s_NextGeneration{ 1 };
+	}
+
 	void AnimationSystem::OnAttach(Scene* scene)
 	{
 		System::OnAttach(scene);
@@ -24,24 +33,27 @@ namespace Pillar {
 
 	void AnimationSystem::OnUpdate(float dt)
 	{
+		PIL_PROFILE_FUNCTION();
+
 		if (!m_Scene)
 			return;
 
+		if (m_Dirty)
+			CompileClips();
+
 		auto& registry = m_Scene->GetRegistry();
 
 		// Query all entities with both AnimationComponent and SpriteComponent
-		auto view = registry.view<AnimationComponent, SpriteComponent>();
-
-		for (auto entity : view)
+		for (auto [entity, anim, sprite] : registry.view<AnimationComponent, SpriteComponent>().each())
 		{
-			UpdateAnimation(entity, dt);
+			UpdateAnimation(anim, sprite, entity, dt);
 		}
 	}
 
 	bool AnimationSystem::LoadAnimationClip(const std::string& filePath)
 	{
 		AnimationClip clip = AnimationLoader::LoadFromJSON(filePath);
-		
+
 		if (!clip.IsValid())
 		{
 			PIL_CORE_ERROR("Failed to load animation clip from: {0}", filePath);
@@ -62,16 +74,44 @@ namespace Pillar {
 		}
 
 		m_AnimationLibrary[clip.Name] = clip;
+		m_Dirty = true;
 	}
 
-	AnimationClip* AnimationSystem::GetClip(const std::string& name)
+	const AnimationClip* AnimationSystem::GetClip(const std::string& name) const
 	{
 		auto it = m_AnimationLibrary.find(name);
-		if (it != m_AnimationLibrary.end())
-		{
-			return &it->second;
-		}
-		return nullptr;
+		return it != m_AnimationLibrary.end() ? &it->second : nullptr;
+	}
+
+	AnimationClip* AnimationSystem::EditClip(const std::string& name)
+	{
+		auto it = m_AnimationLibrary.find(name);
+		if (it == m_AnimationLibrary.end())
+			return nullptr;
+
+		m_Dirty = true;
+		return &it->second;
+	}
+
+	AnimationClipHandle AnimationSystem::GetClipHandle(const std::string& name)
+	{
+		if (m_Dirty)
+			CompileClips();
+
+		auto it = m_ClipHandles.find(name);
+		if (it == m_ClipHandles.end() || m_Clips[it->second].FrameCount == 0)
+			return InvalidAnimationClip;
+		return it->second;
+	}
+
+	bool AnimationSystem::PrefetchClip(const std::string& name)
+	{
+		const AnimationClipHandle handle = GetClipHandle(name);
+		if (handle == InvalidAnimationClip)
+			return false;
+
+		PrefetchTextures(m_Clips[handle]);
+		return true;
 	}
 
 	bool AnimationSystem::HasClip(const std::string& name) const
@@ -82,39 +122,68 @@ namespace Pillar {
 	void AnimationSystem::ClearLibrary()
 	{
 		m_AnimationLibrary.clear();
+		m_Dirty = true;
 	}
 
-	void AnimationSystem::UpdateAnimation(entt::entity entity, float dt)
+	void AnimationSystem::CompileClips()
 	{
-		if (!m_Scene)
-			return;
+		m_FrameEnds.clear();
+		m_FrameUVs.clear();
+		m_FrameTextures.clear();
+		m_Events.clear();
 
-		auto& registry = m_Scene->GetRegistry();
-		
-		// Validate entity exists and has required components
-		if (!registry.valid(entity))
-		{
-			PIL_CORE_WARN("UpdateAnimation: Invalid entity");
-			return;
-		}
-		
-		if (!registry.all_of<AnimationComponent>(entity))
+		// Unloaded clips keep their slot (empty) so outstanding handles stay harmless
+		for (auto& compiled : m_Clips)
+			compiled = CompiledClip{};
+
+		for (const auto& [name, clip] : m_AnimationLibrary)
 		{
-			PIL_CORE_WARN("UpdateAnimation: Entity missing AnimationComponent");
-			return;
+			if (!clip.IsValid())
+				continue;
+
+			auto [handleIt, inserted] = m_ClipHandles.try_emplace(name, static_cast<AnimationClipHandle>(m_Clips.size()));
+			if (inserted)
+				m_Clips.emplace_back();
+
+			CompiledClip& compiled = m_Clips[handleIt->second];
+			compiled.FirstFrame = static_cast<uint32_t>(m_FrameEnds.size());
+			compiled.FrameCount = static_cast<uint32_t>(clip.Frames.size());
+			compiled.Loop = clip.Loop;
+			compiled.PlaybackSpeed = clip.PlaybackSpeed;
+
+			float end = 0.0f;
+			for (const auto& frame : clip.Frames)
+			{
+				end += std::max(frame.Duration, 0.0f);
+				m_FrameEnds.push_back(end);
+				m_FrameUVs.emplace_back(frame.UVMin.x, frame.UVMin.y, frame.UVMax.x, frame.UVMax.y);
+
+				m_FrameTextures.push_back(AssetManager::GetTextureHandle(frame.TexturePath));
+			}
+			compiled.Duration = end;
+
+			compiled.FirstEvent = static_cast<uint32_t>(m_Events.size());
+			for (const auto& event : clip.Events)
+				m_Events.push_back({ event.FrameIndex, event.EventName });
+			compiled.EventCount = static_cast<uint32_t>(m_Events.size()) - compiled.FirstEvent;
 		}
-		
-		if (!registry.all_of<SpriteComponent>(entity))
+
+		m_Generation = s_NextGeneration.fetch_add(1);
+		m_Dirty = false;
+	}
+
+	void AnimationSystem::ResolveClip(AnimationComponent& anim)
+	{
+		anim.ClipGeneration = m_Generation;
+		anim.AppliedFrame = -1;
+		anim.ClipHandle = InvalidAnimationClip;
+		if (auto it = m_ClipHandles.find(anim.CurrentClipName); it != m_ClipHandles.end() && m_Clips[it->second].FrameCount > 0)
 		{
-			PIL_CORE_WARN("UpdateAnimation: Entity missing SpriteComponent");
-			return;
+			anim.ClipHandle = it->second;
+			PrefetchTextures(m_Clips[it->second]);
 		}
-		
-		auto& anim = registry.get<AnimationComponent>(entity);
 
-		// Get the animation clip (even if not playing, to set initial frame)
-		AnimationClip* clip = GetClip(anim.CurrentClipName);
-		if (!clip || !clip->IsValid())
+		if (anim.ClipHandle == InvalidAnimationClip && !anim.CurrentClipName.empty())
 		{
 			// Only log once per invalid clip
 			static std::unordered_map<std::string, bool> s_LoggedErrors;
@@ -123,124 +192,166 @@ namespace Pillar {
 				PIL_CORE_WARN("Animation clip not found: {0}", anim.CurrentClipName);
 				s_LoggedErrors[anim.CurrentClipName] = true;
 			}
+		}
+	}
+
+	void AnimationSystem::PrefetchTextures(CompiledClip& clip)
+	{
+		if (clip.Prefetched)
 			return;
+		clip.Prefetched = true;
+
+		std::vector<TextureHandle> handles;
+		for (uint32_t i = clip.FirstFrame; i < clip.FirstFrame + clip.FrameCount; ++i)
+		{
+			if (m_FrameTextures[i] != InvalidTextureHandle)
+				handles.push_back(m_FrameTextures[i]);
 		}
+		if (!handles.empty())
+			AssetManager::PrefetchTextures(handles);
+	}
+
+	void AnimationSystem::UpdateAnimation(AnimationComponent& anim, SpriteComponent& sprite, entt::entity entity, float dt)
+	{
+		// Unresolved components retry only after the library changes
+		if (anim.ClipGeneration != m_Generation)
+			ResolveClip(anim);
+		if (anim.ClipHandle == InvalidAnimationClip)
+			return;
+
+		const CompiledClip& clip = m_Clips[anim.ClipHandle];
 
 		// Ensure frame index is valid
-		if (anim.FrameIndex >= clip->GetFrameCount())
+		if (static_cast<uint32_t>(anim.FrameIndex) >= clip.FrameCount)
 		{
 			anim.FrameIndex = 0;
 			anim.PlaybackTime = 0.0f;
 		}
 
-		// Get current frame
-		const AnimationFrame& currentFrame = clip->Frames[anim.FrameIndex];
-
-		// ALWAYS update sprite rendering (even when paused, to show correct frame)
-		UpdateSpriteFromFrame(entity, currentFrame);
-
-		// Skip time advancement if not playing
-		if (!anim.IsPlaying())
-			return;
-
-		// Advance playback time
-		anim.PlaybackTime += dt * anim.PlaybackSpeed * clip->PlaybackSpeed;
-
-		// Check if we need to advance to next frame
-		if (anim.PlaybackTime >= currentFrame.Duration)
+		if (anim.Playing)
 		{
-			int oldFrame = anim.FrameIndex;
-			AdvanceFrame(anim, *clip, entity);
-			FireAnimationEvents(anim, *clip, oldFrame, entity);
+			const float time = anim.PlaybackTime + dt * anim.PlaybackSpeed * clip.PlaybackSpeed;
+			const auto frame = static_cast<uint32_t>(anim.FrameIndex);
+			if (time < m_FrameEnds[clip.FirstFrame + frame] - FrameStart(clip, frame))
+				anim.PlaybackTime = time;
+			else
+				AdvanceFrames(anim, clip, time, entity);
+
+			// A callback switched clips; the new one is picked up next update
+			if (anim.ClipGeneration != m_Generation)
+				return;
 		}
+
+		// Sprite writes only when the displayed frame changes (or the editor moved it)
+		if (anim.FrameIndex != anim.AppliedFrame && ApplyFrame(sprite, clip.FirstFrame + static_cast<uint32_t>(anim.FrameIndex)))
+			anim.AppliedFrame = anim.FrameIndex;
 	}
 
-	void AnimationSystem::AdvanceFrame(AnimationComponent& anim, AnimationClip& clip, entt::entity entity)
+	void AnimationSystem::AdvanceFrames(AnimationComponent& anim, const CompiledClip& clip, float time, entt::entity entity)
 	{
-		// Reset playback time for next frame
-		anim.PlaybackTime = 0.0f;
+		const int frameCount = static_cast<int>(clip.FrameCount);
+		const float* ends = m_FrameEnds.data() + clip.FirstFrame;
+		const int oldFrame = anim.FrameIndex;
 
-		// Advance to next frame
-		anim.FrameIndex++;
+		// Position in the clip, then the first frame still running at that position
+		float position = FrameStart(clip, static_cast<uint32_t>(oldFrame)) + time;
+		if (position < clip.Duration)
+		{
+			const int frame = static_cast<int>(std::upper_bound(ends, ends + frameCount, position) - ends);
+			anim.FrameIndex = frame;
+			anim.PlaybackTime = position - FrameStart(clip, static_cast<uint32_t>(frame));
+			FireAnimationEvents(anim, clip, oldFrame, frame, entity);
+			return;
+		}
 
-		// Handle looping or stopping at end
-		if (anim.FrameIndex >= clip.GetFrameCount())
+		// Ran off the end: the rest of this pass has been played. State is settled
+		// before any callback runs, so a callback may start another clip.
+		if (!clip.Loop || clip.Duration <= 0.0f)
 		{
-			if (clip.Loop)
-			{
-				anim.FrameIndex = 0;  // Loop back to start
-			}
-			else
+			anim.FrameIndex = frameCount - 1;  // Stay on last frame
+			anim.PlaybackTime = 0.0f;
+			anim.Playing = clip.Loop;          // Non-looping clips stop
+			FireAnimationEvents(anim, clip, oldFrame, frameCount, entity);
+
+			// Fire completion callback
+			if (!clip.Loop && anim.OnAnimationComplete)
 			{
-				anim.FrameIndex = clip.GetFrameCount() - 1;  // Stay on last frame
-				anim.Playing = false;  // Stop playing
-				
-				// Fire completion callback
-				if (anim.OnAnimationComplete)
-				{
-					anim.OnAnimationComplete(entity);
-				}
+				anim.OnAnimationComplete(entity);
 			}
+			return;
 		}
-	}
 
-	void AnimationSystem::UpdateSpriteFromFrame(entt::entity entity, const AnimationFrame& frame)
-	{
-		if (!m_Scene)
-			return;
+		// Whole loops skipped by a very long delta fire their events once, not once per loop
+		position -= clip.Duration;
+		const bool skippedLoops = position >= clip.Duration;
+		if (skippedLoops)
+			position = std::fmod(position, clip.Duration);
 
-		auto& registry = m_Scene->GetRegistry();
-		auto& sprite = registry.get<SpriteComponent>(entity);
+		const int frame = std::min(static_cast<int>(std::upper_bound(ends, ends + frameCount, position) - ends), frameCount - 1);
+		anim.FrameIndex = frame;
+		anim.PlaybackTime = position - FrameStart(clip, static_cast<uint32_t>(frame));
 
-		// Update texture if needed
-		if (!frame.TexturePath.empty())
-		{
-			// Cache textures to avoid reloading every frame
-			static std::unordered_map<std::string, std::shared_ptr<Texture2D>> s_TextureCache;
+		FireAnimationEvents(anim, clip, oldFrame, frameCount, entity);
+		if (skippedLoops)
+			FireAnimationEvents(anim, clip, 0, frameCount, entity);
+		FireAnimationEvents(anim, clip, 0, frame, entity);
+	}
 
-			auto it = s_TextureCache.find(frame.TexturePath);
-			if (it == s_TextureCache.end())
-			{
-				// Load and cache new texture
-				auto texture = Texture2D::Create(frame.TexturePath);
-				s_TextureCache[frame.TexturePath] = texture;
-				sprite.Texture = texture;
-			}
-			else
-			{
-				sprite.Texture = it->second;
-			}
+	bool AnimationSystem::ApplyFrame(SpriteComponent& sprite, uint32_t frame)
+	{
+		// Update texture if needed; hold the previous frame while it is still loading
+		if (const TextureHandle handle = m_FrameTextures[frame]; handle != InvalidTextureHandle)
+		{
+			auto texture = AssetManager::GetTexture(handle);
+			if (!texture)
+				return false;
+			sprite.Texture = std::move(texture);
 		}
 
 		// Update UV coordinates unless locked by editor
 		if (!sprite.LockUV)
 		{
-			sprite.TexCoordMin = frame.UVMin;
-			sprite.TexCoordMax = frame.UVMax;
+			const glm::vec4& uv = m_FrameUVs[frame];
+			sprite.TexCoordMin = { uv.x, uv.y };
+			sprite.TexCoordMax = { uv.z, uv.w };
 		}
+		return true;
 	}
 
-	void AnimationSystem::FireAnimationEvents(AnimationComponent& anim, AnimationClip& clip, 
-		int oldFrame, entt::entity entity)
+	void AnimationSystem::FireAnimationEvents(AnimationComponent& anim, const CompiledClip& clip,
+		int firstFrame, int endFrame, entt::entity entity)
 	{
-		// Fire all events associated with the frame we just left
-		for (const auto& event : clip.Events)
+		if (clip.EventCount == 0 || !anim.OnAnimationEvent)
+			return;
+
+		// Fire all events associated with the frames we just left
+		for (uint32_t i = clip.FirstEvent; i < clip.FirstEvent + clip.EventCount; ++i)
 		{
-			if (event.FrameIndex == oldFrame)
+			const CompiledEvent& event = m_Events[i];
+			if (event.FrameIndex >= firstFrame && event.FrameIndex < endFrame)
 			{
-				if (anim.OnAnimationEvent)
-				{
-					anim.OnAnimationEvent(event.EventName, entity);
-				}
+				anim.OnAnimationEvent(event.EventName, entity);
 			}
 		}
 	}
 
 	void AnimationSystem::UpdateInEditMode(entt::entity entity, float dt)
 	{
-		// Force update animation regardless of playing state
-		// This is used for edit-mode preview in the editor
-		UpdateAnimation(entity, dt);
+		if (!m_Scene)
+			return;
+
+		auto& registry = m_Scene->GetRegistry();
+		if (!registry.valid(entity) || !registry.all_of<AnimationComponent, SpriteComponent>(entity))
+		{
+			PIL_CORE_WARN("UpdateInEditMode: Entity needs AnimationComponent and SpriteComponent");
+			return;
+		}
+
+		if (m_Dirty)
+			CompileClips();
+
+		// Used for edit-mode preview in the editor
+		UpdateAnimation(registry.get<AnimationComponent>(entity), registry.get<SpriteComponent>(entity), entity, dt);
 	}
 
 	bool AnimationSystem::UnloadClip(const std::string& name)
@@ -250,6 +361,7 @@ namespace Pillar {
 		{
 			PIL_CORE_INFO("Unloaded animation clip: {0}", name);
 			m_AnimationLibrary.erase(it);
+			m_Dirty = true;
 			return true;
 		}
 		return false;
@@ -2,15 +2,19 @@
 
 #include "Pillar/ECS/Systems/System.h"
 #include "Pillar/ECS/Components/Rendering/AnimationClip.h"
+#include "Pillar/ECS/Components/Rendering/AnimationComponent.h"
+#include "Pillar/Utils/AssetManager.h"
+#include <glm/glm.hpp>
 #include <entt/entt.hpp>
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace Pillar {
 
 	// Forward declarations
-	struct AnimationComponent;
+	struct SpriteComponent;
 
 	/**
 	 * @brief System that updates animation playback and manages animation clips
@@ -24,6 +28,17 @@ namespace Pillar {
 	 * 
 	 * The system queries all entities with both AnimationComponent and SpriteComponent,
 	 * then updates their sprite rendering based on the current animation frame.
+	 *
+	 * Registered clips are compiled into flat per-frame tables (cumulative end
+	 * times, UV rects, AssetManager texture handles) addressed by integer clip
+	 * handles. Each component resolves its clip name to a handle once per
+	 * library change, so the per-frame loop does no string lookups. Long deltas
+	 * advance through as many frames (and loops) as they cover, and the sprite
+	 * is only written when the displayed frame changes.
+	 *
+	 * A clip's textures are prefetched on the ThreadPool the first time a
+	 * component plays it; until a frame's texture is ready the sprite keeps
+	 * showing the previous frame.
 	 */
 	class AnimationSystem : public System
 	{
@@ -49,11 +64,35 @@ namespace Pillar {
 		void RegisterClip(const AnimationClip& clip);
 
 		/**
-		 * @brief Get a loaded animation clip by name
+		 * @brief Get a loaded animation clip by name (read-only)
 		 * @param name Name of the animation clip
 		 * @return Pointer to clip if found, nullptr otherwise
 		 */
-		AnimationClip* GetClip(const std::string& name);
+		const AnimationClip* GetClip(const std::string& name) const;
+
+		/**
+		 * @brief Get a loaded animation clip for editing
+		 * @return Pointer to clip if found, nullptr otherwise
+		 *
+		 * Marks the library changed, so the frame tables are recompiled before
+		 * the next update. Use GetClip() for lookups that don't modify the clip.
+		 */
+		AnimationClip* EditClip(const std::string& name);
+
+		/**
+		 * @brief Get the handle of a compiled clip (stable until the clip is unloaded)
+		 * @return InvalidAnimationClip if no clip has that name
+		 */
+		AnimationClipHandle GetClipHandle(const std::string& name);
+
+		/**
+		 * @brief Start loading every texture a clip uses in the background
+		 * @return False if no clip has that name
+		 *
+		 * Playing a clip prefetches it automatically; call this earlier (e.g. on
+		 * level load) to have the textures ready by the first frame.
+		 */
+		bool PrefetchClip(const std::string& name);
 
 		/**
 		 * @brief Check if a clip with the given name exists
@@ -94,26 +133,81 @@ namespace Pillar {
 		void ClearLibrary();
 
 	private:
+		/**
+		 * @brief A clip's slice of the frame and event tables
+		 */
+		struct CompiledClip
+		{
+			uint32_t FirstFrame = 0;
+			uint32_t FrameCount = 0;           // 0 = unloaded slot
+			uint32_t FirstEvent = 0;
+			uint32_t EventCount = 0;
+			float Duration = 0.0f;
+			float PlaybackSpeed = 1.0f;
+			bool Loop = true;
+			bool Prefetched = false;           // Textures requested from AssetManager
+		};
+
+		struct CompiledEvent
+		{
+			int FrameIndex = 0;
+			std::string EventName;
+		};
+
 		std::unordered_map<std::string, AnimationClip> m_AnimationLibrary;
 
+		// Compiled tables; a handle indexes m_Clips and survives recompiles
+		std::unordered_map<std::string, AnimationClipHandle> m_ClipHandles;
+		std::vector<CompiledClip> m_Clips;
+		std::vector<float> m_FrameEnds;             // Cumulative end time of each frame within its clip
+		std::vector<glm::vec4> m_FrameUVs;          // UVMin.xy, UVMax.xy
+		std::vector<TextureHandle> m_FrameTextures; // InvalidTextureHandle = keep the sprite's texture
+		std::vector<CompiledEvent> m_Events;
+
+		uint32_t m_Generation = 0;        // Components resolved against another generation re-resolve
+		bool m_Dirty = true;              // Library changed since the tables were compiled
+
+		/**
+		 * @brief Rebuild the frame tables from the library and start a new generation
+		 */
+		void CompileClips();
+
+		/**
+		 * @brief Look up the component's clip handle by name (once per generation)
+		 */
+		void ResolveClip(AnimationComponent& anim);
+
+		/**
+		 * @brief Request the clip's textures from AssetManager (once per compile)
+		 */
+		void PrefetchTextures(CompiledClip& clip);
+
 		/**
 		 * @brief Update a single entity's animation
 		 */
-		void UpdateAnimation(entt::entity entity, float dt);
+		void UpdateAnimation(AnimationComponent& anim, SpriteComponent& sprite, entt::entity entity, float dt);
 
-	/**
-	 * @brief Advance to the next frame in the animation
-	 */
-	void AdvanceFrame(AnimationComponent& anim, AnimationClip& clip, entt::entity entity);		/**
-		 * @brief Update sprite component UVs and texture from animation frame
+		/**
+		 * @brief Move past the end of the current frame, firing events for every frame left
 		 */
-		void UpdateSpriteFromFrame(entt::entity entity, const AnimationFrame& frame);
+		void AdvanceFrames(AnimationComponent& anim, const CompiledClip& clip, float time, entt::entity entity);
 
 		/**
-		 * @brief Fire animation events for the current frame transition
+		 * @brief Write a frame's UVs and texture to the sprite
+		 * @return False (sprite untouched) while the frame's texture is still loading
 		 */
-		void FireAnimationEvents(AnimationComponent& anim, AnimationClip& clip, 
-			int oldFrame, entt::entity entity);
+		bool ApplyFrame(SpriteComponent& sprite, uint32_t frame);
+
+		/**
+		 * @brief Fire the events of frames [firstFrame, endFrame) of a clip
+		 */
+		void FireAnimationEvents(AnimationComponent& anim, const CompiledClip& clip,
+			int firstFrame, int endFrame, entt::entity entity);
+
+		float FrameStart(const CompiledClip& clip, uint32_t frame) const
+		{
+			return frame == 0 ? 0.0f : m_FrameEnds[clip.FirstFrame + frame - 1];
+		}
 	};
 
 } // namespace Pillar
@@ -4,11 +4,14 @@
 #include "Pillar/ECS/Components/Audio/AudioSourceComponent.h"
 #include "Pillar/ECS/Components/Audio/AudioListenerComponent.h"
 #include "Pillar/Logger.h"
+#include "Pillar/Utils/Profiler.h"
 
 namespace Pillar {
 
     void AudioSystem::OnUpdate(float dt)
     {
+        PIL_PROFILE_FUNCTION();
+
         if (m_Scene)
         {
             entt::registry& registry = m_Scene->GetRegistry();
@@ -45,40 +48,62 @@ namespace Pillar {
     void AudioSystem::UpdateSources(entt::registry& registry)
     {
         auto view = registry.view<AudioSourceComponent>();
-        
+        m_PositionUpdates.clear();
+
+        AudioEngine::BeginUpdateBatch();
         for (auto entity : view)
         {
             auto& audioComp = view.get<AudioSourceComponent>(entity);
             
-            // Initialize source if needed
+            // Initialize source if needed (applies every property)
             if (!audioComp.Source)
             {
                 InitializeSource(registry, entity);
+                continue;
             }
             
-            if (audioComp.Source)
+            if (audioComp.Dirty)
+                ApplyProperties(audioComp, audioComp.Dirty);
+
+            // Only entities that moved since the last push get a new position
+            if (audioComp.Is3D)
             {
-                // Update 3D position if entity has transform
-                if (audioComp.Is3D && registry.all_of<TransformComponent>(entity))
-                {
-                    auto& transform = registry.get<TransformComponent>(entity);
-                    audioComp.Source->SetPosition(glm::vec3(transform.Position, 0.0f));
-                }
-                
-                // Ensure volume, pitch, and looping are up to date
-                audioComp.Source->SetVolume(audioComp.Volume);
-                audioComp.Source->SetPitch(audioComp.Pitch);
-                audioComp.Source->SetLooping(audioComp.Loop);
-                
-                // Set 3D audio properties
-                if (audioComp.Is3D)
+                if (auto* transform = registry.try_get<TransformComponent>(entity))
                 {
-                    audioComp.Source->SetMinDistance(audioComp.MinDistance);
-                    audioComp.Source->SetMaxDistance(audioComp.MaxDistance);
-                    audioComp.Source->SetRolloffFactor(audioComp.RolloffFactor);
+                    if (!audioComp.HasAppliedPosition || transform->Position != audioComp.AppliedPosition)
+                    {
+                        audioComp.AppliedPosition = transform->Position;
+                        audioComp.HasAppliedPosition = true;
+                        m_PositionUpdates.push_back({ audioComp.Source.get(), glm::vec3(transform->Position, 0.0f) });
+                    }
                 }
             }
         }
+
+        for (const auto& update : m_PositionUpdates)
+            update.Source->SetPosition(update.Position);
+        AudioEngine::EndUpdateBatch();
+    }
+
+    void AudioSystem::ApplyProperties(AudioSourceComponent& audioComp, uint8_t flags)
+    {
+        auto& source = *audioComp.Source;
+        if (flags & AudioSourceComponent::DirtyVolume)
+            source.SetVolume(audioComp.Volume);
+        if (flags & AudioSourceComponent::DirtyPitch)
+            source.SetPitch(audioComp.Pitch);
+        if (flags & AudioSourceComponent::DirtyLoop)
+            source.SetLooping(audioComp.Loop);
+
+        // Set 3D audio properties
+        if ((flags & AudioSourceComponent::DirtyAttenuation) && audioComp.Is3D)
+        {
+            source.SetMinDistance(audioComp.MinDistance);
+            source.SetMaxDistance(audioComp.MaxDistance);
+            source.SetRolloffFactor(audioComp.RolloffFactor);
+        }
+
+        audioComp.Dirty &= static_cast<uint8_t>(~flags);
     }
     
     void AudioSystem::InitializeSource(entt::registry& registry, entt::entity entity)
@@ -97,7 +122,10 @@ namespace Pillar {
         // Load audio buffer if file path is specified
         if (!audioComp.AudioFile.empty())
         {
-            auto buffer = AudioBuffer::Create(audioComp.AudioFile);
+            if (!audioComp.Buffer)
+                audioComp.Buffer = AudioEngine::CreateBuffer(audioComp.AudioFile);
+
+            auto& buffer = audioComp.Buffer;
             if (buffer && buffer->IsLoaded())
             {
                 audioComp.Source->SetBuffer(buffer);
@@ -110,22 +138,16 @@ namespace Pillar {
         }
         
         // Apply initial settings
-        audioComp.Source->SetVolume(audioComp.Volume);
-        audioComp.Source->SetPitch(audioComp.Pitch);
-        audioComp.Source->SetLooping(audioComp.Loop);
+        ApplyProperties(audioComp, AudioSourceComponent::DirtyAll);
         
-        // Set 3D audio properties
+        // Set initial position if entity has transform
         if (audioComp.Is3D)
         {
-            audioComp.Source->SetMinDistance(audioComp.MinDistance);
-            audioComp.Source->SetMaxDistance(audioComp.MaxDistance);
-            audioComp.Source->SetRolloffFactor(audioComp.RolloffFactor);
-            
-            // Set initial position if entity has transform
-            if (registry.all_of<TransformComponent>(entity))
+            if (auto* transform = registry.try_get<TransformComponent>(entity))
             {
-                auto& transform = registry.get<TransformComponent>(entity);
-                audioComp.Source->SetPosition(glm::vec3(transform.Position, 0.0f));
+                audioComp.Source->SetPosition(glm::vec3(transform->Position, 0.0f));
+                audioComp.AppliedPosition = transform->Position;
+                audioComp.HasAppliedPosition = true;
             }
         }
         
@@ -3,9 +3,13 @@
 #include "System.h"
 #include "Pillar/Audio/AudioEngine.h"
 #include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <vector>
 
 namespace Pillar {
 
+    struct AudioSourceComponent;
+
     /**
      * @brief System for managing audio sources and listener in ECS
      * 
@@ -15,6 +19,10 @@ namespace Pillar {
      * - Update listener position/orientation from AudioListenerComponent
      * - Handle PlayOnAwake functionality
      * - Apply volume, pitch, looping settings
+     *
+     * Only properties flagged dirty on the component are pushed, and only
+     * entities that moved get a new position. Position updates are gathered
+     * during the walk and sent in one deferred AudioEngine update batch.
      */
     class AudioSystem : public System
     {
@@ -22,9 +30,20 @@ namespace Pillar {
         void OnUpdate(float dt) override;
         
     private:
+        struct PositionUpdate
+        {
+            AudioSource* Source;
+            glm::vec3 Position;
+        };
+
         void UpdateListener(entt::registry& registry);
         void UpdateSources(entt::registry& registry);
         void InitializeSource(entt::registry& registry, entt::entity entity);
+
+        // Push the properties named by flags and clear them from the component
+        static void ApplyProperties(AudioSourceComponent& audioComp, uint8_t flags);
+
+        std::vector<PositionUpdate> m_PositionUpdates;  // Reused every frame
     };
 
 } // namespace Pillar
@@ -3,42 +3,332 @@
 #include "Pillar/ECS/Scene.h"
 #include "Pillar/ECS/Entity.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Core/InactiveTag.h"
 #include "Pillar/ECS/Components/Physics/VelocityComponent.h"
 #include "Pillar/ECS/Components/Gameplay/BulletComponent.h"
+#include "Pillar/Utils/ThreadPool.h"
 #include "Pillar/Logger.h"
+#include "Pillar/Utils/Profiler.h"
 #include <box2d/box2d.h>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <vector>
 
 namespace Pillar {
 
-	// Raycast callback to find the closest hit
-	class BulletRaycastCallback : public b2RayCastCallback
-	{
-	public:
-		BulletRaycastCallback() : m_Hit(false), m_Fraction(1.0f) {}
+	namespace {
+
+		// A fixture child overlapping a group's AABB
+		struct CandidateFixture
+		{
+			const b2Fixture* Fixture = nullptr;
+			int32 ChildIndex = 0;
+			entt::entity Entity = entt::null;
+		};
 
-		float ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float fraction) override
+		// Collects every fixture proxy overlapping the query AABB (one tree traversal per group)
+		struct CandidateCollector
 		{
-			// Store the closest hit
-			if (fraction < m_Fraction)
+			const b2BroadPhase* BroadPhase = nullptr;
+			std::vector<CandidateFixture>* Candidates = nullptr;
+
+			bool QueryCallback(int32 proxyId)
 			{
-				m_Hit = true;
-				m_Fraction = fraction;
-				m_Point = point;
-				m_Normal = normal;
-				m_Fixture = fixture;
+				auto* proxy = static_cast<b2FixtureProxy*>(BroadPhase->GetUserData(proxyId));
+				uintptr_t entityPtr = proxy->fixture->GetBody()->GetUserData().pointer;
+
+				CandidateFixture candidate;
+				candidate.Fixture = proxy->fixture;
+				candidate.ChildIndex = proxy->childIndex;
+				candidate.Entity = static_cast<entt::entity>(static_cast<uint32_t>(entityPtr));
+				Candidates->push_back(candidate);
+				return true;
 			}
+		};
+
+		// Spread the low 32 bits so a zero sits between each (Morton interleave)
+		uint64_t SpreadBits(uint64_t v)
+		{
+			v &= 0xFFFFFFFFull;
+			v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+			v = (v | (v << 8))  & 0x00FF00FF00FF00FFull;
+			v = (v | (v << 4))  & 0x0F0F0F0F0F0F0F0Full;
+			v = (v | (v << 2))  & 0x3333333333333333ull;
+			v = (v | (v << 1))  & 0x5555555555555555ull;
+			return v;
+		}
+
+		uint32_t CellCoord(float value, float invCellSize)
+		{
+			// Bias signed cell index into unsigned space so negative cells sort correctly
+			const double cell = std::floor(static_cast<double>(value) * invCellSize);
+			const double clamped = std::max(-2147483648.0, std::min(2147483647.0, cell));
+			return static_cast<uint32_t>(static_cast<int64_t>(clamped) + 2147483648ll);
+		}
+
+		constexpr uint32_t kNoHit = UINT32_MAX;
+
+		/**
+		 * @brief SoA copy of one group's bullets for the sweep kernels
+		 *
+		 * Each kernel tests every bullet against one fixture in a single branch-free
+		 * loop (conditions combined with '&', results merged with selects), so the
+		 * compiler can vectorize it. Kernels only record the closest fraction and
+		 * the candidate index; hit normals are rebuilt once per hit afterwards.
+		 */
+		struct SweepBatch
+		{
+			std::vector<float> StartX, StartY, DirX, DirY, Radius;
+			std::vector<entt::entity> Owner;
+
+			// Results: closest fraction so far and the candidate that produced it
+			std::vector<float> Best;
+			std::vector<uint32_t> HitIndex;
 
-			// Return fraction to continue raycasting (find closest hit)
-			return fraction;
+			// Normals reported by SweepGeneric (other shapes have analytic normals)
+			std::vector<glm::vec2> GenericNormal;
+
+			// Scratch for SweepPolygon: 1 where a bullet starts overlapping the polygon
+			std::vector<uint8_t> StartsInside;
+
+			size_t Count = 0;
+			float MaxRadius = 0.0f;
+
+			void Resize(size_t count)
+			{
+				Count = count;
+				StartX.resize(count); StartY.resize(count);
+				DirX.resize(count); DirY.resize(count);
+				Radius.resize(count); Owner.resize(count);
+				Best.resize(count); HitIndex.resize(count);
+				GenericNormal.resize(count);
+				StartsInside.resize(count);
+			}
+		};
+
+		// Swept circle vs circle: ray against a circle of radius (shape + bullet).
+		// startsInside (optional) masks out bullets already overlapping the fixture
+		void SweepCircle(SweepBatch& batch, float centerX, float centerY, float shapeRadius, uint32_t candidate, entt::entity entity,
+			const uint8_t* startsInside = nullptr)
+		{
+			const float* startX = batch.StartX.data();
+			const float* startY = batch.StartY.data();
+			const float* dirX = batch.DirX.data();
+			const float* dirY = batch.DirY.data();
+			const float* radii = batch.Radius.data();
+			const entt::entity* owner = batch.Owner.data();
+			float* best = batch.Best.data();
+			uint32_t* hitIndex = batch.HitIndex.data();
+			const size_t count = batch.Count;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float mx = startX[i] - centerX;
+				const float my = startY[i] - centerY;
+				const float dx = dirX[i];
+				const float dy = dirY[i];
+				const float radius = shapeRadius + radii[i];
+
+				const float a = dx * dx + dy * dy;
+				const float b = mx * dx + my * dy;
+				const float c = mx * mx + my * my - radius * radius;
+				const float disc = b * b - a * c;
+				const float t = (-b - std::sqrt(disc > 0.0f ? disc : 0.0f)) / a;
+
+				const bool inside = startsInside ? startsInside[i] != 0 : false;
+
+				// c > 0: start outside; disc >= 0: line reaches the circle
+				const bool hit = (radius > 0.0f) & (c > 0.0f) & (disc >= 0.0f)
+					& (t >= 0.0f) & (t < best[i]) & (owner[i] != entity) & !inside;
+
+				best[i] = hit ? t : best[i];
+				hitIndex[i] = hit ? candidate : hitIndex[i];
+			}
 		}
 
-		bool m_Hit;
-		float m_Fraction;
-		b2Vec2 m_Point;
-		b2Vec2 m_Normal;
-		b2Fixture* m_Fixture = nullptr;
-	};
+		// Swept circle vs convex polygon: faces pushed out by the bullet radius plus
+		// the polygon's skin, and rounded corners (vertex circles of the same radius)
+		void SweepPolygon(SweepBatch& batch, const b2Vec2* vertices, const b2Vec2* normals, int32 vertexCount, float skinRadius,
+			uint32_t candidate, entt::entity entity)
+		{
+			const float* startX = batch.StartX.data();
+			const float* startY = batch.StartY.data();
+			const float* dirX = batch.DirX.data();
+			const float* dirY = batch.DirY.data();
+			const float* radii = batch.Radius.data();
+			const entt::entity* owner = batch.Owner.data();
+			float* best = batch.Best.data();
+			uint32_t* hitIndex = batch.HitIndex.data();
+			uint8_t* startsInside = batch.StartsInside.data();
+			const size_t count = batch.Count;
+
+			// A bullet starts inside when its center is inside the polygon or within
+			// (bullet + skin) radius of an edge; such bullets hit neither faces nor corners
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float radius = radii[i] + skinRadius;
+				bool insideAllPlanes = true;
+				bool nearEdge = false;
+				for (int32 e = 0; e < vertexCount; ++e)
+				{
+					const b2Vec2 v0 = vertices[e];
+					const b2Vec2 v1 = vertices[e + 1 < vertexCount ? e + 1 : 0];
+					const float edgeX = v1.x - v0.x;
+					const float edgeY = v1.y - v0.y;
+					const float px = startX[i] - v0.x;
+					const float py = startY[i] - v0.y;
+					const float u = std::clamp((px * edgeX + py * edgeY) / (edgeX * edgeX + edgeY * edgeY), 0.0f, 1.0f);
+					const float ox = px - edgeX * u;
+					const float oy = py - edgeY * u;
+
+					insideAllPlanes &= normals[e].x * px + normals[e].y * py <= 0.0f;
+					nearEdge |= ox * ox + oy * oy <= radius * radius;
+				}
+				startsInside[i] = static_cast<uint8_t>(insideAllPlanes | nearEdge);
+			}
+
+			for (int32 e = 0; e < vertexCount; ++e)
+			{
+				const b2Vec2 v0 = vertices[e];
+				const b2Vec2 v1 = vertices[e + 1 < vertexCount ? e + 1 : 0];
+				const b2Vec2 n = normals[e];
+				const float edgeX = v1.x - v0.x;
+				const float edgeY = v1.y - v0.y;
+				const float invEdgeLengthSq = 1.0f / (edgeX * edgeX + edgeY * edgeY);
+				const float planeOffset = n.x * v0.x + n.y * v0.y + skinRadius;
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					const float dx = dirX[i];
+					const float dy = dirY[i];
+					const float denom = n.x * dx + n.y * dy;
+					const float dist = n.x * startX[i] + n.y * startY[i] - planeOffset - radii[i];
+					const float t = -dist / denom;
+
+					// Where the circle center crosses the face plane, measured along the edge
+					const float qx = startX[i] + dx * t - v0.x;
+					const float qy = startY[i] + dy * t - v0.y;
+					const float u = (qx * edgeX + qy * edgeY) * invEdgeLengthSq;
+
+					const bool hit = (denom < 0.0f) & (dist >= 0.0f) & (u >= 0.0f) & (u <= 1.0f)
+						& (t < best[i]) & (owner[i] != entity) & (startsInside[i] == 0);
+
+					best[i] = hit ? t : best[i];
+					hitIndex[i] = hit ? candidate : hitIndex[i];
+				}
+			}
+
+			if (batch.MaxRadius > 0.0f || skinRadius > 0.0f)
+			{
+				for (int32 v = 0; v < vertexCount; ++v)
+					SweepCircle(batch, vertices[v].x, vertices[v].y, skinRadius, candidate, entity, startsInside);
+			}
+		}
+
+		// Any other shape (edges, chains): Box2D ray cast or GJK shape cast per bullet
+		void SweepGeneric(SweepBatch& batch, const b2Fixture* fixture, int32 childIndex, uint32_t candidate, entt::entity entity)
+		{
+			const b2Transform& transform = fixture->GetBody()->GetTransform();
+
+			for (size_t i = 0; i < batch.Count; ++i)
+			{
+				if (batch.Owner[i] == entity)
+					continue;
+
+				const b2Vec2 start(batch.StartX[i], batch.StartY[i]);
+				const b2Vec2 dir(batch.DirX[i], batch.DirY[i]);
+				float fraction = 1.0f;
+				b2Vec2 normal;
+
+				if (batch.Radius[i] <= 0.0f)
+				{
+					b2RayCastInput input;
+					input.p1 = start;
+					input.p2 = start + dir;
+					input.maxFraction = batch.Best[i];
+
+					b2RayCastOutput output;
+					if (!fixture->RayCast(&output, input, childIndex))
+						continue;
+					fraction = output.fraction;
+					normal = output.normal;
+				}
+				else
+				{
+					b2CircleShape circle;
+					circle.m_radius = batch.Radius[i];
+
+					b2ShapeCastInput input;
+					input.proxyA.Set(fixture->GetShape(), childIndex);
+					input.proxyB.Set(&circle, 0);
+					input.transformA = transform;
+					input.transformB.Set(start, 0.0f);
+					input.translationB = dir;
+
+					b2ShapeCastOutput output;
+					if (!b2ShapeCast(&output, &input))
+						continue;
+					fraction = output.lambda;
+					normal = output.normal;
+					if (b2Dot(normal, dir) > 0.0f)
+						normal = -normal; // Always face the incoming bullet
+				}
+
+				if (fraction < batch.Best[i])
+				{
+					batch.Best[i] = fraction;
+					batch.HitIndex[i] = candidate;
+					batch.GenericNormal[i] = glm::vec2(normal.x, normal.y);
+				}
+			}
+		}
+
+		// Surface normal at the moment a swept circle (center, radius) touches a candidate
+		glm::vec2 ContactNormal(const b2Fixture* fixture, const glm::vec2& center, const glm::vec2& genericNormal)
+		{
+			const b2Shape* shape = fixture->GetShape();
+			const b2Transform& transform = fixture->GetBody()->GetTransform();
+
+			if (shape->GetType() == b2Shape::e_circle)
+			{
+				const b2Vec2 c = b2Mul(transform, static_cast<const b2CircleShape*>(shape)->m_p);
+				const glm::vec2 offset = center - glm::vec2(c.x, c.y);
+				const float length = glm::length(offset);
+				return length > b2_epsilon ? offset / length : glm::vec2(0.0f, 1.0f);
+			}
+
+			if (shape->GetType() == b2Shape::e_polygon)
+			{
+				// Closest polygon feature: face normal on a face, radial on a corner
+				const auto* polygon = static_cast<const b2PolygonShape*>(shape);
+				float bestDistSq = FLT_MAX;
+				glm::vec2 normal(0.0f, 1.0f);
+				for (int32 e = 0; e < polygon->m_count; ++e)
+				{
+					const b2Vec2 v0 = b2Mul(transform, polygon->m_vertices[e]);
+					const b2Vec2 v1 = b2Mul(transform, polygon->m_vertices[e + 1 < polygon->m_count ? e + 1 : 0]);
+					const glm::vec2 a(v0.x, v0.y);
+					const glm::vec2 edge = glm::vec2(v1.x, v1.y) - a;
+					const float u = glm::clamp(glm::dot(center - a, edge) / glm::dot(edge, edge), 0.0f, 1.0f);
+					const glm::vec2 offset = center - (a + edge * u);
+					const float distSq = glm::dot(offset, offset);
+					if (distSq < bestDistSq)
+					{
+						bestDistSq = distSq;
+						const b2Vec2 face = b2Mul(transform.q, polygon->m_normals[e]);
+						normal = (u > 0.0f && u < 1.0f) || distSq <= b2_epsilon
+							? glm::vec2(face.x, face.y)
+							: offset / std::sqrt(distSq);
+					}
+				}
+				return normal;
+			}
+
+			return genericNormal;
+		}
+
+	} // namespace
 
 	BulletCollisionSystem::BulletCollisionSystem(PhysicsSystem* physicsSystem)
 		: m_PhysicsSystem(physicsSystem)
@@ -47,6 +337,8 @@ namespace Pillar {
 
 	void BulletCollisionSystem::OnUpdate(float deltaTime)
 	{
+		PIL_PROFILE_FUNCTION();
+
 		ProcessBulletLifetime(deltaTime);
 		ProcessBullets(deltaTime);
 	}
@@ -54,7 +346,7 @@ namespace Pillar {
 	void BulletCollisionSystem::ProcessBulletLifetime(float deltaTime)
 	{
 		// Update bullet lifetime and destroy expired bullets
-		auto view = m_Scene->GetRegistry().view<BulletComponent>();
+		auto view = m_Scene->GetRegistry().view<BulletComponent>(entt::exclude<InactiveTag>);
 		std::vector<entt::entity> toDestroy;
 
 		for (auto entity : view)
@@ -78,65 +370,235 @@ namespace Pillar {
 
 	void BulletCollisionSystem::ProcessBullets(float deltaTime)
 	{
-		auto view = m_Scene->GetRegistry().view<TransformComponent, VelocityComponent, BulletComponent>();
+		m_HitCount = 0;
+
+		GatherSegments(deltaTime);
+		BuildGroups();
+
+		m_Hits.assign(m_Segments.size(), BulletHit{});
+		if (m_Segments.empty())
+			return;
+
+		// Raycasts only read the Box2D world, so groups can be cast concurrently
+		if (m_Segments.size() >= m_ParallelThreshold)
+		{
+			ThreadPool::Get().ParallelFor(m_Groups.size(), 4, [this](size_t begin, size_t end) {
+				CastGroups(begin, end);
+			});
+		}
+		else
+		{
+			CastGroups(0, m_Groups.size());
+		}
+
+		ApplyHits();
+	}
+
+	void BulletCollisionSystem::GatherSegments(float deltaTime)
+	{
+		auto view = m_Scene->GetRegistry().view<TransformComponent, VelocityComponent, BulletComponent>(entt::exclude<InactiveTag>);
+		const float invCellSize = 1.0f / m_CellSize;
 
+		m_Segments.clear();
 		for (auto entity : view)
 		{
 			auto& transform = view.get<TransformComponent>(entity);
 			auto& velocity = view.get<VelocityComponent>(entity);
 			auto& bullet = view.get<BulletComponent>(entity);
 
-			// Calculate raycast start and end points
-			glm::vec2 start = transform.Position;
-			glm::vec2 end = transform.Position + velocity.Velocity * deltaTime;
+			BulletSegment segment;
+			segment.Bullet = entity;
+			segment.Owner = static_cast<entt::entity>(bullet.Owner);
+			segment.Component = &bullet;
+			segment.Start = transform.Position;
+			segment.End = transform.Position + velocity.Velocity * deltaTime;
+			segment.Radius = std::max(bullet.Radius, 0.0f);
 
-			// Perform raycast
-			Entity hitEntity;
-			if (RaycastBullet(Entity(entity, m_Scene), start, end, hitEntity))
-			{
-				// Hit detected!
-				PIL_CORE_TRACE("Bullet hit entity!");
+			const glm::vec2 mid = (segment.Start + segment.End) * 0.5f;
+			segment.SortKey = SpreadBits(CellCoord(mid.x, invCellSize))
+				| (SpreadBits(CellCoord(mid.y, invCellSize)) << 1);
 
-				// Decrement hits remaining
-				bullet.HitsRemaining--;
+			m_Segments.push_back(segment);
+		}
+
+		std::sort(m_Segments.begin(), m_Segments.end(), [](const BulletSegment& a, const BulletSegment& b) {
+			return a.SortKey < b.SortKey;
+		});
+	}
 
-				// TODO: Apply damage to hit entity (Phase 6: Health System)
-				// For now, just log the hit
+	void BulletCollisionSystem::BuildGroups()
+	{
+		m_Groups.clear();
+		const float maxExtent = m_CellSize * 2.0f;
+		const uint32_t count = static_cast<uint32_t>(m_Segments.size());
+
+		// Swept bounds of one bullet (segment inflated by its radius)
+		auto sweptMin = [this](uint32_t i) {
+			return glm::min(m_Segments[i].Start, m_Segments[i].End) - glm::vec2(m_Segments[i].Radius);
+		};
+		auto sweptMax = [this](uint32_t i) {
+			return glm::max(m_Segments[i].Start, m_Segments[i].End) + glm::vec2(m_Segments[i].Radius);
+		};
+
+		uint32_t i = 0;
+		while (i < count)
+		{
+			SegmentGroup group;
+			group.Begin = i;
+			group.Min = sweptMin(i);
+			group.Max = sweptMax(i);
+			++i;
+
+			// Grow while the group stays small enough for one shared broadphase query
+			while (i < count && i - group.Begin < m_MaxGroupSize)
+			{
+				const glm::vec2 min = glm::min(group.Min, sweptMin(i));
+				const glm::vec2 max = glm::max(group.Max, sweptMax(i));
+				const glm::vec2 extent = max - min;
+				if (extent.x > maxExtent || extent.y > maxExtent)
+					break;
+
+				group.Min = min;
+				group.Max = max;
+				++i;
 			}
+
+			group.End = i;
+			m_Groups.push_back(group);
 		}
 	}
 
-	bool BulletCollisionSystem::RaycastBullet(Entity bulletEntity, const glm::vec2& start, const glm::vec2& end, Entity& hitEntity)
+	void BulletCollisionSystem::CastGroups(size_t begin, size_t end)
 	{
-		BulletRaycastCallback callback;
-
-		b2Vec2 p1(start.x, start.y);
-		b2Vec2 p2(end.x, end.y);
+		const b2World* world = m_PhysicsSystem->GetWorld();
+		const b2BroadPhase& broadPhase = world->GetContactManager().m_broadPhase;
 
-		m_PhysicsSystem->GetWorld()->RayCast(&callback, p1, p2);
+		thread_local std::vector<CandidateFixture> candidates;
+		thread_local SweepBatch batch;
+		CandidateCollector collector;
+		collector.BroadPhase = &broadPhase;
+		collector.Candidates = &candidates;
 
-		if (callback.m_Hit)
+		for (size_t g = begin; g < end; ++g)
 		{
-			// Get entity from fixture user data
-			b2Body* body = callback.m_Fixture->GetBody();
-			uintptr_t entityPtr = body->GetUserData().pointer;
-			uint32_t entityId = static_cast<uint32_t>(entityPtr);
+			const SegmentGroup& group = m_Groups[g];
+
+			b2AABB groupBounds;
+			groupBounds.lowerBound.Set(group.Min.x, group.Min.y);
+			groupBounds.upperBound.Set(group.Max.x, group.Max.y);
+
+			candidates.clear();
+			broadPhase.Query(&collector, groupBounds);
+			if (candidates.empty())
+				continue;
 
-			// Create Entity from handle
-			entt::entity hitEntityHandle = static_cast<entt::entity>(entityId);
-			hitEntity = Entity(hitEntityHandle, m_Scene);
+			// Load the group's moving bullets into SoA form
+			batch.Resize(group.End - group.Begin);
+			batch.MaxRadius = 0.0f;
+			size_t count = 0;
+			for (uint32_t s = group.Begin; s < group.End; ++s)
+			{
+				const BulletSegment& segment = m_Segments[s];
+				const glm::vec2 delta = segment.End - segment.Start;
+				if (delta.x * delta.x + delta.y * delta.y <= b2_epsilon * b2_epsilon)
+					continue; // Stationary bullet: nothing to sweep
+
+				batch.StartX[count] = segment.Start.x;
+				batch.StartY[count] = segment.Start.y;
+				batch.DirX[count] = delta.x;
+				batch.DirY[count] = delta.y;
+				batch.Radius[count] = segment.Radius;
+				batch.Owner[count] = segment.Owner;
+				batch.Best[count] = 1.0f;
+				batch.HitIndex[count] = kNoHit;
+				batch.MaxRadius = std::max(batch.MaxRadius, segment.Radius);
+				++count;
+			}
+			batch.Count = count;
+			if (count == 0)
+				continue;
 
-			// Don't hit ourselves (bullet owner)
-			auto& bullet = bulletEntity.GetComponent<BulletComponent>();
-			if (hitEntity == bullet.Owner)
+			for (uint32_t c = 0; c < candidates.size(); ++c)
 			{
-				return false;
+				const CandidateFixture& candidate = candidates[c];
+				const b2Shape* shape = candidate.Fixture->GetShape();
+				const b2Transform& transform = candidate.Fixture->GetBody()->GetTransform();
+
+				switch (shape->GetType())
+				{
+				case b2Shape::e_circle:
+				{
+					const auto* circle = static_cast<const b2CircleShape*>(shape);
+					const b2Vec2 center = b2Mul(transform, circle->m_p);
+					SweepCircle(batch, center.x, center.y, circle->m_radius, c, candidate.Entity);
+					break;
+				}
+				case b2Shape::e_polygon:
+				{
+					const auto* polygon = static_cast<const b2PolygonShape*>(shape);
+					b2Vec2 vertices[b2_maxPolygonVertices];
+					b2Vec2 normals[b2_maxPolygonVertices];
+					for (int32 v = 0; v < polygon->m_count; ++v)
+					{
+						vertices[v] = b2Mul(transform, polygon->m_vertices[v]);
+						normals[v] = b2Mul(transform.q, polygon->m_normals[v]);
+					}
+					SweepPolygon(batch, vertices, normals, polygon->m_count, polygon->m_radius, c, candidate.Entity);
+					break;
+				}
+				default:
+					SweepGeneric(batch, candidate.Fixture, candidate.ChildIndex, c, candidate.Entity);
+					break;
+				}
 			}
 
-			return true;
+			// Scatter results back to segment order
+			count = 0;
+			for (uint32_t s = group.Begin; s < group.End; ++s)
+			{
+				const BulletSegment& segment = m_Segments[s];
+				const glm::vec2 delta = segment.End - segment.Start;
+				if (delta.x * delta.x + delta.y * delta.y <= b2_epsilon * b2_epsilon)
+					continue;
+
+				const size_t i = count++;
+				if (batch.HitIndex[i] == kNoHit)
+					continue;
+
+				const CandidateFixture& candidate = candidates[batch.HitIndex[i]];
+				const float fraction = batch.Best[i];
+				const glm::vec2 center = segment.Start + delta * fraction;
+				const glm::vec2 normal = ContactNormal(candidate.Fixture, center, batch.GenericNormal[i]);
+
+				BulletHit& hit = m_Hits[s];
+				hit.Hit = true;
+				hit.Target = candidate.Entity;
+				hit.Fraction = fraction;
+				hit.Normal = normal;
+				hit.Point = center - normal * segment.Radius; // Contact on the bullet's rim
+			}
 		}
+	}
 
-		return false;
+	void BulletCollisionSystem::ApplyHits()
+	{
+		for (size_t i = 0; i < m_Segments.size(); ++i)
+		{
+			if (!m_Hits[i].Hit)
+				continue;
+
+			// Hit detected!
+			PIL_CORE_TRACE("Bullet hit entity!");
+			++m_HitCount;
+
+			// Decrement hits remaining
+			BulletComponent& bullet = *m_Segments[i].Component;
+			if (bullet.HitsRemaining > 0)
+				bullet.HitsRemaining--;
+
+			// TODO: Apply damage to hit entity (Phase 6: Health System)
+			// For now, just log the hit
+		}
 	}
 
 } // namespace Pillar
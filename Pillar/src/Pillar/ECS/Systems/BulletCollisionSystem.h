@@ -2,16 +2,33 @@
 
 #include "Pillar/Core.h"
 #include "System.h"
+#include <entt/entt.hpp>
 #include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace Pillar {
 
 	class PhysicsSystem; // Forward declaration
-	class Entity;
+	struct BulletComponent;
 
 	// Uses Box2D Raycasts to detect bullet hits against Heavy Entities
 	// Does NOT use b2Bodies for bullets (they're Light Entities)
+	//
+	// Bullets are cast as a batch each frame:
+	//   1. Gather one segment per bullet (position -> position + velocity * dt)
+	//   2. Sort segments by Morton code of their grid cell and cut them into
+	//      spatially compact groups
+	//   3. Query the Box2D broadphase tree once per group, then sweep every bullet
+	//      in the group against each candidate fixture (read-only, so groups run
+	//      on ThreadPool workers)
+	//   4. Apply hits serially (HitsRemaining, damage hooks)
+	//
+	// Bullets with a Radius are swept circles (continuous collision): circle and
+	// polygon/box fixtures use analytic tests over SoA bullet arrays, other shapes
+	// fall back to b2ShapeCast. Radius 0 is a thin ray, as with b2World::RayCast.
+	// Bullets starting inside a fixture don't hit it.
 	class PIL_API BulletCollisionSystem : public System
 	{
 	public:
@@ -19,12 +36,70 @@ namespace Pillar {
 
 		void OnUpdate(float deltaTime) override;
 
+		// Grid cell size used to sort bullets spatially; groups never span more than 2x2 cells
+		void SetCellSize(float cellSize) { m_CellSize = cellSize > 0.0f ? cellSize : 1.0f; }
+		float GetCellSize() const { return m_CellSize; }
+
+		// Maximum bullets sharing one broadphase query
+		void SetMaxGroupSize(uint32_t size) { m_MaxGroupSize = size > 0 ? size : 1; }
+		uint32_t GetMaxGroupSize() const { return m_MaxGroupSize; }
+
+		// Batches smaller than this are cast on the calling thread
+		void SetParallelThreshold(size_t bulletCount) { m_ParallelThreshold = bulletCount; }
+		size_t GetParallelThreshold() const { return m_ParallelThreshold; }
+
+		// Stats from the last update
+		uint32_t GetHitCount() const { return m_HitCount; }
+		uint32_t GetGroupCount() const { return static_cast<uint32_t>(m_Groups.size()); }
+
 	private:
+		struct BulletSegment
+		{
+			entt::entity Bullet = entt::null;
+			entt::entity Owner = entt::null;
+			BulletComponent* Component = nullptr;
+			glm::vec2 Start{ 0.0f };
+			glm::vec2 End{ 0.0f };
+			float Radius = 0.0f;
+			uint64_t SortKey = 0;
+		};
+
+		struct SegmentGroup
+		{
+			uint32_t Begin = 0;
+			uint32_t End = 0;
+			glm::vec2 Min{ 0.0f };
+			glm::vec2 Max{ 0.0f };
+		};
+
+		struct BulletHit
+		{
+			entt::entity Target = entt::null;
+			float Fraction = 1.0f;
+			glm::vec2 Point{ 0.0f };
+			glm::vec2 Normal{ 0.0f };
+			bool Hit = false;
+		};
+
 		PhysicsSystem* m_PhysicsSystem;
 
+		float m_CellSize = 8.0f;
+		uint32_t m_MaxGroupSize = 64;
+		size_t m_ParallelThreshold = 1024;
+		uint32_t m_HitCount = 0;
+
+		// Per-frame scratch (kept to avoid reallocating every frame)
+		std::vector<BulletSegment> m_Segments;
+		std::vector<SegmentGroup> m_Groups;
+		std::vector<BulletHit> m_Hits;
+
 		void ProcessBullets(float deltaTime);
 		void ProcessBulletLifetime(float deltaTime);
-		bool RaycastBullet(Entity bulletEntity, const glm::vec2& start, const glm::vec2& end, Entity& hitEntity);
+
+		void GatherSegments(float deltaTime);
+		void BuildGroups();
+		void CastGroups(size_t begin, size_t end);
+		void ApplyHits();
 	};
 
 } // namespace Pillar
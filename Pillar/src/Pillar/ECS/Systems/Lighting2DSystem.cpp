@@ -5,11 +5,14 @@
 #include "Pillar/ECS/Components/Rendering/Light2DComponent.h"
 #include "Pillar/ECS/Components/Rendering/ShadowCaster2DComponent.h"
 #include "Pillar/Renderer/Lighting2D.h"
+#include "Pillar/Utils/Profiler.h"
 
 namespace Pillar
 {
 	void Lighting2DSystem::OnUpdate(float dt)
 	{
+		PIL_PROFILE_FUNCTION();
+
 		if (!m_Scene)
 			return;
 
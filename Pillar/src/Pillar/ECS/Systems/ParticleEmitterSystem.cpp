@@ -3,10 +3,11 @@
 #include "Pillar/ECS/Entity.h"
 #include "Pillar/ECS/SpecializedPools.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Core/UUIDComponent.h"
 #include "Pillar/ECS/Components/Gameplay/ParticleEmitterComponent.h"
 #include "Pillar/Logger.h"
-#include "Pillar/Utils/Random.h"
 #include "Pillar/Utils/Math2D.h"
+#include "Pillar/Utils/Profiler.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
 #include <cmath>
@@ -15,6 +16,8 @@ namespace Pillar {
 
 	void ParticleEmitterSystem::OnUpdate(float dt)
 	{
+		PIL_PROFILE_FUNCTION();
+
 		if (!m_Scene || !m_ParticlePool)
 			return;
 
@@ -22,7 +25,8 @@ namespace Pillar {
 		m_ParticlesSpawned = 0;
 
 		// Process all emitters
-		auto view = m_Scene->GetRegistry().view<ParticleEmitterComponent, TransformComponent>();
+		auto& registry = m_Scene->GetRegistry();
+		auto view = registry.view<ParticleEmitterComponent, TransformComponent>();
 
 		for (auto entityHandle : view)
 		{
@@ -34,37 +38,18 @@ namespace Pillar {
 
 			m_EmitterCount++;
 
+			// Stable per-emitter ID for deterministic seeding
+			const auto* uuid = registry.try_get<UUIDComponent>(entityHandle);
+			const uint64_t emitterID = uuid ? uuid->UUID : static_cast<uint64_t>(entt::to_integral(entityHandle));
+
 			// Handle burst mode
 			if (emitter.BurstMode)
 			{
 				if (!emitter.BurstFired)
 				{
 					// Spawn all particles at once
-					for (int i = 0; i < emitter.BurstCount; ++i)
-					{
-						glm::vec2 position = CalculateEmissionPosition(transform.Position, emitter);
-						glm::vec2 velocity = CalculateEmissionVelocity(emitter);
-
-						// Randomize lifetime
-						float lifetime = emitter.Lifetime + Random::Float(-emitter.LifetimeVariance, emitter.LifetimeVariance);
-						lifetime = glm::max(0.1f, lifetime);
-
-						// Randomize size
-						float size = emitter.Size + Random::Float(-emitter.SizeVariance, emitter.SizeVariance);
-						size = glm::max(0.01f, size);
-
-						// Randomize color
-						glm::vec4 color = emitter.StartColor;
-						color.r += Random::Float(-emitter.ColorVariance.r, emitter.ColorVariance.r);
-						color.g += Random::Float(-emitter.ColorVariance.g, emitter.ColorVariance.g);
-						color.b += Random::Float(-emitter.ColorVariance.b, emitter.ColorVariance.b);
-						color.a += Random::Float(-emitter.ColorVariance.a, emitter.ColorVariance.a);
-						color = glm::clamp(color, 0.0f, 1.0f);
-
-						// Spawn particle
-						m_ParticlePool->SpawnParticle(position, velocity, color, size, lifetime);
-						m_ParticlesSpawned++;
-					}
+					if (emitter.BurstCount > 0)
+						SpawnBatch(emitter, emitterID, transform.Position, static_cast<uint32_t>(emitter.BurstCount));
 
 					emitter.BurstFired = true;
 					PIL_CORE_TRACE("ParticleEmitterSystem: Burst fired ({} particles)", emitter.BurstCount);
@@ -76,7 +61,7 @@ namespace Pillar {
 				emitter.EmissionTimer += dt;
 
 				float emissionInterval = 1.0f / emitter.EmissionRate;
-				int particlesToSpawn = 0;
+				uint32_t particlesToSpawn = 0;
 
 				// Calculate how many particles to spawn this frame
 				while (emitter.EmissionTimer >= emissionInterval)
@@ -85,93 +70,129 @@ namespace Pillar {
 					emitter.EmissionTimer -= emissionInterval;
 				}
 
-				// Spawn particles
-				for (int i = 0; i < particlesToSpawn; ++i)
-				{
-					glm::vec2 position = CalculateEmissionPosition(transform.Position, emitter);
-					glm::vec2 velocity = CalculateEmissionVelocity(emitter);
-
-					// Randomize lifetime
-					float lifetime = emitter.Lifetime + Random::Float(-emitter.LifetimeVariance, emitter.LifetimeVariance);
-					lifetime = glm::max(0.1f, lifetime);
-
-					// Randomize size
-					float size = emitter.Size + Random::Float(-emitter.SizeVariance, emitter.SizeVariance);
-					size = glm::max(0.01f, size);
-
-					// Randomize color
-					glm::vec4 color = emitter.StartColor;
-					color.r += Random::Float(-emitter.ColorVariance.r, emitter.ColorVariance.r);
-					color.g += Random::Float(-emitter.ColorVariance.g, emitter.ColorVariance.g);
-					color.b += Random::Float(-emitter.ColorVariance.b, emitter.ColorVariance.b);
-					color.a += Random::Float(-emitter.ColorVariance.a, emitter.ColorVariance.a);
-					color = glm::clamp(color, 0.0f, 1.0f);
-
-					// Spawn particle
-					m_ParticlePool->SpawnParticle(position, velocity, color, size, lifetime);
-					m_ParticlesSpawned++;
-				}
+				if (particlesToSpawn > 0)
+					SpawnBatch(emitter, emitterID, transform.Position, particlesToSpawn);
 			}
 		}
 	}
 
-	glm::vec2 ParticleEmitterSystem::CalculateEmissionPosition(const glm::vec2& basePos, const ParticleEmitterComponent& emitter)
+	void ParticleEmitterSystem::SpawnBatch(ParticleEmitterComponent& emitter, uint64_t emitterID, const glm::vec2& basePos, uint32_t count)
 	{
-		switch (emitter.Shape)
+		const uint64_t emitterSeed = RandomStream::DeriveSeed(m_Scene->GetRandomSeed(), emitterID);
+		m_Random.Seed(RandomStream::DeriveSeed(emitterSeed, emitter.SpawnSequence++));
+
+		m_Batch.Resize(count);
+
+		FillEmissionPositions(basePos, emitter);
+		FillEmissionVelocities(emitter);
+
+		// Randomize lifetime
+		const float* lifetimeJitter = FillVariance(m_RandomA, emitter.LifetimeVariance);
+		for (uint32_t i = 0; i < count; ++i)
+			m_Batch.Lifetimes[i] = glm::max(0.1f, emitter.Lifetime + lifetimeJitter[i]);
+
+		// Randomize size
+		const float* sizeJitter = FillVariance(m_RandomA, emitter.SizeVariance);
+		for (uint32_t i = 0; i < count; ++i)
+			m_Batch.Sizes[i] = glm::max(0.01f, emitter.Size + sizeJitter[i]);
+
+		// Randomize color, one channel at a time
+		for (uint32_t i = 0; i < count; ++i)
+			m_Batch.Colors[i] = emitter.StartColor;
+
+		for (int channel = 0; channel < 4; ++channel)
 		{
-		case EmissionShape::Point:
-			return basePos;
+			const float* jitter = FillVariance(m_RandomA, emitter.ColorVariance[channel]);
+			for (uint32_t i = 0; i < count; ++i)
+				m_Batch.Colors[i][channel] = glm::clamp(m_Batch.Colors[i][channel] + jitter[i], 0.0f, 1.0f);
+		}
+
+		// Emitter-wide settings
+		m_Batch.Gravity = emitter.Gravity;
+		m_Batch.FadeOut = emitter.FadeOut;
+		m_Batch.ScaleOverTime = emitter.ScaleOverTime;
+		m_Batch.EndScale = emitter.EndScale;
+		m_Batch.RotateOverTime = emitter.RotateOverTime;
+		m_Batch.RotationSpeed = emitter.RotationSpeed;
+		m_Batch.UseColorGradient = emitter.UseColorGradient;
+		m_Batch.ColorGradientPtr = emitter.ColorGradientPtr;
+		m_Batch.SizeCurve = emitter.SizeCurvePtr;
+		m_Batch.RotationCurve = emitter.RotationCurvePtr;
+
+		m_ParticlesSpawned += m_ParticlePool->SpawnBatch(m_Batch);
+	}
 
+	void ParticleEmitterSystem::FillEmissionPositions(const glm::vec2& basePos, const ParticleEmitterComponent& emitter)
+	{
+		const uint32_t count = m_Batch.Count;
+		glm::vec2* positions = m_Batch.Positions.data();
+
+		switch (emitter.Shape)
+		{
 		case EmissionShape::Circle:
 		{
 			// Random angle and radius for circle emission
-			float angle = Random::AngleRadians();
-			float radius = Random::Float(0.0f, emitter.ShapeSize.x);
-			return basePos + glm::vec2(cos(angle), sin(angle)) * radius;
+			m_RandomA.resize(count);
+			m_RandomB.resize(count);
+			m_Random.FillAngles(m_RandomA.data(), count);
+			m_Random.FillFloat(m_RandomB.data(), count, 0.0f, emitter.ShapeSize.x);
+			for (uint32_t i = 0; i < count; ++i)
+				positions[i] = basePos + glm::vec2(std::cos(m_RandomA[i]), std::sin(m_RandomA[i])) * m_RandomB[i];
+			break;
 		}
 
 		case EmissionShape::Box:
 		{
 			// Random position within box
-			float x = Random::Float(-emitter.ShapeSize.x * 0.5f, emitter.ShapeSize.x * 0.5f);
-			float y = Random::Float(-emitter.ShapeSize.y * 0.5f, emitter.ShapeSize.y * 0.5f);
-			return basePos + glm::vec2(x, y);
+			const float* x = FillVariance(m_RandomA, emitter.ShapeSize.x * 0.5f);
+			const float* y = FillVariance(m_RandomB, emitter.ShapeSize.y * 0.5f);
+			for (uint32_t i = 0; i < count; ++i)
+				positions[i] = basePos + glm::vec2(x[i], y[i]);
+			break;
 		}
 
+		case EmissionShape::Point:
 		case EmissionShape::Cone:
-		{
-			// Emit from point but with cone-shaped velocity spread
-			// (position is still the point, but velocity varies more)
-			return basePos;
-		}
-
 		default:
-			return basePos;
+			// Cone emits from a point; only its velocity spread differs
+			for (uint32_t i = 0; i < count; ++i)
+				positions[i] = basePos;
+			break;
 		}
 	}
 
-	glm::vec2 ParticleEmitterSystem::CalculateEmissionVelocity(const ParticleEmitterComponent& emitter)
+	void ParticleEmitterSystem::FillEmissionVelocities(const ParticleEmitterComponent& emitter)
 	{
-		// Base direction
-		glm::vec2 baseDir = Math2D::SafeNormalize(emitter.Direction);
+		const uint32_t count = m_Batch.Count;
+		glm::vec2* velocities = m_Batch.Velocities.data();
 
-		// Add random spread
-		float spreadRadians = glm::radians(emitter.DirectionSpread);
-		float randomAngle = Random::Float(-spreadRadians, spreadRadians);
+		// Base direction
+		const glm::vec2 baseDir = Math2D::SafeNormalize(emitter.Direction);
 
-		// Rotate base direction by random angle
-		float cosA = cos(randomAngle);
-		float sinA = sin(randomAngle);
-		glm::vec2 rotatedDir = glm::vec2(
-			baseDir.x * cosA - baseDir.y * sinA,
-			baseDir.x * sinA + baseDir.y * cosA
-		);
+		// Random spread and speed variance for the whole batch
+		const float* angles = FillVariance(m_RandomA, glm::radians(emitter.DirectionSpread));
+		const float* speedJitter = FillVariance(m_RandomB, emitter.SpeedVariance);
 
-		// Add random speed variance
-		float speed = emitter.Speed + Random::Float(-emitter.SpeedVariance, emitter.SpeedVariance);
-		speed = glm::max(0.1f, speed);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			// Rotate base direction by random angle
+			const float cosA = std::cos(angles[i]);
+			const float sinA = std::sin(angles[i]);
+			const glm::vec2 rotatedDir(
+				baseDir.x * cosA - baseDir.y * sinA,
+				baseDir.x * sinA + baseDir.y * cosA
+			);
+
+			const float speed = glm::max(0.1f, emitter.Speed + speedJitter[i]);
+			velocities[i] = rotatedDir * speed;
+		}
+	}
 
-		return rotatedDir * speed;
+	float* ParticleEmitterSystem::FillVariance(std::vector<float>& scratch, float variance)
+	{
+		scratch.resize(m_Batch.Count);
+		m_Random.FillFloat(scratch.data(), scratch.size(), -variance, variance);
+		return scratch.data();
 	}
 
 } // namespace Pillar
@@ -2,12 +2,15 @@
 
 #include "Pillar/Core.h"
 #include "System.h"
+#include "Pillar/ECS/SpecializedPools.h"
+#include "Pillar/Utils/RandomStream.h"
 #include <glm/glm.hpp>
 #include <cstdint>
+#include <vector>
 
 namespace Pillar {
 
-	class ParticlePool; // Forward declaration
+	struct ParticleEmitterComponent;
 
 	/**
 	 * @brief System that manages particle emitters and spawns particles
@@ -19,6 +22,14 @@ namespace Pillar {
 	 * - Randomization of particle properties
 	 * - Spawning particles via ParticlePool
 	 * 
+	 * Particles are generated in batches: all random numbers for a batch are
+	 * drawn up front into flat arrays, attributes are built in tight loops
+	 * and the whole batch is committed through ParticlePool::SpawnBatch.
+	 *
+	 * Each batch draws from a RandomStream seeded by the scene seed, the
+	 * emitter's UUID and its SpawnSequence, so emission is reproducible
+	 * regardless of emitter iteration order.
+	 *
 	 * Phase 2 Implementation
 	 */
 	class PIL_API ParticleEmitterSystem : public System
@@ -44,19 +55,35 @@ namespace Pillar {
 
 	private:
 		/**
-		 * @brief Calculate emission position based on shape
+		 * @brief Build and commit a batch of count particles for one emitter
 		 */
-		glm::vec2 CalculateEmissionPosition(const glm::vec2& basePos, const class ParticleEmitterComponent& emitter);
+		void SpawnBatch(ParticleEmitterComponent& emitter, uint64_t emitterID, const glm::vec2& basePos, uint32_t count);
 
 		/**
-		 * @brief Calculate emission velocity with randomization
+		 * @brief Fill batch positions based on emission shape
 		 */
-		glm::vec2 CalculateEmissionVelocity(const class ParticleEmitterComponent& emitter);
+		void FillEmissionPositions(const glm::vec2& basePos, const ParticleEmitterComponent& emitter);
+
+		/**
+		 * @brief Fill batch velocities with direction spread and speed variance
+		 */
+		void FillEmissionVelocities(const ParticleEmitterComponent& emitter);
+
+		/**
+		 * @brief Fill scratch with count random floats in [-variance, variance]
+		 */
+		float* FillVariance(std::vector<float>& scratch, float variance);
 
 	private:
 		ParticlePool* m_ParticlePool = nullptr;
 		uint32_t m_EmitterCount = 0;
 		uint32_t m_ParticlesSpawned = 0;
+
+		// Reused between frames so spawning does not allocate in steady state
+		ParticleSpawnBatch m_Batch;
+		RandomStream m_Random;
+		std::vector<float> m_RandomA;
+		std::vector<float> m_RandomB;
 	};
 
 } // namespace Pillar
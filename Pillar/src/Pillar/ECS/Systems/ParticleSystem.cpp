@@ -3,48 +3,48 @@
 #include "Pillar/ECS/Entity.h"
 #include "Pillar/ECS/SpecializedPools.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Core/InactiveTag.h"
 #include "Pillar/ECS/Components/Gameplay/ParticleComponent.h"
 #include "Pillar/ECS/Components/Gameplay/ParticleAnimationCurves.h"
 #include "Pillar/ECS/Components/Rendering/SpriteComponent.h"
 #include "Pillar/Logger.h"
+#include "Pillar/Utils/Profiler.h"
 #include <glm/glm.hpp>
+#include <algorithm>
 
 namespace Pillar {
 
 	void ParticleSystem::OnUpdate(float dt)
 	{
+		PIL_PROFILE_FUNCTION();
+
 		if (!m_Scene)
 			return;
 
 		m_ActiveCount = 0;
 		m_DeadCount = 0;
 
-		// Update all particles
-		auto view = m_Scene->GetRegistry().view<ParticleComponent, TransformComponent, SpriteComponent>();
+		// Update all live particles (pooled ones carry InactiveTag)
+		auto view = m_Scene->GetRegistry().view<ParticleComponent, TransformComponent, SpriteComponent>(entt::exclude<InactiveTag>);
+
+		m_DeadParticles.clear();
 
-		std::vector<Entity> deadParticles;
-		deadParticles.reserve(100); // Pre-allocate for performance
+		m_BatchGradients.clear();
+		m_BatchTimes.clear();
+		m_BatchTargets.clear();
 
 	for (auto entityHandle : view)
 	{
-		Entity entity(entityHandle, m_Scene);
 		auto& particle = view.get<ParticleComponent>(entityHandle);
 
-		// Skip particles that are already dead (waiting to be returned to pool)
-		if (particle.Dead)
-		{
-			m_DeadCount++;
-			continue;
-		}
-
 		// Age the particle
 		particle.Age += dt;
 
-		// Check if particle has expired
-		if (particle.Age >= particle.Lifetime)
+		// Expired (or killed externally via Dead) - return to pool below
+		if (particle.Dead || particle.Age >= particle.Lifetime)
 		{
 			particle.Dead = true;
-			deadParticles.push_back(entity);
+			m_DeadParticles.emplace_back(entityHandle, m_Scene);
 			m_DeadCount++;
 			continue;
 		}
@@ -76,8 +76,10 @@ namespace Pillar {
 			{
 				if (particle.UseColorGradient && particle.ColorGradientPtr)
 				{
-					// Use color gradient
-					sprite.Color = EvaluateGradient(particle.ColorGradientPtr, t);
+					// Queue for the batched gradient pass below
+					m_BatchGradients.push_back(particle.ColorGradientPtr);
+					m_BatchTimes.push_back(t);
+					m_BatchTargets.push_back(&sprite.Color);
 				}
 				else
 				{
@@ -101,14 +103,17 @@ namespace Pillar {
 			}
 		}
 
+		// Resolve gradient colors before any component storage is touched
+		FlushGradientBatch();
+
 		// Cleanup dead particles - return to pool if available, otherwise destroy
-		for (auto entity : deadParticles)
+		if (m_ParticlePool)
 		{
-			if (m_ParticlePool)
-			{
-				m_ParticlePool->ReturnParticle(entity);
-			}
-			else
+			m_ParticlePool->ReturnParticles(m_DeadParticles);
+		}
+		else
+		{
+			for (auto entity : m_DeadParticles)
 			{
 				// Fallback: destroy if no pool is set (shouldn't happen in production)
 				m_Scene->DestroyEntity(entity);
@@ -117,20 +122,52 @@ namespace Pillar {
 		}
 	}
 
-	float ParticleSystem::EvaluateCurve(const AnimationCurve* curve, float t) const
+	void ParticleSystem::FlushGradientBatch()
 	{
-		if (!curve)
-			return t; // Linear fallback
+		const size_t count = m_BatchTimes.size();
+		if (count == 0)
+			return;
 
-		return curve->Evaluate(t);
+		m_BatchColors.resize(count);
+
+		// Particles from the same emitter are mostly contiguous in the view,
+		// so walk runs that share a gradient and sample each run in lanes.
+		size_t runStart = 0;
+		while (runStart < count)
+		{
+			ColorGradient* gradient = m_BatchGradients[runStart];
+			size_t runEnd = runStart + 1;
+			while (runEnd < count && m_BatchGradients[runEnd] == gradient)
+				++runEnd;
+
+			if (!gradient->IsValid())
+			{
+				std::fill(m_BatchColors.begin() + runStart, m_BatchColors.begin() + runEnd, glm::vec4(1.0f)); // White fallback
+			}
+			else
+			{
+				if (!gradient->IsBaked())
+					gradient->Bake();
+
+				gradient->GetLUT().SampleBatch(&m_BatchTimes[runStart], &m_BatchColors[runStart], runEnd - runStart);
+			}
+
+			runStart = runEnd;
+		}
+
+		for (size_t i = 0; i < count; ++i)
+			*m_BatchTargets[i] = m_BatchColors[i];
 	}
 
-	glm::vec4 ParticleSystem::EvaluateGradient(const ColorGradient* gradient, float t) const
+	float ParticleSystem::EvaluateCurve(AnimationCurve* curve, float t)
 	{
-		if (!gradient || !gradient->IsValid())
-			return glm::vec4(1.0f); // White fallback
+		if (!curve)
+			return t; // Linear fallback
+
+		if (!curve->IsBaked())
+			curve->Bake();
 
-		return gradient->Evaluate(t);
+		return curve->GetLUT().Sample(t);
 	}
 
 } // namespace Pillar
@@ -2,8 +2,10 @@
 
 #include "Pillar/Core.h"
 #include "System.h"
+#include "Pillar/ECS/Entity.h"
 #include <glm/glm.hpp>
 #include <cstdint>
+#include <vector>
 
 namespace Pillar {
 
@@ -21,6 +23,10 @@ namespace Pillar {
 	 * - Support color gradients (Phase 3)
 	 * - Support animation curves (Phase 3)
 	 * - Return particles to pool for recycling
+	 *
+	 * Gradients and curves are evaluated through their baked lookup tables.
+	 * Gradient colors are gathered during the update loop and resolved in
+	 * one batched pass per gradient (see FlushGradientBatch).
 	 */
 	class PIL_API ParticleSystem : public System
 	{
@@ -41,11 +47,21 @@ namespace Pillar {
 		uint32_t GetDeadParticleCount() const { return m_DeadCount; }
 
 	private:
-		// Interpolation helpers
-		float EvaluateCurve(const AnimationCurve* curve, float t) const;
-		glm::vec4 EvaluateGradient(const ColorGradient* gradient, float t) const;
+		// Interpolation helper (bakes the curve on first use)
+		float EvaluateCurve(AnimationCurve* curve, float t);
+
+		// Resolve all queued gradient samples, one SampleBatch call per gradient run
+		void FlushGradientBatch();
 
 		ParticlePool* m_ParticlePool = nullptr;
+		std::vector<Entity> m_DeadParticles; // Released after the update loop
+
+		// Gradient batch (SoA, reused across frames to avoid allocations)
+		std::vector<ColorGradient*> m_BatchGradients;
+		std::vector<float> m_BatchTimes;
+		std::vector<glm::vec4*> m_BatchTargets;
+		std::vector<glm::vec4> m_BatchColors;
+
 		uint32_t m_ActiveCount = 0;
 		uint32_t m_DeadCount = 0;
 	};
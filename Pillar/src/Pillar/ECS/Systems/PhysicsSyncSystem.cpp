@@ -2,11 +2,14 @@
 #include "Pillar/ECS/Scene.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
 #include "Pillar/ECS/Components/Physics/RigidbodyComponent.h"
+#include "Pillar/Utils/Profiler.h"
 
 namespace Pillar {
 
 	void PhysicsSyncSystem::OnUpdate(float deltaTime)
 	{
+		PIL_PROFILE_FUNCTION();
+
 		SyncTransformsFromBox2D();
 	}
 
@@ -6,6 +6,7 @@
 #include "Pillar/ECS/Components/Physics/ColliderComponent.h"
 #include "Pillar/ECS/Physics/Box2DBodyFactory.h"
 #include "Pillar/Logger.h"
+#include "Pillar/Utils/Profiler.h"
 
 namespace Pillar {
 
@@ -65,6 +66,8 @@ namespace Pillar {
 
 	void PhysicsSystem::OnUpdate(float deltaTime)
 	{
+		PIL_PROFILE_FUNCTION();
+
 		// Fixed timestep accumulator
 		m_Accumulator += deltaTime;
 
@@ -1,7 +1,10 @@
 #include "SpriteRenderSystem.h"
 #include "Pillar/ECS/Scene.h"
+#include "Pillar/ECS/Components/Core/InactiveTag.h"
+#include "Pillar/ECS/Components/Core/WorldTransformComponent.h"
 #include "Pillar/Renderer/Renderer2DBackend.h"
 #include "Pillar/Logger.h"
+#include "Pillar/Utils/Profiler.h"
 #include <algorithm>
 
 // Forward declare LayerManager to check visibility (editor only)
@@ -13,43 +16,92 @@ namespace PillarEditor {
 
 namespace Pillar {
 
+	namespace {
+
+		/**
+		 * @brief Visit visible sprites sorted by (texture, Z), at their world transform
+		 */
+		template<typename Visit>
+		void ForEachSpriteInDrawOrder(Scene& scene, std::vector<entt::entity>& order, Visit&& visit)
+		{
+			// Collect all entities with sprite + transform
+			auto& registry = scene.GetRegistry();
+			auto view = registry.view<TransformComponent, SpriteComponent>(entt::exclude<InactiveTag>);
+
+			// Sort by (Texture, ZIndex) for optimal batching
+			order.assign(view.begin(), view.end());
+			std::sort(order.begin(), order.end(),
+				[&view](entt::entity a, entt::entity b) {
+					const auto& spriteA = view.template get<SpriteComponent>(a);
+					const auto& spriteB = view.template get<SpriteComponent>(b);
+
+					// Sort by texture first (minimize texture swaps)
+					// Null textures go first
+					if (!spriteA.Texture && spriteB.Texture)
+						return true;
+					if (spriteA.Texture && !spriteB.Texture)
+						return false;
+					if (spriteA.Texture && spriteB.Texture && spriteA.Texture.get() != spriteB.Texture.get())
+						return spriteA.Texture.get() < spriteB.Texture.get();
+
+					// Then by Z-order (use computed final Z-index from layer system)
+					return spriteA.GetFinalZIndex() < spriteB.GetFinalZIndex();
+				});
+
+			// Entities in a hierarchy are drawn at their world transform
+			auto& worldTransforms = registry.storage<WorldTransformComponent>();
+
+			for (auto entity : order)
+			{
+				auto& transform = view.template get<TransformComponent>(entity);
+				auto& sprite = view.template get<SpriteComponent>(entity);
+
+				// Skip invisible sprites
+				if (!sprite.Visible)
+					continue;
+
+				if (worldTransforms.contains(entity))
+				{
+					const auto& world = worldTransforms.get(entity);
+					TransformComponent worldTransform;
+					worldTransform.Position = world.Position;
+					worldTransform.Rotation = world.Rotation;
+					worldTransform.Scale = world.Scale;
+					visit(worldTransform, sprite);
+					continue;
+				}
+
+				visit(transform, sprite);
+			}
+		}
+
+	} // namespace
+
 	void SpriteRenderSystem::OnUpdate(float dt)
 	{
-		// Collect all entities with sprite + transform
-		auto view = m_Scene->GetRegistry().view<TransformComponent, SpriteComponent>();
-
-		// Sort by (Texture, ZIndex) for optimal batching
-		std::vector<entt::entity> sortedEntities(view.begin(), view.end());
-		std::sort(sortedEntities.begin(), sortedEntities.end(),
-			[&view](entt::entity a, entt::entity b) {
-				const auto& spriteA = view.get<SpriteComponent>(a);
-				const auto& spriteB = view.get<SpriteComponent>(b);
-
-				// Sort by texture first (minimize texture swaps)
-				// Null textures go first
-				if (!spriteA.Texture && spriteB.Texture)
-					return true;
-				if (spriteA.Texture && !spriteB.Texture)
-					return false;
-				if (spriteA.Texture && spriteB.Texture && spriteA.Texture.get() != spriteB.Texture.get())
-					return spriteA.Texture.get() < spriteB.Texture.get();
-
-				// Then by Z-order (use computed final Z-index from layer system)
-				return spriteA.GetFinalZIndex() < spriteB.GetFinalZIndex();
-			});
+		PIL_PROFILE_FUNCTION();
 
 		// Render each sprite (batch renderer accumulates internally)
-		for (auto entity : sortedEntities)
-		{
-			auto& transform = view.get<TransformComponent>(entity);
-			auto& sprite = view.get<SpriteComponent>(entity);
+		ForEachSpriteInDrawOrder(*m_Scene, m_DrawOrder, [this](const TransformComponent& transform, const SpriteComponent& sprite) {
+			RenderSprite(transform, sprite);
+		});
+	}
 
-			// Skip invisible sprites
-			if (!sprite.Visible)
-				continue;
+	void SpriteRenderSystem::PackQuads(Scene& scene, std::vector<entt::entity>& order, std::vector<QuadGeometry::QuadVertex>& vertices)
+	{
+		vertices.clear();
+		ForEachSpriteInDrawOrder(scene, order, [&vertices](const TransformComponent& transform, const SpriteComponent& sprite) {
+			// Matches Renderer2DBackend::DrawSprite; untextured sprites draw with the full white texture
+			const glm::vec3 position(transform.Position, sprite.ZIndex);
+			const glm::vec2 size = sprite.Size * glm::vec2(transform.Scale.x, transform.Scale.y);
+			const bool hasTexture = sprite.Texture != nullptr;
 
-			RenderSprite(transform, sprite);
-		}
+			const size_t first = vertices.size();
+			vertices.resize(first + 4);
+			QuadGeometry::WriteQuad(&vertices[first], position, size, transform.Rotation, sprite.Color,
+				hasTexture ? sprite.TexCoordMin : glm::vec2(0.0f), hasTexture ? sprite.TexCoordMax : glm::vec2(1.0f),
+				hasTexture && sprite.FlipX, hasTexture && sprite.FlipY, 0.0f);
+		});
 	}
 
 	void SpriteRenderSystem::RenderSprite(const TransformComponent& transform,
@@ -3,6 +3,8 @@
 #include "System.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
 #include "Pillar/ECS/Components/Rendering/SpriteComponent.h"
+#include "Pillar/Renderer/QuadGeometry.h"
+#include <vector>
 
 namespace Pillar {
 
@@ -21,8 +23,19 @@ namespace Pillar {
 
 		void OnUpdate(float dt) override;
 
+		/**
+		 * @brief Sort and expand a scene's sprites into batch vertices without a renderer
+		 *
+		 * Same draw order and corner math as OnUpdate feeding the batch renderer,
+		 * minus texture slot assignment and the upload (TexIndex is left at 0).
+		 * Lets benchmarks and tests measure the CPU side of sprite rendering.
+		 */
+		static void PackQuads(Scene& scene, std::vector<entt::entity>& order, std::vector<QuadGeometry::QuadVertex>& vertices);
+
 	private:
 		void RenderSprite(const TransformComponent& transform, const SpriteComponent& sprite);
+
+		std::vector<entt::entity> m_DrawOrder;   // Reused across frames
 	};
 
 } // namespace Pillar
@@ -0,0 +1,393 @@
+#include "TransformHierarchySystem.h"
+#include "Pillar/ECS/Scene.h"
+#include "Pillar/ECS/Entity.h"
+#include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Core/HierarchyComponent.h"
+#include "Pillar/ECS/Components/Core/WorldTransformComponent.h"
+#include "Pillar/ECS/Components/Core/UUIDComponent.h"
+#include "Pillar/Utils/ThreadPool.h"
+#include "Pillar/Logger.h"
+#include "Pillar/Utils/Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <unordered_map>
+
+namespace Pillar {
+
+	namespace {
+
+		// Same matrix as TransformComponent::GetTransform() (T * Rz * S), built
+		// without touching the component's mutable cache
+		glm::mat4 ComposeLocal(const glm::vec2& position, float rotation, const glm::vec2& scale)
+		{
+			const float c = std::cos(rotation);
+			const float s = std::sin(rotation);
+
+			glm::mat4 m(1.0f);
+			m[0][0] = c * scale.x;
+			m[0][1] = s * scale.x;
+			m[1][0] = -s * scale.y;
+			m[1][1] = c * scale.y;
+			m[3][0] = position.x;
+			m[3][1] = position.y;
+			return m;
+		}
+
+		// Smallest batch worth handing to a worker
+		constexpr uint32_t kMinBatchNodes = 256;
+
+	} // namespace
+
+	void TransformHierarchySystem::OnAttach(Scene* scene)
+	{
+		System::OnAttach(scene);
+
+		m_Order.clear();
+		m_ParentIndex.clear();
+		m_Changed.clear();
+		m_Batches.clear();
+		m_RootCount = 0;
+		m_HierarchyDirty = true;
+	}
+
+	void TransformHierarchySystem::OnUpdate(float deltaTime)
+	{
+		PIL_PROFILE_FUNCTION();
+
+		if (!m_Scene)
+			return;
+
+		if (NeedsRelink())
+			Relink();
+
+		if (m_Order.empty())
+		{
+			m_UpdatedCount = 0;
+			return;
+		}
+
+		auto& registry = m_Scene->GetRegistry();
+		auto& transforms = registry.storage<TransformComponent>();
+		auto& worlds = registry.storage<WorldTransformComponent>();
+
+		// Propagate over [begin, end); ranges always start at a root, so every
+		// parent index points into the same range
+		auto propagate = [&](uint32_t begin, uint32_t end) -> uint32_t {
+			uint32_t updated = 0;
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				const entt::entity entity = m_Order[i];
+				auto& world = worlds.get(entity);
+
+				glm::vec2 position(0.0f);
+				float rotation = 0.0f;
+				glm::vec2 scale(1.0f);
+				if (transforms.contains(entity))
+				{
+					const auto& local = transforms.get(entity);
+					position = local.Position;
+					rotation = local.Rotation;
+					scale = local.Scale;
+				}
+
+				const int32_t parent = m_ParentIndex[i];
+				const bool changed = world.NeedsUpdate
+					|| (parent >= 0 && m_Changed[parent])
+					|| position != world.LocalPosition
+					|| rotation != world.LocalRotation
+					|| scale != world.LocalScale;
+
+				m_Changed[i] = changed ? 1 : 0;
+				if (!changed)
+					continue;
+
+				world.LocalPosition = position;
+				world.LocalRotation = rotation;
+				world.LocalScale = scale;
+				world.NeedsUpdate = false;
+
+				const glm::mat4 localMatrix = ComposeLocal(position, rotation, scale);
+				if (parent < 0)
+				{
+					world.Matrix = localMatrix;
+					world.Position = position;
+					world.Rotation = rotation;
+					world.Scale = scale;
+				}
+				else
+				{
+					const auto& parentWorld = worlds.get(m_Order[parent]);
+					world.Matrix = parentWorld.Matrix * localMatrix;
+					world.Position = glm::vec2(world.Matrix[3][0], world.Matrix[3][1]);
+					world.Rotation = parentWorld.Rotation + rotation;
+					world.Scale = parentWorld.Scale * scale;
+				}
+				++updated;
+			}
+			return updated;
+		};
+
+		if (m_Order.size() >= m_ParallelThreshold && m_Batches.size() > 1)
+		{
+			std::atomic<uint32_t> updated{ 0 };
+			ThreadPool::Get().ParallelFor(m_Batches.size(), 1, [&](size_t begin, size_t end) {
+				uint32_t local = 0;
+				for (size_t b = begin; b < end; ++b)
+					local += propagate(m_Batches[b].Begin, m_Batches[b].End);
+				updated.fetch_add(local, std::memory_order_relaxed);
+			});
+			m_UpdatedCount = updated.load();
+		}
+		else
+		{
+			m_UpdatedCount = propagate(0, static_cast<uint32_t>(m_Order.size()));
+		}
+	}
+
+	bool TransformHierarchySystem::NeedsRelink()
+	{
+		if (m_HierarchyDirty)
+			return true;
+
+		auto& registry = m_Scene->GetRegistry();
+		auto& hierarchy = registry.storage<HierarchyComponent>();
+
+		// Hierarchy entities added or removed
+		if (hierarchy.size() != m_HierarchyCount)
+			return true;
+
+		// A parent we could not resolve may have been created since
+		if (m_UnresolvedCount > 0 && registry.storage<UUIDComponent>().size() != m_UUIDCount)
+			return true;
+
+		// Destroyed nodes (including parents without a HierarchyComponent)
+		for (entt::entity entity : m_Order)
+		{
+			if (!registry.valid(entity))
+				return true;
+		}
+
+		// Reparented entities
+		for (auto [entity, node] : hierarchy.each())
+		{
+			if (node.LinkedParentUUID != node.ParentUUID)
+				return true;
+		}
+
+		return false;
+	}
+
+	void TransformHierarchySystem::Relink()
+	{
+		auto& registry = m_Scene->GetRegistry();
+		auto& hierarchy = registry.storage<HierarchyComponent>();
+
+		// 1. Resolve parent handles
+		m_UnresolvedCount = 0;
+		for (auto [entity, node] : hierarchy.each())
+		{
+			node.Parent = entt::null;
+			node.FirstChild = entt::null;
+			node.NextSibling = entt::null;
+			node.Depth = 0;
+			node.LinkedParentUUID = node.ParentUUID;
+
+			if (node.ParentUUID == 0)
+				continue;
+
+			// O(1) through the scene's UUID index
+			Entity parent = m_Scene->FindEntityByUUID(node.ParentUUID);
+			if (!parent)
+			{
+				++m_UnresolvedCount;
+				continue;
+			}
+			if (static_cast<entt::entity>(parent) != entity)
+				node.Parent = parent;
+		}
+
+		// 2. Break cycles and compute depths (walk up each chain once)
+		const size_t count = hierarchy.size();
+		std::vector<uint8_t> state(count, 0); // 0 = unvisited, 1 = on current chain, 2 = done
+		std::vector<entt::entity> chain;
+		for (entt::entity start : hierarchy)
+		{
+			chain.clear();
+			entt::entity current = start;
+			while (true)
+			{
+				const size_t index = hierarchy.index(current);
+				if (state[index] == 2)
+					break;
+				if (state[index] == 1)
+				{
+					PIL_CORE_WARN("TransformHierarchySystem: parent cycle detected, detaching entity {0}",
+						static_cast<uint32_t>(chain.back()));
+					hierarchy.get(chain.back()).Parent = entt::null;
+					break;
+				}
+
+				state[index] = 1;
+				chain.push_back(current);
+
+				const entt::entity parent = hierarchy.get(current).Parent;
+				if (parent == entt::null || !hierarchy.contains(parent))
+					break;
+				current = parent;
+			}
+
+			for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+			{
+				auto& node = hierarchy.get(*it);
+				state[hierarchy.index(*it)] = 2;
+				if (node.Parent == entt::null)
+					node.Depth = 0;
+				else if (hierarchy.contains(node.Parent))
+					node.Depth = hierarchy.get(node.Parent).Depth + 1;
+				else
+					node.Depth = 1; // Parent without a HierarchyComponent is an implicit root
+			}
+		}
+
+		// 3. Child lists; parents without a HierarchyComponent keep theirs on the side
+		std::vector<entt::entity> roots;
+		std::unordered_map<entt::entity, entt::entity> externalFirstChild;
+		for (entt::entity entity : hierarchy)
+		{
+			auto& node = hierarchy.get(entity);
+			if (node.Parent == entt::null)
+			{
+				roots.push_back(entity);
+				continue;
+			}
+
+			if (hierarchy.contains(node.Parent))
+			{
+				auto& parent = hierarchy.get(node.Parent);
+				node.NextSibling = parent.FirstChild;
+				parent.FirstChild = entity;
+			}
+			else
+			{
+				auto [it, inserted] = externalFirstChild.try_emplace(node.Parent, entt::null);
+				if (inserted)
+					roots.push_back(node.Parent);
+				node.NextSibling = it->second;
+				it->second = entity;
+			}
+		}
+
+		// 4. Depth-first order; each root's subtree becomes one contiguous range
+		m_Order.clear();
+		m_ParentIndex.clear();
+		std::vector<NodeRange> subtrees;
+		subtrees.reserve(roots.size());
+
+		std::vector<std::pair<entt::entity, int32_t>> stack;
+		for (entt::entity root : roots)
+		{
+			NodeRange range;
+			range.Begin = static_cast<uint32_t>(m_Order.size());
+
+			entt::entity firstChild = entt::null;
+			if (hierarchy.contains(root))
+				firstChild = hierarchy.get(root).FirstChild;
+			else
+				firstChild = externalFirstChild[root];
+
+			m_Order.push_back(root);
+			m_ParentIndex.push_back(-1);
+
+			const int32_t rootIndex = static_cast<int32_t>(range.Begin);
+			for (entt::entity child = firstChild; child != entt::null; child = hierarchy.get(child).NextSibling)
+				stack.emplace_back(child, rootIndex);
+
+			while (!stack.empty())
+			{
+				const auto [entity, parentIndex] = stack.back();
+				stack.pop_back();
+
+				const int32_t index = static_cast<int32_t>(m_Order.size());
+				m_Order.push_back(entity);
+				m_ParentIndex.push_back(parentIndex);
+
+				for (entt::entity child = hierarchy.get(entity).FirstChild; child != entt::null;
+					child = hierarchy.get(child).NextSibling)
+					stack.emplace_back(child, index);
+			}
+
+			range.End = static_cast<uint32_t>(m_Order.size());
+			subtrees.push_back(range);
+		}
+
+		m_RootCount = static_cast<uint32_t>(roots.size());
+		m_Changed.assign(m_Order.size(), 0);
+		BuildBatches(subtrees);
+
+		// 5. World transforms for every node; drop stale ones from entities that left
+		std::vector<uint32_t> rank;
+		for (uint32_t i = 0; i < m_Order.size(); ++i)
+		{
+			const auto id = static_cast<size_t>(entt::to_entity(m_Order[i]));
+			if (id >= rank.size())
+				rank.resize(id + 1, UINT32_MAX);
+			rank[id] = i;
+
+			registry.get_or_emplace<WorldTransformComponent>(m_Order[i]).NeedsUpdate = true;
+		}
+
+		auto isNode = [&](entt::entity entity) {
+			const auto id = static_cast<size_t>(entt::to_entity(entity));
+			return id < rank.size() && rank[id] != UINT32_MAX && m_Order[rank[id]] == entity;
+		};
+
+		std::vector<entt::entity> stale;
+		for (entt::entity entity : registry.view<WorldTransformComponent>())
+		{
+			if (!isNode(entity))
+				stale.push_back(entity);
+		}
+		registry.remove<WorldTransformComponent>(stale.begin(), stale.end());
+
+		// 6. Sort storages into depth-first order (parents precede children)
+		auto byRank = [&rank](entt::entity lhs, entt::entity rhs) {
+			return rank[entt::to_entity(lhs)] < rank[entt::to_entity(rhs)];
+		};
+		registry.sort<HierarchyComponent>(byRank);
+		registry.sort<WorldTransformComponent>(byRank);
+
+		m_HierarchyCount = hierarchy.size();
+		m_UUIDCount = registry.storage<UUIDComponent>().size();
+		m_HierarchyDirty = false;
+		++m_RelinkCount;
+
+		PIL_CORE_TRACE("TransformHierarchySystem: relinked {0} nodes under {1} roots",
+			m_Order.size(), m_RootCount);
+	}
+
+	void TransformHierarchySystem::BuildBatches(const std::vector<NodeRange>& subtrees)
+	{
+		m_Batches.clear();
+		if (subtrees.empty())
+			return;
+
+		// Aim for a few batches per thread so one deep subtree doesn't serialize the rest
+		const size_t threads = static_cast<size_t>(ThreadPool::Get().GetWorkerCount()) + 1;
+		const uint32_t target = std::max(kMinBatchNodes,
+			static_cast<uint32_t>(m_Order.size() / (threads * 4)));
+
+		NodeRange batch = subtrees.front();
+		for (size_t i = 1; i < subtrees.size(); ++i)
+		{
+			if (batch.End - batch.Begin >= target)
+			{
+				m_Batches.push_back(batch);
+				batch.Begin = subtrees[i].Begin;
+			}
+			batch.End = subtrees[i].End;
+		}
+		m_Batches.push_back(batch);
+	}
+
+} // namespace Pillar
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include "System.h"
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Pillar {
+
+	/**
+	 * @brief Computes WorldTransformComponent from parent/child hierarchies
+	 *
+	 * Relinking (only when a ParentUUID changes or hierarchy entities come and go):
+	 *   1. Resolve every ParentUUID to an entity handle (HierarchyComponent::Parent)
+	 *      and rebuild the FirstChild/NextSibling lists
+	 *   2. Walk each root depth-first, so every root's subtree is one contiguous
+	 *      range with parents before children
+	 *   3. Sort the HierarchyComponent and WorldTransformComponent storages into
+	 *      that order, so propagation walks memory front to back
+	 *
+	 * Propagation (every update): a node is recomputed only if its local TRS
+	 * changed since last time or its parent was recomputed, so static subtrees
+	 * cost one comparison per node. Independent root subtrees are processed on
+	 * ThreadPool workers once the hierarchy is large enough.
+	 *
+	 * Run it after systems that move entities and before rendering.
+	 */
+	class PIL_API TransformHierarchySystem : public System
+	{
+	public:
+		void OnAttach(Scene* scene) override;
+		void OnUpdate(float deltaTime) override;
+
+		// Force relinking on the next update (e.g. after bulk-editing ParentUUIDs)
+		void MarkHierarchyDirty() { m_HierarchyDirty = true; }
+
+		// Hierarchies with fewer nodes than this are propagated on the calling thread
+		void SetParallelThreshold(size_t nodeCount) { m_ParallelThreshold = nodeCount; }
+		size_t GetParallelThreshold() const { return m_ParallelThreshold; }
+
+		// Stats
+		uint32_t GetNodeCount() const { return static_cast<uint32_t>(m_Order.size()); }
+		uint32_t GetRootCount() const { return m_RootCount; }
+		uint32_t GetUpdatedCount() const { return m_UpdatedCount; }
+		uint32_t GetRelinkCount() const { return m_RelinkCount; }
+
+	private:
+		struct NodeRange
+		{
+			uint32_t Begin = 0;
+			uint32_t End = 0;
+		};
+
+		// Depth-first node order; m_ParentIndex[i] < i (or -1 for roots)
+		std::vector<entt::entity> m_Order;
+		std::vector<int32_t> m_ParentIndex;
+		std::vector<uint8_t> m_Changed;
+
+		// Runs of whole root subtrees of similar node count, one per parallel task
+		std::vector<NodeRange> m_Batches;
+		uint32_t m_RootCount = 0;
+
+		size_t m_HierarchyCount = 0;
+		size_t m_UUIDCount = 0;
+		uint32_t m_UnresolvedCount = 0;
+		bool m_HierarchyDirty = true;
+
+		size_t m_ParallelThreshold = 2048;
+		uint32_t m_UpdatedCount = 0;
+		uint32_t m_RelinkCount = 0;
+
+		bool NeedsRelink();
+		void Relink();
+		void BuildBatches(const std::vector<NodeRange>& subtrees);
+	};
+
+} // namespace Pillar
@@ -1,19 +1,23 @@
 #include "VelocityIntegrationSystem.h"
 #include "Pillar/ECS/Scene.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Core/InactiveTag.h"
 #include "Pillar/ECS/Components/Physics/VelocityComponent.h"
+#include "Pillar/Utils/Profiler.h"
 #include <glm/glm.hpp>
 
 namespace Pillar {
 
 	void VelocityIntegrationSystem::OnUpdate(float deltaTime)
 	{
+		PIL_PROFILE_FUNCTION();
+
 		IntegrateVelocity(deltaTime);
 	}
 
 	void VelocityIntegrationSystem::IntegrateVelocity(float deltaTime)
 	{
-		auto view = m_Scene->GetRegistry().view<TransformComponent, VelocityComponent>();
+		auto view = m_Scene->GetRegistry().view<TransformComponent, VelocityComponent>(entt::exclude<InactiveTag>);
 
 		for (auto entity : view)
 		{
@@ -6,6 +6,7 @@
 #include "Pillar/ECS/Components/Physics/VelocityComponent.h"
 #include "Pillar/ECS/Components/Gameplay/XPGemComponent.h"
 #include "Pillar/Logger.h"
+#include "Pillar/Utils/Profiler.h"
 #include <glm/glm.hpp>
 
 namespace Pillar {
@@ -17,6 +18,8 @@ namespace Pillar {
 
 	void XPCollectionSystem::OnUpdate(float deltaTime)
 	{
+		PIL_PROFILE_FUNCTION();
+
 		// Rebuild spatial grid every frame (simple approach, fast enough for 10k entities)
 		UpdateSpatialGrid();
 
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include "Entity.h"
+#include "Scene.h"
+#include "Components/Core/InactiveTag.h"
+#include "Pillar/Logger.h"
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace Pillar {
+
+/**
+ * @brief Entity pool with a compile-time component set
+ *
+ * Every pooled entity owns exactly Components... . Unlike ObjectPool there are no
+ * type-erased callbacks: a released entity has each component reset by assigning
+ * a per-type prototype, and it is tagged with InactiveTag so systems that view
+ * with entt::exclude<InactiveTag> skip it. Because the tag marks pool membership,
+ * IsInPool() is a single storage lookup.
+ *
+ * Capacity is fixed at Init() (component storages are reserved up front so they
+ * stay contiguous). With allowGrowth the pool creates extra entities when
+ * exhausted instead of returning an invalid Entity.
+ *
+ * Usage:
+ * @code
+ * TypedPool<TransformComponent, VelocityComponent, BulletComponent> pool;
+ * pool.GetPrototype<BulletComponent>().Damage = 5.0f;
+ * pool.Init(scene, 512);
+ *
+ * Entity bullet = pool.Acquire();   // InactiveTag removed, components at prototype values
+ * pool.Release(bullet);             // Components reset, InactiveTag added
+ * @endcode
+ */
+template<typename... Components>
+class TypedPool
+{
+public:
+	static_assert(sizeof...(Components) > 0, "TypedPool needs at least one component type");
+
+	TypedPool() = default;
+	~TypedPool() = default;
+
+	/**
+	 * @brief Create capacity parked entities in scene
+	 * @param allowGrowth Create new entities when the pool runs dry
+	 */
+	void Init(Scene* scene, uint32_t capacity, bool allowGrowth = false)
+	{
+		PIL_CORE_ASSERT(scene, "Scene cannot be null!");
+		m_Scene = scene;
+		m_AllowGrowth = allowGrowth;
+
+		auto& registry = m_Scene->GetRegistry();
+		(registry.template storage<Components>().reserve(capacity), ...);
+		registry.template storage<InactiveTag>().reserve(capacity);
+
+		m_Entities.reserve(capacity);
+		m_Available.reserve(capacity);
+		CreateParked(capacity);
+
+		PIL_CORE_TRACE("TypedPool initialized with {0} entities", capacity);
+	}
+
+	/**
+	 * @brief Take one entity out of the pool
+	 * @return The entity, or an invalid Entity if the pool is full and cannot grow
+	 */
+	Entity Acquire()
+	{
+		PIL_CORE_ASSERT(m_Scene, "TypedPool not initialized! Call Init() first.");
+
+		if (m_Available.empty())
+		{
+			if (!m_AllowGrowth)
+			{
+				PIL_CORE_WARN("TypedPool: Pool exhausted (capacity: {0})", m_Entities.size());
+				return Entity();
+			}
+			CreateParked(1);
+			PIL_CORE_WARN("TypedPool: Pool exhausted, creating new entity (total: {0})", m_Entities.size());
+		}
+
+		entt::entity handle = m_Available.back();
+		m_Available.pop_back();
+		m_Scene->GetRegistry().template remove<InactiveTag>(handle);
+		return Entity(handle, m_Scene);
+	}
+
+	/**
+	 * @brief Take several entities out of the pool in one call
+	 * @param outEntities Acquired entities are appended here
+	 * @return Number of entities acquired (less than count only when growth is disabled)
+	 */
+	uint32_t AcquireBatch(uint32_t count, std::vector<Entity>& outEntities)
+	{
+		PIL_CORE_ASSERT(m_Scene, "TypedPool not initialized! Call Init() first.");
+
+		if (count > m_Available.size())
+		{
+			const uint32_t missing = count - static_cast<uint32_t>(m_Available.size());
+			if (m_AllowGrowth)
+			{
+				CreateParked(missing);
+				PIL_CORE_WARN("TypedPool: Pool exhausted, created {0} new entities (total: {1})", missing, m_Entities.size());
+			}
+			else
+			{
+				PIL_CORE_WARN("TypedPool: Pool exhausted, {0} of {1} entities unavailable", missing, count);
+				count = static_cast<uint32_t>(m_Available.size());
+			}
+		}
+
+		// Take a contiguous block from the back of the free list
+		auto first = m_Available.end() - count;
+		m_Scene->GetRegistry().template remove<InactiveTag>(first, m_Available.end());
+
+		outEntities.reserve(outEntities.size() + count);
+		for (auto it = first; it != m_Available.end(); ++it)
+			outEntities.emplace_back(*it, m_Scene);
+
+		m_Available.erase(first, m_Available.end());
+		return count;
+	}
+
+	/**
+	 * @brief Reset an entity's components and park it
+	 * Releasing an entity that is already parked (or no longer valid) is ignored.
+	 */
+	void Release(Entity entity)
+	{
+		PIL_CORE_ASSERT(m_Scene, "TypedPool not initialized!");
+
+		auto& registry = m_Scene->GetRegistry();
+		const entt::entity handle = entity;
+		if (!registry.valid(handle) || registry.template all_of<InactiveTag>(handle))
+		{
+			PIL_CORE_WARN("TypedPool: Attempted to release an invalid or already pooled entity!");
+			return;
+		}
+
+		(ResetComponent<Components>(registry, handle), ...);
+		registry.template emplace<InactiveTag>(handle);
+		m_Available.push_back(handle);
+	}
+
+	/**
+	 * @brief Release many entities, resetting one component type at a time
+	 */
+	void ReleaseBatch(const std::vector<Entity>& entities)
+	{
+		PIL_CORE_ASSERT(m_Scene, "TypedPool not initialized!");
+
+		auto& registry = m_Scene->GetRegistry();
+		const size_t firstReleased = m_Available.size();
+		for (const Entity& entity : entities)
+		{
+			const entt::entity handle = entity;
+			if (!registry.valid(handle) || registry.template all_of<InactiveTag>(handle))
+				continue;
+
+			// Tag immediately so duplicates within the batch are caught
+			registry.template emplace<InactiveTag>(handle);
+			m_Available.push_back(handle);
+		}
+
+		const auto first = m_Available.begin() + firstReleased;
+		(ResetComponents<Components>(registry, first, m_Available.end()), ...);
+	}
+
+	/**
+	 * @brief Check whether an entity is parked in a pool (O(1))
+	 */
+	bool IsInPool(Entity entity) const
+	{
+		const entt::entity handle = entity;
+		const auto& registry = m_Scene->GetRegistry();
+		return registry.valid(handle) && registry.template all_of<InactiveTag>(handle);
+	}
+
+	/**
+	 * @brief Values a component is reset to on release (and created with)
+	 */
+	template<typename T>
+	T& GetPrototype() { return std::get<T>(m_Prototypes); }
+
+	template<typename T>
+	void SetPrototype(const T& prototype) { std::get<T>(m_Prototypes) = prototype; }
+
+	size_t GetAvailableCount() const { return m_Available.size(); }
+	size_t GetTotalCount() const { return m_Entities.size(); }
+	size_t GetActiveCount() const { return m_Entities.size() - m_Available.size(); }
+	bool CanGrow() const { return m_AllowGrowth; }
+
+	/**
+	 * @brief Destroy every entity this pool created (active or parked)
+	 */
+	void Clear()
+	{
+		if (m_Scene)
+		{
+			auto& registry = m_Scene->GetRegistry();
+			for (entt::entity handle : m_Entities)
+			{
+				if (registry.valid(handle))
+					registry.destroy(handle);
+			}
+		}
+
+		PIL_CORE_TRACE("TypedPool: Cleared {0} entities", m_Entities.size());
+		m_Entities.clear();
+		m_Available.clear();
+	}
+
+private:
+	Scene* m_Scene = nullptr;
+	bool m_AllowGrowth = false;
+	std::vector<entt::entity> m_Entities;   // Every entity created by this pool
+	std::vector<entt::entity> m_Available;  // Parked entities (free list)
+	std::tuple<Components...> m_Prototypes;
+
+	void CreateParked(uint32_t count)
+	{
+		auto& registry = m_Scene->GetRegistry();
+		const size_t first = m_Available.size();
+		m_Available.resize(first + count);
+		registry.create(m_Available.begin() + first, m_Available.end());
+
+		// Bulk-insert each component type so its storage is filled contiguously
+		(registry.template insert<Components>(m_Available.begin() + first, m_Available.end(), std::get<Components>(m_Prototypes)), ...);
+		registry.template insert<InactiveTag>(m_Available.begin() + first, m_Available.end());
+
+		m_Entities.insert(m_Entities.end(), m_Available.begin() + first, m_Available.end());
+	}
+
+	template<typename T>
+	void ResetComponent(entt::registry& registry, entt::entity handle)
+	{
+		registry.template get<T>(handle) = std::get<T>(m_Prototypes);
+	}
+
+	template<typename T, typename It>
+	void ResetComponents(entt::registry& registry, It first, It last)
+	{
+		auto& storage = registry.template storage<T>();
+		const T& prototype = std::get<T>(m_Prototypes);
+		for (auto it = first; it != last; ++it)
+			storage.get(*it) = prototype;
+	}
+};
+
+} // namespace Pillar
@@ -0,0 +1,139 @@
+#include "Pillar/Renderer/CookedTexture.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+namespace Pillar {
+
+    using namespace CookedTextures;
+
+    bool CookedTexture::Load(const std::string& path)
+    {
+        m_Levels.clear();
+        m_Path = path;
+
+        if (!m_File.Open(path))
+        {
+            PIL_CORE_ERROR("CookedTexture: Failed to open {0}", path);
+            return false;
+        }
+
+        const uint8_t* data = m_File.Data();
+        const size_t size = m_File.Size();
+
+        FileHeader header;
+        if (size < sizeof(FileHeader))
+        {
+            PIL_CORE_ERROR("CookedTexture: {0} is too small to be a cooked texture", path);
+            return false;
+        }
+        std::memcpy(&header, data, sizeof(FileHeader));
+
+        if (header.Magic != kMagic)
+        {
+            PIL_CORE_ERROR("CookedTexture: {0} is not a cooked texture", path);
+            return false;
+        }
+        if (header.FormatVersion != kFormatVersion)
+        {
+            PIL_CORE_ERROR("CookedTexture: {0} has format version {1}, expected {2} (re-cook it)",
+                path, header.FormatVersion, kFormatVersion);
+            return false;
+        }
+        if (header.PixelFormat != Format::RGBA8 && header.PixelFormat != Format::BC1 &&
+            header.PixelFormat != Format::BC3 && header.PixelFormat != Format::BC7)
+        {
+            PIL_CORE_ERROR("CookedTexture: {0} has unknown pixel format {1}", path, static_cast<uint32_t>(header.PixelFormat));
+            return false;
+        }
+        if (header.Width == 0 || header.Height == 0 || header.Width > kMaxDimension || header.Height > kMaxDimension ||
+            header.MipCount == 0 || header.MipCount > GetFullMipCount(header.Width, header.Height))
+        {
+            PIL_CORE_ERROR("CookedTexture: {0} has an invalid size ({1}x{2}, {3} levels)",
+                path, header.Width, header.Height, header.MipCount);
+            return false;
+        }
+
+        const size_t tableEnd = sizeof(FileHeader) + static_cast<size_t>(header.MipCount) * sizeof(MipEntry);
+        if (size < tableEnd)
+        {
+            PIL_CORE_ERROR("CookedTexture: {0} is truncated", path);
+            return false;
+        }
+
+        std::vector<Level> levels(header.MipCount);
+        for (uint32_t i = 0; i < header.MipCount; ++i)
+        {
+            MipEntry entry;
+            std::memcpy(&entry, data + sizeof(FileHeader) + i * sizeof(MipEntry), sizeof(MipEntry));
+
+            const uint32_t width = GetMipDimension(header.Width, i);
+            const uint32_t height = GetMipDimension(header.Height, i);
+            if (entry.Width != width || entry.Height != height ||
+                entry.Size != GetLevelSize(header.PixelFormat, width, height) ||
+                entry.Offset % kAlignment != 0 || entry.Offset < tableEnd ||
+                entry.Offset > size || entry.Size > size - entry.Offset)
+            {
+                PIL_CORE_ERROR("CookedTexture: {0} has a corrupt entry for level {1}", path, i);
+                return false;
+            }
+
+            levels[i] = { width, height, data + entry.Offset, static_cast<size_t>(entry.Size) };
+        }
+
+        m_Format = header.PixelFormat;
+        m_Width = header.Width;
+        m_Height = header.Height;
+        m_Levels = std::move(levels);
+        return true;
+    }
+
+    size_t CookedTexture::GetDataSize() const
+    {
+        size_t total = 0;
+        for (const Level& level : m_Levels)
+            total += level.Size;
+        return total;
+    }
+
+    bool CookedTexture::IsCookedPath(const std::string& path)
+    {
+        std::string extension = std::filesystem::path(path).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension == Extension;
+    }
+
+    std::string CookedTexture::GetCookedPath(const std::string& sourcePath)
+    {
+        return std::filesystem::path(sourcePath).replace_extension(Extension).string();
+    }
+
+    std::string CookedTexture::FindCookedPath(const std::string& sourcePath)
+    {
+        if (IsCookedPath(sourcePath))
+            return sourcePath;
+
+        std::error_code error;
+        const std::string cookedPath = GetCookedPath(sourcePath);
+        if (!std::filesystem::exists(cookedPath, error))
+            return {};
+
+        // A source edited after cooking wins until it is cooked again
+        if (std::filesystem::exists(sourcePath, error))
+        {
+            const auto sourceTime = std::filesystem::last_write_time(sourcePath, error);
+            const auto cookedTime = std::filesystem::last_write_time(cookedPath, error);
+            if (!error && sourceTime > cookedTime)
+            {
+                PIL_CORE_TRACE("CookedTexture: {0} is older than its source, ignoring it", cookedPath);
+                return {};
+            }
+        }
+        return cookedPath;
+    }
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include "Pillar/Renderer/CookedTextureFormat.h"
+#include "Pillar/Utils/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pillar {
+
+    /**
+     * @brief A cooked (".ptex") texture, memory-mapped and validated but never decoded
+     *
+     * Each level points straight into the mapping and is handed to the GPU as-is
+     * (Texture2D::Create(const TextureImage&) with TextureImage::Cooked set).
+     * Loading only touches the header, so it is cheap enough for any thread.
+     * See CookedTextureFormat.h for the layout; TextureCooker writes these files.
+     */
+    class PIL_API CookedTexture
+    {
+    public:
+        static constexpr const char* Extension = ".ptex";
+
+        struct Level
+        {
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            const uint8_t* Data = nullptr;
+            size_t Size = 0;
+        };
+
+        /**
+         * @brief Map a cooked file and check its header and level table
+         * @return false (and logs why) if the file is missing or malformed
+         */
+        bool Load(const std::string& path);
+
+        bool IsValid() const { return !m_Levels.empty(); }
+        const std::string& GetPath() const { return m_Path; }
+        CookedTextures::Format GetFormat() const { return m_Format; }
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetHeight() const { return m_Height; }
+        uint32_t GetLevelCount() const { return static_cast<uint32_t>(m_Levels.size()); }
+        const Level& GetLevel(uint32_t level) const { return m_Levels[level]; }
+
+        // Bytes uploaded to the GPU (all levels)
+        size_t GetDataSize() const;
+
+        /**
+         * @brief The cooked file to use for a resolved source path
+         * @return The path itself if it is a .ptex file, else a .ptex next to the
+         *         source that is at least as new as it; empty if there is none.
+         */
+        static std::string FindCookedPath(const std::string& sourcePath);
+
+        // The source path with its extension replaced by .ptex
+        static std::string GetCookedPath(const std::string& sourcePath);
+
+        static bool IsCookedPath(const std::string& path);
+
+    private:
+        MappedFile m_File;
+        std::string m_Path;
+        CookedTextures::Format m_Format = CookedTextures::Format::RGBA8;
+        uint32_t m_Width = 0;
+        uint32_t m_Height = 0;
+        std::vector<Level> m_Levels;
+    };
+
+}
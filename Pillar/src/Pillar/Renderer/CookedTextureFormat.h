@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Cooked texture format (".ptex"), written by TextureCooker and read by CookedTexture.
+//
+// Source images (PNG, TGA, ...) stay the authoring format; this is the runtime
+// format. Every mip level is stored exactly as the GPU takes it, so loading is
+// a memory map plus one upload call per level, with no decode.
+//
+//   FileHeader
+//   MipEntry[MipCount]                  largest level first
+//   level data, MipCount times          each level starts on a 16-byte boundary
+//
+// Rows run bottom-up, like Texture2D::Decode output. Block-compressed formats
+// cover each level in 4x4 blocks, row by row; edge blocks of levels whose size
+// is not a multiple of 4 repeat the last row/column. RGBA8 levels are tightly
+// packed. All values are little-endian. Layout changes bump kFormatVersion.
+
+namespace Pillar::CookedTextures {
+
+    constexpr uint32_t MakeFourCC(char a, char b, char c, char d)
+    {
+        return static_cast<uint32_t>(static_cast<uint8_t>(a))
+            | (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8)
+            | (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16)
+            | (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+    }
+
+    constexpr uint32_t kMagic = MakeFourCC('P', 'T', 'E', 'X');
+    constexpr uint32_t kFormatVersion = 1;
+    constexpr size_t kAlignment = 16;
+    constexpr uint32_t kMaxDimension = 16384;
+
+    enum class Format : uint32_t
+    {
+        RGBA8 = 0,  // Uncompressed, 4 bytes per texel
+        BC1 = 1,    // 8 bytes per block: RGB plus 1-bit alpha (DXT1)
+        BC3 = 2,    // 16 bytes per block: BC1 color plus interpolated alpha (DXT5)
+        BC7 = 3     // 16 bytes per block: high-quality RGBA (mode 6 only)
+    };
+
+    struct FileHeader
+    {
+        uint32_t Magic = kMagic;
+        uint32_t FormatVersion = kFormatVersion;
+        Format PixelFormat = Format::RGBA8;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t MipCount = 0;
+        uint32_t Flags = 0;         // Reserved, 0
+        uint32_t Reserved = 0;
+    };
+    static_assert(sizeof(FileHeader) == 32, "FileHeader layout is part of the file format");
+
+    struct MipEntry
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint64_t Offset = 0;        // From the start of the file
+        uint64_t Size = 0;          // Level bytes, excluding padding
+    };
+    static_assert(sizeof(MipEntry) == 24, "MipEntry layout is part of the file format");
+
+    constexpr size_t AlignUp(size_t value)
+    {
+        return (value + kAlignment - 1) & ~(kAlignment - 1);
+    }
+
+    constexpr bool IsBlockCompressed(Format format)
+    {
+        return format != Format::RGBA8;
+    }
+
+    // Bytes one level of the given size occupies
+    constexpr size_t GetLevelSize(Format format, uint32_t width, uint32_t height)
+    {
+        const size_t blocks = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+        switch (format)
+        {
+            case Format::RGBA8: return static_cast<size_t>(width) * height * 4;
+            case Format::BC1:   return blocks * 8;
+            case Format::BC3:
+            case Format::BC7:   return blocks * 16;
+        }
+        return 0;
+    }
+
+    // Levels in a full chain down to 1x1
+    constexpr uint32_t GetFullMipCount(uint32_t width, uint32_t height)
+    {
+        uint32_t levels = 1;
+        for (uint32_t size = width > height ? width : height; size > 1; size >>= 1)
+            ++levels;
+        return levels;
+    }
+
+    constexpr uint32_t GetMipDimension(uint32_t size, uint32_t level)
+    {
+        return (size >> level) > 0 ? (size >> level) : 1;
+    }
+
+} // namespace Pillar::CookedTextures
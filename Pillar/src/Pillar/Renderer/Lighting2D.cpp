@@ -4,6 +4,7 @@
 #include "Pillar/Renderer/Renderer2DBackend.h"
 #include "Pillar/Renderer/Shader.h"
 #include "Pillar/Renderer/Lighting2DGeometry.h"
+#include "Pillar/Utils/Profiler.h"
 
 #include <glad/gl.h>
 #include <glm/gtc/matrix_transform.hpp>
@@ -809,6 +810,8 @@ void main()
 
 	void Lighting2D::EndScene()
 	{
+		PIL_PROFILE_FUNCTION();
+
 		PIL_CORE_ASSERT(s_Data.InScene, "Lighting2D::EndScene called without BeginScene");
 
 		Renderer2DBackend::EndScene();
@@ -0,0 +1,48 @@
+#include "Pillar/Renderer/QuadGeometry.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Pillar::QuadGeometry
+{
+	void WriteQuad(QuadVertex* out, const glm::vec3& position, const glm::vec2& size, float rotation,
+		const glm::vec4& color, const glm::vec2& texCoordMin, const glm::vec2& texCoordMax,
+		bool flipX, bool flipY, float texIndex)
+	{
+		if (rotation != 0.0f)
+		{
+			glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
+				* glm::rotate(glm::mat4(1.0f), rotation, glm::vec3(0.0f, 0.0f, 1.0f))
+				* glm::scale(glm::mat4(1.0f), glm::vec3(size, 1.0f));
+
+			out[0].Position = transform * glm::vec4(-0.5f, -0.5f, 0.0f, 1.0f);
+			out[1].Position = transform * glm::vec4( 0.5f, -0.5f, 0.0f, 1.0f);
+			out[2].Position = transform * glm::vec4( 0.5f,  0.5f, 0.0f, 1.0f);
+			out[3].Position = transform * glm::vec4(-0.5f,  0.5f, 0.0f, 1.0f);
+		}
+		else
+		{
+			// Axis-aligned quads skip the matrix
+			glm::vec3 halfSize = glm::vec3(size * 0.5f, 0.0f);
+			out[0].Position = position + glm::vec3(-halfSize.x, -halfSize.y, 0.0f);
+			out[1].Position = position + glm::vec3( halfSize.x, -halfSize.y, 0.0f);
+			out[2].Position = position + glm::vec3( halfSize.x,  halfSize.y, 0.0f);
+			out[3].Position = position + glm::vec3(-halfSize.x,  halfSize.y, 0.0f);
+		}
+
+		float uvMinX = flipX ? texCoordMax.x : texCoordMin.x;
+		float uvMaxX = flipX ? texCoordMin.x : texCoordMax.x;
+		float uvMinY = flipY ? texCoordMax.y : texCoordMin.y;
+		float uvMaxY = flipY ? texCoordMin.y : texCoordMax.y;
+
+		out[0].TexCoord = { uvMinX, uvMinY };
+		out[1].TexCoord = { uvMaxX, uvMinY };
+		out[2].TexCoord = { uvMaxX, uvMaxY };
+		out[3].TexCoord = { uvMinX, uvMaxY };
+
+		for (int i = 0; i < 4; ++i)
+		{
+			out[i].Color = color;
+			out[i].TexIndex = texIndex;
+		}
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Pillar::QuadGeometry
+{
+	// Layout of the batch shader's vertex buffer (a_Position, a_Color, a_TexCoord, a_TexIndex)
+	struct QuadVertex
+	{
+		glm::vec3 Position;
+		glm::vec4 Color;
+		glm::vec2 TexCoord;
+		float TexIndex;     // Texture slot (0 = white texture)
+	};
+
+	// Writes the 4 corners of a quad centred on `position` to out[0..3], in the
+	// order the batch index buffer expects (bottom-left, bottom-right, top-right,
+	// top-left). `rotation` is in radians around Z. No GPU access, so the CPU
+	// cost of batching can be measured and tested without a context.
+	void WriteQuad(QuadVertex* out, const glm::vec3& position, const glm::vec2& size, float rotation,
+		const glm::vec4& color, const glm::vec2& texCoordMin, const glm::vec2& texCoordMax,
+		bool flipX, bool flipY, float texIndex);
+}
@@ -1,13 +1,48 @@
 #include "Pillar/Renderer/Texture.h"
+#include "Pillar/Renderer/CookedTexture.h"
 #include "Pillar/Renderer/RenderAPI.h"
 #include "Pillar/Utils/AssetManager.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
 #include "Pillar/Logger.h"
 #include <filesystem>
+#include <cstring>
+#include <stb_image.h>
 
 
 namespace Pillar {
 
+    namespace {
+
+        // Map the cooked file for a resolved source path, if there is a usable one
+        std::shared_ptr<CookedTexture> LoadCooked(const std::string& resolvedPath)
+        {
+            const std::string cookedPath = CookedTexture::FindCookedPath(resolvedPath);
+            if (cookedPath.empty())
+                return nullptr;
+
+            auto cooked = std::make_shared<CookedTexture>();
+            if (!cooked->Load(cookedPath))
+                return nullptr;
+            return cooked;
+        }
+
+        void FillFromCooked(std::shared_ptr<CookedTexture> cooked, TextureImage& outImage)
+        {
+            outImage.Path = cooked->GetPath();
+            outImage.Width = cooked->GetWidth();
+            outImage.Height = cooked->GetHeight();
+            outImage.Channels = 4;
+            outImage.Pixels.clear();
+            outImage.Cooked = std::move(cooked);
+        }
+
+    }
+
+    size_t TextureImage::GetUploadSize() const
+    {
+        return Cooked ? Cooked->GetDataSize() : Pixels.size();
+    }
+
     std::shared_ptr<Texture2D> Texture2D::Create(uint32_t width, uint32_t height)
     {
         switch (RenderAPI::GetAPI())
@@ -26,6 +61,14 @@ namespace Pillar {
     std::shared_ptr<Texture2D> Texture2D::Create(const std::string& path)
     {
         std::string resolvedPath = AssetManager::GetTexturePath(path);
+
+        // A cooked file uploads its stored levels without decoding
+        if (auto cooked = LoadCooked(resolvedPath))
+        {
+            TextureImage image;
+            FillFromCooked(std::move(cooked), image);
+            return Create(image);
+        }
         
         // Check if file exists
         if (!std::filesystem::exists(resolvedPath))
@@ -57,4 +100,77 @@ namespace Pillar {
         }
     }
 
+    std::shared_ptr<Texture2D> Texture2D::Create(const TextureImage& image)
+    {
+        if (!image.IsValid() || (!image.Cooked && image.Channels != 3 && image.Channels != 4))
+        {
+            PIL_CORE_WARN("Invalid decoded image '{0}', using missing texture placeholder", image.Path);
+            return AssetManager::GetMissingTexture();
+        }
+
+        switch (RenderAPI::GetAPI())
+        {
+            case RendererAPI::OpenGL:
+                if (image.Cooked)
+                    return std::make_shared<OpenGLTexture2D>(*image.Cooked);
+                return std::make_shared<OpenGLTexture2D>(image);
+            case RendererAPI::None:
+                PIL_CORE_ASSERT(false, "RendererAPI::None is not supported!");
+                return nullptr;
+        }
+
+        PIL_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    bool Texture2D::Decode(const std::string& path, TextureImage& outImage, bool allowCooked)
+    {
+        std::string resolvedPath = AssetManager::GetTexturePath(path);
+        if (allowCooked)
+        {
+            if (auto cooked = LoadCooked(resolvedPath))
+            {
+                FillFromCooked(std::move(cooked), outImage);
+                return true;
+            }
+        }
+        else if (CookedTexture::IsCookedPath(resolvedPath))
+        {
+            PIL_CORE_ERROR("Cannot decode cooked texture '{0}' to pixels", path);
+            return false;
+        }
+
+        if (!std::filesystem::exists(resolvedPath))
+        {
+            PIL_CORE_WARN("Texture not found: {0}", path);
+            return false;
+        }
+
+        int width, height, channels;
+        stbi_set_flip_vertically_on_load_thread(1);
+        stbi_uc* data = stbi_load(resolvedPath.c_str(), &width, &height, &channels, 0);
+        if (!data)
+        {
+            PIL_CORE_ERROR("Failed to decode texture '{0}': {1}", path, stbi_failure_reason());
+            return false;
+        }
+
+        if (channels != 3 && channels != 4)
+        {
+            PIL_CORE_ERROR("Failed to decode texture '{0}': unsupported channel count {1}", path, channels);
+            stbi_image_free(data);
+            return false;
+        }
+
+        outImage.Path = resolvedPath;
+        outImage.Width = static_cast<uint32_t>(width);
+        outImage.Height = static_cast<uint32_t>(height);
+        outImage.Channels = static_cast<uint32_t>(channels);
+        outImage.Cooked.reset();
+        outImage.Pixels.resize(static_cast<size_t>(width) * height * channels);
+        std::memcpy(outImage.Pixels.data(), data, outImage.Pixels.size());
+        stbi_image_free(data);
+        return true;
+    }
+
 }
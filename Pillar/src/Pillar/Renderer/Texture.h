@@ -4,9 +4,12 @@
 #include <string>
 #include <memory>
 #include <cstdint>
+#include <vector>
 
 namespace Pillar {
 
+    class CookedTexture;
+
     class PIL_API Texture
     {
     public:
@@ -19,6 +22,29 @@ namespace Pillar {
         virtual void Bind(uint32_t slot = 0) const = 0;
     };
 
+    /**
+     * @brief Decoded pixels of an image file, ready for upload
+     *
+     * Produced by Texture2D::Decode, which only touches the CPU and may run on
+     * any thread; Texture2D::Create(const TextureImage&) does the GPU upload and
+     * must run on the render thread. For cooked (.ptex) files Cooked is set
+     * instead of Pixels and the mapped levels are uploaded as they are.
+     */
+    struct TextureImage
+    {
+        std::string Path;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t Channels = 0;          // 3 (RGB) or 4 (RGBA)
+        std::vector<uint8_t> Pixels;    // Rows bottom-up, like the path constructor uploads them
+        std::shared_ptr<const CookedTexture> Cooked;
+
+        bool IsValid() const { return Width > 0 && Height > 0 && (!Pixels.empty() || Cooked); }
+
+        // Bytes the GPU upload will copy
+        size_t GetUploadSize() const;
+    };
+
     class PIL_API Texture2D : public Texture
     {
     public:
@@ -26,6 +52,11 @@ namespace Pillar {
 
         static std::shared_ptr<Texture2D> Create(const std::string& path);
         static std::shared_ptr<Texture2D> Create(uint32_t width, uint32_t height);
+        static std::shared_ptr<Texture2D> Create(const TextureImage& image);
+
+        // Decode an image file (resolved through AssetManager) without touching the GPU.
+        // An up-to-date cooked .ptex next to the file is mapped instead, unless allowCooked is false.
+        static bool Decode(const std::string& path, TextureImage& outImage, bool allowCooked = true);
     };
 
 }
@@ -0,0 +1,484 @@
+#include "Pillar/Renderer/TextureCooker.h"
+#include "Pillar/Renderer/Texture.h"
+#include "Pillar/Utils/ThreadPool.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace Pillar {
+
+    using namespace CookedTextures;
+
+    namespace {
+
+        int SquaredDistance(const int* a, const int* b, int channels)
+        {
+            int sum = 0;
+            for (int c = 0; c < channels; ++c)
+                sum += (a[c] - b[c]) * (a[c] - b[c]);
+            return sum;
+        }
+
+        /**
+         * Endpoints for a set of texels: the bounding box, flipped per channel to
+         * follow the dominant diagonal, then pulled in by 1/16 of the range so
+         * the interpolated colors land nearer the data.
+         */
+        void FindEndpoints(const int (*texels)[4], int count, int channels, int* lo, int* hi)
+        {
+            int sum[4] = {};
+            for (int c = 0; c < channels; ++c)
+            {
+                lo[c] = 255;
+                hi[c] = 0;
+            }
+            for (int i = 0; i < count; ++i)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    lo[c] = std::min(lo[c], texels[i][c]);
+                    hi[c] = std::max(hi[c], texels[i][c]);
+                    sum[c] += texels[i][c];
+                }
+            }
+
+            int dominant = 0;
+            for (int c = 1; c < channels; ++c)
+            {
+                if (hi[c] - lo[c] > hi[dominant] - lo[dominant])
+                    dominant = c;
+            }
+
+            // Channels falling while the dominant one rises run along the other diagonal
+            for (int c = 0; c < channels; ++c)
+            {
+                if (c == dominant)
+                    continue;
+                int64_t covariance = 0;
+                for (int i = 0; i < count; ++i)
+                    covariance += static_cast<int64_t>(texels[i][c] * count - sum[c]) * (texels[i][dominant] * count - sum[dominant]);
+                if (covariance < 0)
+                    std::swap(lo[c], hi[c]);
+            }
+
+            for (int c = 0; c < channels; ++c)
+            {
+                const int inset = (hi[c] - lo[c]) / 16;
+                lo[c] += inset;
+                hi[c] -= inset;
+            }
+        }
+
+        uint16_t To565(const int* color)
+        {
+            return static_cast<uint16_t>(((color[0] * 31 + 127) / 255) << 11 | ((color[1] * 63 + 127) / 255) << 5 | ((color[2] * 31 + 127) / 255));
+        }
+
+        void From565(uint16_t packed, int* color)
+        {
+            const int r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+            color[0] = (r << 3) | (r >> 2);
+            color[1] = (g << 2) | (g >> 4);
+            color[2] = (b << 3) | (b >> 2);
+        }
+
+        void WriteLE16(uint8_t* out, uint16_t value)
+        {
+            out[0] = static_cast<uint8_t>(value);
+            out[1] = static_cast<uint8_t>(value >> 8);
+        }
+
+        // BC1 color block (also the color half of BC3, where punchThrough is false)
+        void EncodeColorBlock(const uint8_t* texels, bool punchThrough, uint8_t* out)
+        {
+            int colors[16][4];
+            int opaque[16][4];
+            int opaqueCount = 0;
+            bool transparent = false;
+            for (int i = 0; i < 16; ++i)
+            {
+                for (int c = 0; c < 4; ++c)
+                    colors[i][c] = texels[i * 4 + c];
+                if (punchThrough && colors[i][3] < 128)
+                    transparent = true;
+                else
+                    std::memcpy(opaque[opaqueCount++], colors[i], sizeof(colors[i]));
+            }
+
+            int lo[4] = {}, hi[4] = {};
+            if (opaqueCount > 0)
+                FindEndpoints(opaque, opaqueCount, 3, lo, hi);
+
+            uint16_t color0 = To565(hi), color1 = To565(lo);
+
+            // color0 > color1 selects four colors; color0 <= color1 selects three plus transparent black
+            if (transparent ? color0 > color1 : color0 < color1)
+                std::swap(color0, color1);
+
+            int palette[4][4] = {};
+            From565(color0, palette[0]);
+            From565(color1, palette[1]);
+            int paletteSize = 4;
+            if (transparent || color0 == color1)
+            {
+                for (int c = 0; c < 3; ++c)
+                    palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+                paletteSize = 3;
+            }
+            else
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                    palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+                }
+            }
+
+            uint32_t indices = 0;
+            for (int i = 0; i < 16; ++i)
+            {
+                uint32_t best = 3;
+                if (!(transparent && colors[i][3] < 128))
+                {
+                    int bestError = INT32_MAX;
+                    for (int p = 0; p < paletteSize; ++p)
+                    {
+                        const int error = SquaredDistance(colors[i], palette[p], 3);
+                        if (error < bestError)
+                        {
+                            bestError = error;
+                            best = static_cast<uint32_t>(p);
+                        }
+                    }
+                }
+                indices |= best << (2 * i);
+            }
+
+            WriteLE16(out, color0);
+            WriteLE16(out + 2, color1);
+            for (int b = 0; b < 4; ++b)
+                out[4 + b] = static_cast<uint8_t>(indices >> (8 * b));
+        }
+
+        // BC3 alpha block: two endpoints and 3-bit indices into 8 interpolated values
+        void EncodeAlphaBlock(const uint8_t* texels, uint8_t* out)
+        {
+            int lo = 255, hi = 0;
+            for (int i = 0; i < 16; ++i)
+            {
+                lo = std::min(lo, static_cast<int>(texels[i * 4 + 3]));
+                hi = std::max(hi, static_cast<int>(texels[i * 4 + 3]));
+            }
+
+            std::memset(out, 0, 8);
+            out[0] = static_cast<uint8_t>(hi);
+            out[1] = static_cast<uint8_t>(lo);
+            if (hi == lo)
+                return;
+
+            int palette[8] = { hi, lo };
+            for (int i = 1; i < 7; ++i)
+                palette[i + 1] = ((7 - i) * hi + i * lo) / 7;
+
+            uint64_t indices = 0;
+            for (int i = 0; i < 16; ++i)
+            {
+                const int alpha = texels[i * 4 + 3];
+                uint64_t best = 0;
+                int bestError = INT32_MAX;
+                for (int p = 0; p < 8; ++p)
+                {
+                    const int error = std::abs(alpha - palette[p]);
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        best = static_cast<uint64_t>(p);
+                    }
+                }
+                indices |= best << (3 * i);
+            }
+            for (int b = 0; b < 6; ++b)
+                out[2 + b] = static_cast<uint8_t>(indices >> (8 * b));
+        }
+
+        // Little-endian bit packer for a 128-bit block
+        struct BlockWriter
+        {
+            uint8_t* Out;
+            uint32_t Bit = 0;
+
+            void Put(uint32_t value, uint32_t bits)
+            {
+                for (uint32_t i = 0; i < bits; ++i, ++Bit)
+                    Out[Bit >> 3] |= static_cast<uint8_t>(((value >> i) & 1u) << (Bit & 7));
+            }
+        };
+
+        // BC7 mode 6 endpoint: 7 bits per channel plus a p-bit shared by the channels
+        void QuantizeBC7Endpoint(const int* color, int* quantized, int& pbit)
+        {
+            int bestError = INT32_MAX;
+            for (int p = 0; p < 2; ++p)
+            {
+                int candidate[4], error = 0;
+                for (int c = 0; c < 4; ++c)
+                {
+                    candidate[c] = std::clamp((color[c] - p + 1) >> 1, 0, 127);
+                    const int expanded = (candidate[c] << 1) | p;
+                    error += (expanded - color[c]) * (expanded - color[c]);
+                }
+                if (error < bestError)
+                {
+                    bestError = error;
+                    pbit = p;
+                    std::memcpy(quantized, candidate, sizeof(candidate));
+                }
+            }
+        }
+
+        // Encode one level of RGBA8 texels into blocks, block rows split across the ThreadPool
+        void EncodeLevel(const uint8_t* texels, uint32_t width, uint32_t height, Format format, uint8_t* out)
+        {
+            if (format == Format::RGBA8)
+            {
+                std::memcpy(out, texels, static_cast<size_t>(width) * height * 4);
+                return;
+            }
+
+            const uint32_t blocksX = (width + 3) / 4;
+            const uint32_t blocksY = (height + 3) / 4;
+            const size_t blockSize = format == Format::BC1 ? 8 : 16;
+
+            ThreadPool::Get().ParallelFor(blocksY, 4, [&](size_t begin, size_t end) {
+                uint8_t block[64];
+                for (size_t by = begin; by < end; ++by)
+                {
+                    for (uint32_t bx = 0; bx < blocksX; ++bx)
+                    {
+                        // Edge blocks repeat the last row/column
+                        for (uint32_t y = 0; y < 4; ++y)
+                        {
+                            const uint32_t sy = std::min(static_cast<uint32_t>(by) * 4 + y, height - 1);
+                            for (uint32_t x = 0; x < 4; ++x)
+                            {
+                                const uint32_t sx = std::min(bx * 4 + x, width - 1);
+                                std::memcpy(block + (y * 4 + x) * 4, texels + (static_cast<size_t>(sy) * width + sx) * 4, 4);
+                            }
+                        }
+
+                        uint8_t* target = out + (by * blocksX + bx) * blockSize;
+                        switch (format)
+                        {
+                            case Format::BC1: TextureCooker::EncodeBC1Block(block, target); break;
+                            case Format::BC3: TextureCooker::EncodeBC3Block(block, target); break;
+                            case Format::BC7: TextureCooker::EncodeBC7Block(block, target); break;
+                            case Format::RGBA8: break;
+                        }
+                    }
+                }
+            });
+        }
+
+    }
+
+    void TextureCooker::EncodeBC1Block(const uint8_t* texels, uint8_t* outBlock)
+    {
+        EncodeColorBlock(texels, true, outBlock);
+    }
+
+    void TextureCooker::EncodeBC3Block(const uint8_t* texels, uint8_t* outBlock)
+    {
+        EncodeAlphaBlock(texels, outBlock);
+        EncodeColorBlock(texels, false, outBlock + 8);
+    }
+
+    void TextureCooker::EncodeBC7Block(const uint8_t* texels, uint8_t* outBlock)
+    {
+        static constexpr int kWeights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+        int colors[16][4];
+        for (int i = 0; i < 16; ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+                colors[i][c] = texels[i * 4 + c];
+        }
+
+        int lo[4], hi[4];
+        FindEndpoints(colors, 16, 4, lo, hi);
+
+        int endpoints[2][4], pbits[2];
+        QuantizeBC7Endpoint(lo, endpoints[0], pbits[0]);
+        QuantizeBC7Endpoint(hi, endpoints[1], pbits[1]);
+
+        int expanded[2][4];
+        for (int e = 0; e < 2; ++e)
+        {
+            for (int c = 0; c < 4; ++c)
+                expanded[e][c] = (endpoints[e][c] << 1) | pbits[e];
+        }
+
+        int palette[16][4];
+        for (int w = 0; w < 16; ++w)
+        {
+            for (int c = 0; c < 4; ++c)
+                palette[w][c] = ((64 - kWeights[w]) * expanded[0][c] + kWeights[w] * expanded[1][c] + 32) >> 6;
+        }
+
+        int indices[16];
+        for (int i = 0; i < 16; ++i)
+        {
+            int bestError = INT32_MAX;
+            for (int w = 0; w < 16; ++w)
+            {
+                const int error = SquaredDistance(colors[i], palette[w], 4);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    indices[i] = w;
+                }
+            }
+        }
+
+        // The first index is stored without its top bit, so it must be below 8
+        if (indices[0] >= 8)
+        {
+            std::swap(endpoints[0], endpoints[1]);
+            std::swap(pbits[0], pbits[1]);
+            for (int& index : indices)
+                index = 15 - index;
+        }
+
+        std::memset(outBlock, 0, 16);
+        BlockWriter writer{ outBlock };
+        writer.Put(1u << 6, 7);                     // Mode 6
+        for (int c = 0; c < 4; ++c)
+        {
+            writer.Put(static_cast<uint32_t>(endpoints[0][c]), 7);
+            writer.Put(static_cast<uint32_t>(endpoints[1][c]), 7);
+        }
+        writer.Put(static_cast<uint32_t>(pbits[0]), 1);
+        writer.Put(static_cast<uint32_t>(pbits[1]), 1);
+        writer.Put(static_cast<uint32_t>(indices[0]), 3);
+        for (int i = 1; i < 16; ++i)
+            writer.Put(static_cast<uint32_t>(indices[i]), 4);
+    }
+
+    void TextureCooker::Downsample(const uint8_t* texels, uint32_t width, uint32_t height, std::vector<uint8_t>& outTexels)
+    {
+        const uint32_t outWidth = std::max(width / 2, 1u);
+        const uint32_t outHeight = std::max(height / 2, 1u);
+        outTexels.resize(static_cast<size_t>(outWidth) * outHeight * 4);
+
+        for (uint32_t y = 0; y < outHeight; ++y)
+        {
+            const uint32_t y0 = std::min(y * 2, height - 1), y1 = std::min(y * 2 + 1, height - 1);
+            for (uint32_t x = 0; x < outWidth; ++x)
+            {
+                const uint32_t x0 = std::min(x * 2, width - 1), x1 = std::min(x * 2 + 1, width - 1);
+                for (uint32_t c = 0; c < 4; ++c)
+                {
+                    const uint32_t sum = texels[(static_cast<size_t>(y0) * width + x0) * 4 + c] + texels[(static_cast<size_t>(y0) * width + x1) * 4 + c]
+                                       + texels[(static_cast<size_t>(y1) * width + x0) * 4 + c] + texels[(static_cast<size_t>(y1) * width + x1) * 4 + c];
+                    outTexels[(static_cast<size_t>(y) * outWidth + x) * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+    }
+
+    bool TextureCooker::Cook(const TextureImage& image, const TextureCookSettings& settings, std::vector<uint8_t>& outFile)
+    {
+        if (!image.IsValid() || image.Cooked || (image.Channels != 3 && image.Channels != 4) ||
+            image.Pixels.size() < static_cast<size_t>(image.Width) * image.Height * image.Channels)
+        {
+            PIL_CORE_ERROR("TextureCooker: '{0}' has no RGB/RGBA pixels to cook", image.Path);
+            return false;
+        }
+        if (image.Width > kMaxDimension || image.Height > kMaxDimension)
+        {
+            PIL_CORE_ERROR("TextureCooker: '{0}' is {1}x{2}, larger than {3}", image.Path, image.Width, image.Height, kMaxDimension);
+            return false;
+        }
+
+        // Every level is built from RGBA8
+        std::vector<uint8_t> level(static_cast<size_t>(image.Width) * image.Height * 4);
+        for (size_t i = 0, count = static_cast<size_t>(image.Width) * image.Height; i < count; ++i)
+        {
+            for (uint32_t c = 0; c < 3; ++c)
+                level[i * 4 + c] = image.Pixels[i * image.Channels + c];
+            level[i * 4 + 3] = image.Channels == 4 ? image.Pixels[i * 4 + 3] : 255;
+        }
+
+        FileHeader header;
+        header.PixelFormat = settings.Format;
+        header.Width = image.Width;
+        header.Height = image.Height;
+        header.MipCount = settings.GenerateMips ? GetFullMipCount(image.Width, image.Height) : 1;
+
+        std::vector<MipEntry> entries(header.MipCount);
+        size_t offset = AlignUp(sizeof(FileHeader) + entries.size() * sizeof(MipEntry));
+        for (uint32_t i = 0; i < header.MipCount; ++i)
+        {
+            entries[i].Width = GetMipDimension(image.Width, i);
+            entries[i].Height = GetMipDimension(image.Height, i);
+            entries[i].Size = GetLevelSize(settings.Format, entries[i].Width, entries[i].Height);
+            entries[i].Offset = offset;
+            offset = AlignUp(offset + entries[i].Size);
+        }
+
+        outFile.assign(offset, 0);
+        std::memcpy(outFile.data(), &header, sizeof(header));
+        std::memcpy(outFile.data() + sizeof(header), entries.data(), entries.size() * sizeof(MipEntry));
+
+        std::vector<uint8_t> next;
+        for (uint32_t i = 0; i < header.MipCount; ++i)
+        {
+            EncodeLevel(level.data(), entries[i].Width, entries[i].Height, settings.Format, outFile.data() + entries[i].Offset);
+            if (i + 1 < header.MipCount)
+            {
+                Downsample(level.data(), entries[i].Width, entries[i].Height, next);
+                level.swap(next);
+            }
+        }
+        return true;
+    }
+
+    bool TextureCooker::CookFile(const std::string& sourcePath, const std::string& cookedPath, const TextureCookSettings& settings)
+    {
+        TextureImage image;
+        if (!Texture2D::Decode(sourcePath, image, false))
+        {
+            PIL_CORE_ERROR("TextureCooker: Failed to decode source image {0}", sourcePath);
+            return false;
+        }
+
+        std::vector<uint8_t> file;
+        if (!Cook(image, settings, file))
+            return false;
+
+        std::ofstream out(cookedPath, std::ios::binary | std::ios::trunc);
+        if (!out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size())))
+        {
+            PIL_CORE_ERROR("TextureCooker: Failed to write {0}", cookedPath);
+            return false;
+        }
+
+        PIL_CORE_INFO("TextureCooker: {0} -> {1} ({2}x{3} {4}, {5} KB)", sourcePath, cookedPath,
+            image.Width, image.Height, GetFormatName(settings.Format), file.size() / 1024);
+        return true;
+    }
+
+    const char* TextureCooker::GetFormatName(Format format)
+    {
+        switch (format)
+        {
+            case Format::RGBA8: return "RGBA8";
+            case Format::BC1:   return "BC1";
+            case Format::BC3:   return "BC3";
+            case Format::BC7:   return "BC7";
+        }
+        return "Unknown";
+    }
+
+}
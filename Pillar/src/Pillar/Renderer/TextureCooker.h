@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include "Pillar/Renderer/CookedTextureFormat.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pillar {
+
+    struct TextureImage;
+
+    struct TextureCookSettings
+    {
+        CookedTextures::Format Format = CookedTextures::Format::BC7;
+        bool GenerateMips = true;
+    };
+
+    /**
+     * @brief Converts source images into cooked (".ptex") textures, entirely on the CPU
+     *
+     * Needs no GPU or window, so it runs headless in the PillarTextureCooker tool
+     * and in tests. Mips are box-filtered down to 1x1; each level is then stored
+     * as RGBA8 or encoded to BC1/BC3/BC7. Levels are encoded in parallel on the
+     * ThreadPool.
+     */
+    class PIL_API TextureCooker
+    {
+    public:
+        /**
+         * @brief Cook decoded pixels into the bytes of a .ptex file
+         * @param image RGB or RGBA pixels, e.g. from Texture2D::Decode
+         * @return false if the image is empty, too large or not 3/4 channels
+         */
+        static bool Cook(const TextureImage& image, const TextureCookSettings& settings, std::vector<uint8_t>& outFile);
+
+        /**
+         * @brief Decode a source image and write its cooked file
+         * @param sourcePath Image to cook (resolved through AssetManager)
+         * @param cookedPath Output path, usually CookedTexture::GetCookedPath(sourcePath)
+         */
+        static bool CookFile(const std::string& sourcePath, const std::string& cookedPath, const TextureCookSettings& settings);
+
+        /**
+         * @brief Halve an RGBA8 level with a 2x2 box filter (a 1-texel side stays 1)
+         */
+        static void Downsample(const uint8_t* texels, uint32_t width, uint32_t height, std::vector<uint8_t>& outTexels);
+
+        // Block encoders: 16 RGBA8 texels in row order in, one block out
+        static void EncodeBC1Block(const uint8_t* texels, uint8_t* outBlock);     // 8 bytes; 1-bit alpha if any texel is below 128
+        static void EncodeBC3Block(const uint8_t* texels, uint8_t* outBlock);     // 16 bytes
+        static void EncodeBC7Block(const uint8_t* texels, uint8_t* outBlock);     // 16 bytes, mode 6
+
+        static const char* GetFormatName(CookedTextures::Format format);
+    };
+
+}
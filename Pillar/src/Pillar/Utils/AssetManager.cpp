@@ -1,6 +1,10 @@
 #include "Pillar/Utils/AssetManager.h"
 #include "Pillar/Renderer/Texture.h"
+#include "Pillar/Utils/ThreadPool.h"
 #include "Pillar/Logger.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #ifdef PIL_WINDOWS
@@ -12,6 +16,114 @@ namespace Pillar {
     std::filesystem::path AssetManager::s_AssetsDirectory = "";
     std::shared_ptr<Texture2D> AssetManager::s_MissingTexture = nullptr;
 
+    namespace {
+
+        constexpr size_t kDefaultUploadBudget = 4 * 1024 * 1024;
+
+        /**
+         * @brief Stand-in returned by LoadTextureAsync before the real texture is uploaded
+         *
+         * Draws as the missing texture, then forwards to the real one. The batch
+         * renderer keys texture slots on GetRendererID, so sprites holding the
+         * stand-in switch over on the frame the upload lands.
+         */
+        class StreamedTexture2D : public Texture2D
+        {
+        public:
+            uint32_t GetWidth() const override { return Current().GetWidth(); }
+            uint32_t GetHeight() const override { return Current().GetHeight(); }
+            uint32_t GetRendererID() const override { return Current().GetRendererID(); }
+            void Bind(uint32_t slot = 0) const override { Current().Bind(slot); }
+
+            void SetData(void* data, uint32_t size) override
+            {
+                if (m_Texture)
+                    m_Texture->SetData(data, size);
+                else
+                    PIL_CORE_WARN("AssetManager: SetData on a texture that is still loading is ignored");
+            }
+
+            // Render thread only, like every other call on a texture
+            void SetTexture(std::shared_ptr<Texture2D> texture) { m_Texture = std::move(texture); }
+
+        private:
+            Texture2D& Current() const
+            {
+                // The placeholder is created lazily so the stand-in itself needs no GPU
+                return m_Texture ? *m_Texture : *AssetManager::GetMissingTexture();
+            }
+
+            std::shared_ptr<Texture2D> m_Texture;
+        };
+
+        struct TextureEntry
+        {
+            std::string Path;
+            TextureLoadState State = TextureLoadState::Unloaded;
+            TextureImage Image;                         // Valid while Decoded
+            std::shared_ptr<Texture2D> Texture;         // Valid while Ready
+            std::shared_ptr<StreamedTexture2D> Proxy;   // Handed out by LoadTextureAsync until uploaded
+        };
+
+        // Entries are shared with in-flight decode tasks and the upload queue, so
+        // nothing a worker writes to is ever freed. Index 0 is the invalid handle.
+        struct TextureRegistry
+        {
+            std::mutex Mutex;
+            std::vector<std::shared_ptr<TextureEntry>> Entries{ nullptr };
+            std::unordered_map<std::string, TextureHandle> Handles;
+            std::deque<std::shared_ptr<TextureEntry>> Uploads;    // Decoded, oldest first
+            size_t UploadBudget = kDefaultUploadBudget;
+        };
+
+        TextureRegistry& GetTextureRegistry()
+        {
+            static TextureRegistry registry;
+            return registry;
+        }
+
+        // Caller holds the registry mutex
+        TextureHandle RegisterTexture(TextureRegistry& registry, const std::string& path)
+        {
+            auto [it, inserted] = registry.Handles.try_emplace(path, static_cast<TextureHandle>(registry.Entries.size()));
+            if (inserted)
+            {
+                auto entry = std::make_shared<TextureEntry>();
+                entry->Path = path;
+                registry.Entries.push_back(std::move(entry));
+            }
+            return it->second;
+        }
+
+        // Caller holds the registry mutex
+        void StartDecode(const std::shared_ptr<TextureEntry>& entry)
+        {
+            if (entry->State != TextureLoadState::Unloaded)
+                return;
+
+            entry->State = TextureLoadState::Decoding;
+            ThreadPool::Get().Submit([entry]() {
+                TextureImage image;
+                const bool decoded = Texture2D::Decode(entry->Path, image);
+
+                auto& registry = GetTextureRegistry();
+                std::lock_guard<std::mutex> lock(registry.Mutex);
+                if (decoded)
+                {
+                    entry->Image = std::move(image);
+                    entry->State = TextureLoadState::Decoded;
+                    registry.Uploads.push_back(entry);
+                }
+                else
+                {
+                    // The stand-in stays shared and keeps drawing the missing texture
+                    entry->State = TextureLoadState::Failed;
+                }
+            });
+        }
+
+    }
+
     std::filesystem::path AssetManager::GetExecutableDirectory()
     {
 #ifdef PIL_WINDOWS
@@ -337,4 +449,163 @@ namespace Pillar {
         return s_MissingTexture;
     }
 
+    TextureHandle AssetManager::GetTextureHandle(const std::string& path)
+    {
+        if (path.empty())
+            return InvalidTextureHandle;
+
+        auto& registry = GetTextureRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        return RegisterTexture(registry, path);
+    }
+
+    void AssetManager::PrefetchTexture(TextureHandle handle)
+    {
+        auto& registry = GetTextureRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        if (handle != InvalidTextureHandle && handle < registry.Entries.size())
+            StartDecode(registry.Entries[handle]);
+    }
+
+    void AssetManager::PrefetchTextures(const std::vector<TextureHandle>& handles)
+    {
+        auto& registry = GetTextureRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        for (TextureHandle handle : handles)
+        {
+            if (handle != InvalidTextureHandle && handle < registry.Entries.size())
+                StartDecode(registry.Entries[handle]);
+        }
+    }
+
+    std::shared_ptr<Texture2D> AssetManager::GetTexture(TextureHandle handle)
+    {
+        auto& registry = GetTextureRegistry();
+        std::unique_lock<std::mutex> lock(registry.Mutex);
+        if (handle == InvalidTextureHandle || handle >= registry.Entries.size())
+            return nullptr;
+
+        TextureEntry& entry = *registry.Entries[handle];
+        switch (entry.State)
+        {
+            case TextureLoadState::Ready:
+                return entry.Texture;
+
+            case TextureLoadState::Unloaded:
+                StartDecode(registry.Entries[handle]);
+                return nullptr;
+
+            case TextureLoadState::Decoding:
+            case TextureLoadState::Decoded:
+                return nullptr;
+
+            case TextureLoadState::Failed:
+                break;
+        }
+
+        lock.unlock();
+        return GetMissingTexture();
+    }
+
+    std::shared_ptr<Texture2D> AssetManager::LoadTextureAsync(const std::string& path)
+    {
+        if (path.empty())
+            return nullptr;
+
+        auto& registry = GetTextureRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+
+        const std::shared_ptr<TextureEntry>& entry = registry.Entries[RegisterTexture(registry, path)];
+        if (entry->State == TextureLoadState::Ready)
+            return entry->Texture;
+
+        // One stand-in per path until it is uploaded, failed loads included: it draws
+        // the same fallback as Texture2D::Create without touching the GPU here
+        StartDecode(entry);
+        if (!entry->Proxy)
+            entry->Proxy = std::make_shared<StreamedTexture2D>();
+        return entry->Proxy;
+    }
+
+    void AssetManager::ProcessTextureUploads()
+    {
+        auto& registry = GetTextureRegistry();
+        std::unique_lock<std::mutex> lock(registry.Mutex);
+
+        size_t uploaded = 0;
+        while (!registry.Uploads.empty())
+        {
+            const std::shared_ptr<TextureEntry>& front = registry.Uploads.front();
+            if (front->State != TextureLoadState::Decoded)
+            {
+                registry.Uploads.pop_front();   // Unloaded since it was queued
+                continue;
+            }
+
+            // Leave the texture queued if it would overshoot the budget, unless
+            // nothing was uploaded yet so an oversized image still gets through
+            const size_t uploadSize = front->Image.GetUploadSize();
+            if (uploaded > 0 && uploaded + uploadSize > registry.UploadBudget)
+                break;
+
+            std::shared_ptr<TextureEntry> entry = std::move(registry.Uploads.front());
+            registry.Uploads.pop_front();
+
+            // Upload outside the lock so workers finishing decodes are not held up.
+            // Only this thread moves entries out of Decoded, so the state holds.
+            TextureImage image = std::move(entry->Image);
+            entry->Image = TextureImage{};
+            lock.unlock();
+
+            uploaded += uploadSize > 0 ? uploadSize : 1;
+            std::shared_ptr<Texture2D> texture = Texture2D::Create(image);
+
+            lock.lock();
+            entry->Texture = texture;
+            entry->State = TextureLoadState::Ready;
+            if (entry->Proxy)
+            {
+                entry->Proxy->SetTexture(std::move(texture));
+                entry->Proxy.reset();
+            }
+        }
+    }
+
+    void AssetManager::SetTextureUploadBudget(size_t bytesPerFrame)
+    {
+        auto& registry = GetTextureRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        registry.UploadBudget = bytesPerFrame;
+    }
+
+    size_t AssetManager::GetTextureUploadBudget()
+    {
+        auto& registry = GetTextureRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        return registry.UploadBudget;
+    }
+
+    TextureLoadState AssetManager::GetTextureState(TextureHandle handle)
+    {
+        auto& registry = GetTextureRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        if (handle == InvalidTextureHandle || handle >= registry.Entries.size())
+            return TextureLoadState::Unloaded;
+        return registry.Entries[handle]->State;
+    }
+
+    void AssetManager::UnloadTextures()
+    {
+        auto& registry = GetTextureRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        for (size_t i = 1; i < registry.Entries.size(); ++i)
+        {
+            TextureEntry& entry = *registry.Entries[i];
+            if (entry.State == TextureLoadState::Decoding || entry.State == TextureLoadState::Decoded)
+                continue;   // Its stand-in is still waiting for the upload
+            entry.Texture.reset();
+            entry.State = TextureLoadState::Unloaded;
+        }
+    }
+
 }
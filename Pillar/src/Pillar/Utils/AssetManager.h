@@ -2,14 +2,35 @@
 
 #include "Pillar/Core.h"
 #include <string>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <vector>
 
 namespace Pillar {
 
     // Forward declaration
     class Texture2D;
 
+    /**
+     * @brief Handle to a texture in the AssetManager registry
+     *
+     * Handles are dense, never reused, and valid for the life of the process,
+     * so systems can keep them in flat tables instead of paths.
+     */
+    using TextureHandle = uint32_t;
+    constexpr TextureHandle InvalidTextureHandle = 0;
+
+    enum class TextureLoadState : uint8_t
+    {
+        Unloaded,   // Registered, nothing requested yet
+        Decoding,   // Decode queued or running on the ThreadPool
+        Decoded,    // Pixels ready, queued for ProcessTextureUploads
+        Ready,      // GPU texture available
+        Failed      // File missing or undecodable (the missing texture is used)
+    };
+
     /**
      * @brief AssetManager handles asset path resolution and file loading
      *
@@ -85,6 +106,75 @@ namespace Pillar {
          */
         static void InitializeMissingTexture();
 
+        /**
+         * @brief Get the registry handle for a texture path, registering it on first use
+         * @param path Texture path as given to Texture2D::Create
+         * @return Handle shared by every caller using that path; InvalidTextureHandle for an empty path
+         *
+         * No file access happens here; call it once at load time and keep the handle.
+         * Thread-safe.
+         */
+        static TextureHandle GetTextureHandle(const std::string& path);
+
+        /**
+         * @brief Start decoding a texture on the ThreadPool if it is not loaded or loading
+         *
+         * Thread-safe. The GPU upload happens later in ProcessTextureUploads.
+         */
+        static void PrefetchTexture(TextureHandle handle);
+
+        /**
+         * @brief Prefetch several textures (e.g. every frame of an animation clip)
+         */
+        static void PrefetchTextures(const std::vector<TextureHandle>& handles);
+
+        /**
+         * @brief Get a registered texture without blocking
+         * @return The texture once uploaded, the missing texture if loading failed,
+         *         or nullptr while it is still loading. A texture that was never
+         *         requested starts loading.
+         */
+        static std::shared_ptr<Texture2D> GetTexture(TextureHandle handle);
+
+        /**
+         * @brief Load a texture in the background, deduplicated by path
+         * @return The texture itself if already uploaded; otherwise a stand-in that
+         *         draws as the missing texture until the real one is uploaded, then
+         *         forwards to it. Every caller asking for the same path shares it.
+         *
+         * Thread-safe and never touches the GPU, so scene deserialization can call
+         * it from a worker.
+         */
+        static std::shared_ptr<Texture2D> LoadTextureAsync(const std::string& path);
+
+        /**
+         * @brief Upload decoded textures to the GPU, oldest first, within the per-frame budget
+         *
+         * Call once per frame on the render thread (Application::Run does). At least
+         * one texture is uploaded per call, so one larger than the budget still
+         * gets through.
+         */
+        static void ProcessTextureUploads();
+
+        /**
+         * @brief Set how many bytes of pixel data ProcessTextureUploads may upload per call
+         */
+        static void SetTextureUploadBudget(size_t bytesPerFrame);
+        static size_t GetTextureUploadBudget();
+
+        /**
+         * @brief Current load state of a registered texture (Unloaded for unknown handles)
+         */
+        static TextureLoadState GetTextureState(TextureHandle handle);
+
+        /**
+         * @brief Drop the registry's references to loaded textures; handles stay valid and reload on use
+         *
+         * Textures still used elsewhere stay alive until released. Loads in flight
+         * are left to finish.
+         */
+        static void UnloadTextures();
+
     private:
         static std::filesystem::path s_AssetsDirectory;
         static std::shared_ptr<Texture2D> s_MissingTexture;
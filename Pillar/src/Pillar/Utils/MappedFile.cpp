@@ -0,0 +1,144 @@
+#include "Pillar/Utils/MappedFile.h"
+#include "Pillar/Logger.h"
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#ifdef PIL_WINDOWS
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Pillar {
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    void MappedFile::MoveFrom(MappedFile& other) noexcept
+    {
+        m_Data = std::exchange(other.m_Data, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+        m_Open = std::exchange(other.m_Open, false);
+        m_Mapping = std::exchange(other.m_Mapping, nullptr);
+#ifdef PIL_WINDOWS
+        m_MappingHandle = std::exchange(other.m_MappingHandle, nullptr);
+#endif
+        m_Fallback = std::move(other.m_Fallback);
+        if (!m_Mapping && !m_Fallback.empty())
+            m_Data = m_Fallback.data();
+    }
+
+    bool MappedFile::Open(const std::string& path)
+    {
+        Close();
+
+#ifdef PIL_WINDOWS
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            LARGE_INTEGER size{};
+            if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+            {
+                HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping)
+                {
+                    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    if (view)
+                    {
+                        m_MappingHandle = mapping;
+                        m_Mapping = view;
+                        m_Data = static_cast<const uint8_t*>(view);
+                        m_Size = static_cast<size_t>(size.QuadPart);
+                        m_Open = true;
+                    }
+                    else
+                    {
+                        CloseHandle(mapping);
+                    }
+                }
+            }
+            CloseHandle(file); // The mapping keeps its own reference
+            if (m_Open)
+                return true;
+        }
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd >= 0)
+        {
+            struct stat info {};
+            if (::fstat(fd, &info) == 0 && info.st_size > 0)
+            {
+                void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (view != MAP_FAILED)
+                {
+                    m_Mapping = view;
+                    m_Data = static_cast<const uint8_t*>(view);
+                    m_Size = static_cast<size_t>(info.st_size);
+                    m_Open = true;
+                }
+            }
+            ::close(fd); // The mapping stays valid after the descriptor is closed
+            if (m_Open)
+                return true;
+        }
+#endif
+
+        // Fallback: read the whole file
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            PIL_CORE_ERROR("MappedFile: failed to open {}", path);
+            return false;
+        }
+
+        m_Fallback.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_Data = m_Fallback.empty() ? nullptr : m_Fallback.data();
+        m_Size = m_Fallback.size();
+        m_Open = true;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Mapping)
+        {
+#ifdef PIL_WINDOWS
+            UnmapViewOfFile(m_Mapping);
+            CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+            m_MappingHandle = nullptr;
+#else
+            ::munmap(m_Mapping, m_Size);
+#endif
+            m_Mapping = nullptr;
+        }
+
+        m_Fallback.clear();
+        m_Fallback.shrink_to_fit();
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Open = false;
+    }
+
+} // namespace Pillar
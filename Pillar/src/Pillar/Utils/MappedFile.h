@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pillar {
+
+    /**
+     * @brief Read-only view of a whole file, memory-mapped when the platform allows
+     *
+     * The mapping is private and read-only, so pages are faulted in lazily and
+     * never copied unless touched. If mapping fails (or the file is empty) the
+     * file is read into an owned buffer instead; callers see the same Data()/Size()
+     * either way. The view stays valid until Close() or destruction.
+     */
+    class PIL_API MappedFile
+    {
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::string& path) { Open(path); }
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const { return m_Open; }
+        bool IsMapped() const { return m_Mapping != nullptr; }
+        const uint8_t* Data() const { return m_Data; }
+        size_t Size() const { return m_Size; }
+
+    private:
+        void MoveFrom(MappedFile& other) noexcept;
+
+        const uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+        bool m_Open = false;
+
+        void* m_Mapping = nullptr;        // Mapped view (nullptr when using the fallback buffer)
+#ifdef PIL_WINDOWS
+        void* m_MappingHandle = nullptr;  // HANDLE from CreateFileMapping
+#endif
+        std::vector<uint8_t> m_Fallback;
+    };
+
+} // namespace Pillar
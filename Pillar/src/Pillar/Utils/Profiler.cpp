@@ -0,0 +1,341 @@
+#include "Profiler.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace Pillar {
+
+    std::atomic<bool> Profiler::s_Capturing{ false };
+
+    namespace {
+
+        // Fixed-size block of events. The owning thread fills Events[Count] and then
+        // publishes it by bumping Count, so readers never see a half-written event.
+        struct EventChunk
+        {
+            ProfileEvent Events[Profiler::ChunkCapacity];
+            std::atomic<uint32_t> Count{ 0 };
+            std::atomic<EventChunk*> Next{ nullptr };
+        };
+
+        struct ThreadBuffer
+        {
+            uint32_t Id = 0;
+            std::string Name;                       // Guarded by the registry mutex
+
+            // Written only by the owning thread
+            EventChunk Head;
+            EventChunk* Current = &Head;
+            size_t ChunkCount = 1;
+            uint32_t Depth = 0;
+
+            std::atomic<uint64_t> Epoch{ 0 };       // Capture the contents belong to
+            std::atomic<uint64_t> Dropped{ 0 };
+            std::atomic<bool> Exited{ false };
+
+            ~ThreadBuffer()
+            {
+                EventChunk* chunk = Head.Next.load(std::memory_order_relaxed);
+                while (chunk)
+                {
+                    EventChunk* next = chunk->Next.load(std::memory_order_relaxed);
+                    delete chunk;
+                    chunk = next;
+                }
+            }
+
+            // Start over for a new capture, keeping the chunks for reuse
+            void Reset(uint64_t epoch)
+            {
+                for (EventChunk* chunk = &Head; chunk; chunk = chunk->Next.load(std::memory_order_relaxed))
+                    chunk->Count.store(0, std::memory_order_relaxed);
+                Current = &Head;
+                Dropped.store(0, std::memory_order_relaxed);
+                Epoch.store(epoch, std::memory_order_release);
+            }
+        };
+
+        struct BufferRegistry
+        {
+            std::mutex Mutex;
+            std::vector<std::shared_ptr<ThreadBuffer>> Buffers;
+            uint32_t NextThreadId = 1;
+        };
+
+        BufferRegistry& GetRegistry()
+        {
+            static BufferRegistry registry;
+            return registry;
+        }
+
+        // Bumped by every Start(); buffers from an older capture read as empty
+        std::atomic<uint64_t> s_CaptureEpoch{ 0 };
+
+        // Keeps the buffer alive in the registry after its thread exits, so a
+        // capture can still be exported once worker threads are gone
+        struct ThreadBufferHandle
+        {
+            std::shared_ptr<ThreadBuffer> Buffer;
+
+            ~ThreadBufferHandle()
+            {
+                if (Buffer)
+                    Buffer->Exited.store(true, std::memory_order_release);
+            }
+        };
+
+        thread_local ThreadBufferHandle t_Handle;
+        thread_local std::string t_ThreadName;     // Applied when the buffer is created
+
+        ThreadBuffer& GetThreadBuffer()
+        {
+            if (!t_Handle.Buffer)
+            {
+                auto buffer = std::make_shared<ThreadBuffer>();
+                BufferRegistry& registry = GetRegistry();
+                std::lock_guard<std::mutex> lock(registry.Mutex);
+                buffer->Id = registry.NextThreadId++;
+                buffer->Name = t_ThreadName;
+                registry.Buffers.push_back(buffer);
+                t_Handle.Buffer = std::move(buffer);
+            }
+            return *t_Handle.Buffer;
+        }
+
+        std::chrono::steady_clock::time_point GetTimeOrigin()
+        {
+            static const auto origin = std::chrono::steady_clock::now();
+            return origin;
+        }
+
+        // Chrome trace timestamps are microseconds; keep nanosecond precision as decimals
+        void WriteMicroseconds(std::ostream& out, uint64_t ns)
+        {
+            char text[32];
+            std::snprintf(text, sizeof(text), "%llu.%03u",
+                static_cast<unsigned long long>(ns / 1000), static_cast<unsigned>(ns % 1000));
+            out << text;
+        }
+
+        void WriteJsonString(std::ostream& out, const char* text)
+        {
+            out << '"';
+            for (const char* c = text; *c; ++c)
+            {
+                switch (*c)
+                {
+                    case '"':  out << "\\\""; break;
+                    case '\\': out << "\\\\"; break;
+                    case '\n': out << "\\n"; break;
+                    case '\t': out << "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(*c) < 0x20)
+                        {
+                            char escaped[8];
+                            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+                            out << escaped;
+                        }
+                        else
+                            out << *c;
+                }
+            }
+            out << '"';
+        }
+
+    } // namespace
+
+    void Profiler::Start()
+    {
+        BufferRegistry& registry = GetRegistry();
+        {
+            // Buffers of exited threads only hold the capture being discarded
+            std::lock_guard<std::mutex> lock(registry.Mutex);
+            registry.Buffers.erase(std::remove_if(registry.Buffers.begin(), registry.Buffers.end(),
+                [](const std::shared_ptr<ThreadBuffer>& buffer) { return buffer->Exited.load(std::memory_order_acquire); }),
+                registry.Buffers.end());
+        }
+
+        GetTimeOrigin();
+        s_CaptureEpoch.fetch_add(1, std::memory_order_acq_rel);
+        s_Capturing.store(true, std::memory_order_release);
+        PIL_CORE_INFO("Profiler: capture started");
+    }
+
+    void Profiler::Stop()
+    {
+        if (!s_Capturing.exchange(false, std::memory_order_acq_rel))
+            return;
+        PIL_CORE_INFO("Profiler: capture stopped");
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        // Threads that never record a zone never get a buffer
+        t_ThreadName = name;
+        if (t_Handle.Buffer)
+        {
+            std::lock_guard<std::mutex> lock(GetRegistry().Mutex);
+            t_Handle.Buffer->Name = name;
+        }
+    }
+
+    uint64_t Profiler::Now()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - GetTimeOrigin()).count());
+    }
+
+    void Profiler::Record(const char* name, uint64_t startNs, uint64_t endNs, uint32_t depth)
+    {
+        ThreadBuffer& buffer = GetThreadBuffer();
+
+        const uint64_t epoch = s_CaptureEpoch.load(std::memory_order_relaxed);
+        if (buffer.Epoch.load(std::memory_order_relaxed) != epoch)
+            buffer.Reset(epoch);
+
+        EventChunk* chunk = buffer.Current;
+        uint32_t count = chunk->Count.load(std::memory_order_relaxed);
+        if (count == ChunkCapacity)
+        {
+            EventChunk* next = chunk->Next.load(std::memory_order_relaxed);
+            if (!next)
+            {
+                if (buffer.ChunkCount == MaxChunksPerThread)
+                {
+                    buffer.Dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                next = new EventChunk();
+                ++buffer.ChunkCount;
+                chunk->Next.store(next, std::memory_order_release);
+            }
+            buffer.Current = chunk = next;
+            count = 0;
+        }
+
+        chunk->Events[count] = { name, startNs, endNs - startNs, buffer.Id, depth };
+        chunk->Count.store(count + 1, std::memory_order_release);
+    }
+
+    std::vector<ProfileEvent> Profiler::Collect()
+    {
+        std::vector<ProfileEvent> events;
+        const uint64_t epoch = s_CaptureEpoch.load(std::memory_order_acquire);
+
+        BufferRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        for (const auto& buffer : registry.Buffers)
+        {
+            if (buffer->Epoch.load(std::memory_order_acquire) != epoch)
+                continue;
+
+            const size_t first = events.size();
+            for (const EventChunk* chunk = &buffer->Head; chunk; chunk = chunk->Next.load(std::memory_order_acquire))
+            {
+                const uint32_t count = chunk->Count.load(std::memory_order_acquire);
+                events.insert(events.end(), chunk->Events, chunk->Events + count);
+            }
+
+            // Zones are recorded as they close, so inner zones precede their parents
+            std::sort(events.begin() + first, events.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+                return a.StartNs != b.StartNs ? a.StartNs < b.StartNs : a.Depth < b.Depth;
+            });
+        }
+        return events;
+    }
+
+    uint64_t Profiler::GetDroppedEventCount()
+    {
+        uint64_t dropped = 0;
+        const uint64_t epoch = s_CaptureEpoch.load(std::memory_order_acquire);
+
+        BufferRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        for (const auto& buffer : registry.Buffers)
+        {
+            if (buffer->Epoch.load(std::memory_order_acquire) == epoch)
+                dropped += buffer->Dropped.load(std::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+    void Profiler::WriteChromeTrace(std::ostream& out)
+    {
+        const std::vector<ProfileEvent> events = Collect();
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+
+        {
+            BufferRegistry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.Mutex);
+            for (const auto& buffer : registry.Buffers)
+            {
+                if (buffer->Name.empty())
+                    continue;
+                out << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->Id
+                    << ",\"args\":{\"name\":";
+                WriteJsonString(out, buffer->Name.c_str());
+                out << "}}";
+                first = false;
+            }
+        }
+
+        for (const ProfileEvent& event : events)
+        {
+            out << (first ? "\n" : ",\n") << "{\"name\":";
+            WriteJsonString(out, event.Name ? event.Name : "");
+            out << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.ThreadId << ",\"ts\":";
+            WriteMicroseconds(out, event.StartNs);
+            out << ",\"dur\":";
+            WriteMicroseconds(out, event.DurationNs);
+            out << '}';
+            first = false;
+        }
+
+        out << "\n]}\n";
+    }
+
+    bool Profiler::WriteChromeTrace(const std::string& path)
+    {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file)
+        {
+            PIL_CORE_ERROR("Profiler: Failed to open {0} for writing", path);
+            return false;
+        }
+
+        WriteChromeTrace(file);
+        if (!file)
+        {
+            PIL_CORE_ERROR("Profiler: Failed to write {0}", path);
+            return false;
+        }
+
+        const uint64_t dropped = GetDroppedEventCount();
+        if (dropped > 0)
+            PIL_CORE_WARN("Profiler: {0} events did not fit in the per-thread buffers and are missing from {1}", dropped, path);
+        PIL_CORE_INFO("Profiler: wrote {0}", path);
+        return true;
+    }
+
+    void ProfileScope::Begin()
+    {
+        m_Depth = GetThreadBuffer().Depth++;
+        m_Active = true;
+        m_Start = Profiler::Now();
+    }
+
+    void ProfileScope::End()
+    {
+        const uint64_t end = Profiler::Now();
+        --GetThreadBuffer().Depth;
+        if (Profiler::IsCapturing())
+            Profiler::Record(m_Name, m_Start, end, m_Depth);
+    }
+
+} // namespace Pillar
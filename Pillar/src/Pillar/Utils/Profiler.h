@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// PIL_PROFILE is set by CMake (PILLAR_ENABLE_PROFILER). Without it the macros
+// below expand to nothing, so distribution builds carry no instrumentation.
+#ifndef PIL_PROFILE
+    #define PIL_PROFILE 0
+#endif
+
+namespace Pillar {
+
+    /** @brief One completed zone, as stored in a thread's buffer */
+    struct ProfileEvent
+    {
+        const char* Name = nullptr;     // Static string: a literal or the function name
+        uint64_t StartNs = 0;           // Since Profiler's time origin
+        uint64_t DurationNs = 0;
+        uint32_t ThreadId = 0;          // Profiler's own small sequential id
+        uint32_t Depth = 0;             // Nesting level on its thread, 0 = outermost
+    };
+
+    /**
+     * @brief Scoped-zone CPU profiler with Chrome trace export
+     *
+     * Zones are recorded with PIL_PROFILE_SCOPE / PIL_PROFILE_FUNCTION. Each
+     * thread appends to its own buffer of fixed-size chunks, so recording takes
+     * no lock and never moves existing events: the only shared state touched on
+     * the hot path is one relaxed load of the capture flag. When capture is off a
+     * zone costs that load and nothing else.
+     *
+     * Start() begins a fresh capture (earlier events are discarded), Stop() ends
+     * it. Collect and export while capture is stopped; zones still open at Stop()
+     * are dropped. The trace is Chrome's JSON format, which chrome://tracing and
+     * ui.perfetto.dev both open directly.
+     */
+    class PIL_API Profiler
+    {
+    public:
+        static void Start();
+        static void Stop();
+        static bool IsCapturing() { return s_Capturing.load(std::memory_order_relaxed); }
+
+        /** @brief Name the calling thread in exported traces (e.g. "Main", "Worker 2") */
+        static void SetThreadName(const std::string& name);
+
+        /** @brief Every event of the last capture, ordered by thread then start time */
+        static std::vector<ProfileEvent> Collect();
+
+        /** @brief Events that did not fit in a thread's buffer during the last capture */
+        static uint64_t GetDroppedEventCount();
+
+        static void WriteChromeTrace(std::ostream& out);
+        static bool WriteChromeTrace(const std::string& path);
+
+        // Nanoseconds since the profiler's time origin
+        static uint64_t Now();
+
+        // Called by ProfileScope
+        static void Record(const char* name, uint64_t startNs, uint64_t endNs, uint32_t depth);
+
+        // Events one thread keeps per capture before dropping (4096-event chunks)
+        static constexpr size_t ChunkCapacity = 4096;
+        static constexpr size_t MaxChunksPerThread = 256;
+
+    private:
+        static std::atomic<bool> s_Capturing;
+    };
+
+    /** @brief Records the enclosing scope as a zone while a capture is running */
+    class PIL_API ProfileScope
+    {
+    public:
+        explicit ProfileScope(const char* name)
+            : m_Name(name)
+        {
+            if (Profiler::IsCapturing())
+                Begin();
+        }
+
+        ~ProfileScope()
+        {
+            if (m_Active)
+                End();
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        void Begin();
+        void End();
+
+        const char* m_Name;
+        uint64_t m_Start = 0;
+        uint32_t m_Depth = 0;
+        bool m_Active = false;
+    };
+
+} // namespace Pillar
+
+#if PIL_PROFILE
+    #if defined(_MSC_VER)
+        #define PIL_PROFILE_FUNCTION_NAME __FUNCTION__
+    #else
+        #define PIL_PROFILE_FUNCTION_NAME __PRETTY_FUNCTION__
+    #endif
+    #define PIL_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define PIL_PROFILE_CONCAT(a, b) PIL_PROFILE_CONCAT_IMPL(a, b)
+    #define PIL_PROFILE_SCOPE(name) ::Pillar::ProfileScope PIL_PROFILE_CONCAT(pilProfileScope, __LINE__)(name)
+    #define PIL_PROFILE_FUNCTION() PIL_PROFILE_SCOPE(PIL_PROFILE_FUNCTION_NAME)
+    #define PIL_PROFILE_THREAD(name) ::Pillar::Profiler::SetThreadName(name)
+#else
+    #define PIL_PROFILE_SCOPE(name)
+    #define PIL_PROFILE_FUNCTION()
+    #define PIL_PROFILE_THREAD(name)
+#endif
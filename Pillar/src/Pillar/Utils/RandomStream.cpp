@@ -0,0 +1,189 @@
+#include "RandomStream.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <cmath>
+#include <glm/gtc/constants.hpp>
+
+namespace Pillar {
+namespace {
+    // SplitMix64 - used to expand seeds into generator state
+    uint64_t SplitMix64(uint64_t& x)
+    {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    inline uint32_t Rotl(uint32_t x, int k)
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    // Top 24 bits -> float in [0, 1)
+    inline float ToFloat01(uint32_t x)
+    {
+        return static_cast<float>(x >> 8) * (1.0f / 16777216.0f);
+    }
+
+    constexpr uint64_t kDefaultSeed = 0x5049'4C4C'4152'0001ull; // "PILLAR"
+
+    std::atomic<uint64_t> s_ThreadSeedBase{ kDefaultSeed };
+    std::atomic<uint64_t> s_ThreadSeedGeneration{ 0 };
+}
+
+RandomStream::RandomStream()
+{
+    Seed(kDefaultSeed);
+}
+
+RandomStream::RandomStream(uint64_t seed)
+{
+    Seed(seed);
+}
+
+void RandomStream::Seed(uint64_t seed)
+{
+    uint64_t sm = seed;
+    for (uint32_t i = 0; i < 4; i += 2)
+    {
+        const uint64_t v = SplitMix64(sm);
+        m_State[i] = static_cast<uint32_t>(v);
+        m_State[i + 1] = static_cast<uint32_t>(v >> 32);
+    }
+
+    for (uint32_t lane = 0; lane < kLanes; ++lane)
+    {
+        for (uint32_t i = 0; i < 4; i += 2)
+        {
+            const uint64_t v = SplitMix64(sm);
+            m_LaneState[i][lane] = static_cast<uint32_t>(v);
+            m_LaneState[i + 1][lane] = static_cast<uint32_t>(v >> 32);
+        }
+    }
+}
+
+uint32_t RandomStream::NextU32()
+{
+    uint32_t* s = m_State;
+    const uint32_t result = s[0] + s[3];
+    const uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = Rotl(s[3], 11);
+
+    return result;
+}
+
+float RandomStream::Float01()
+{
+    return ToFloat01(NextU32());
+}
+
+float RandomStream::Float(float min, float max)
+{
+    return min + (max - min) * Float01();
+}
+
+float RandomStream::AngleRadians()
+{
+    return Float01() * glm::two_pi<float>();
+}
+
+glm::vec2 RandomStream::Direction2D()
+{
+    const float angle = AngleRadians();
+    return glm::vec2(std::cos(angle), std::sin(angle));
+}
+
+void RandomStream::FillFloat01(float* out, size_t count)
+{
+    uint32_t* s0 = m_LaneState[0];
+    uint32_t* s1 = m_LaneState[1];
+    uint32_t* s2 = m_LaneState[2];
+    uint32_t* s3 = m_LaneState[3];
+
+    size_t i = 0;
+    while (i < count)
+    {
+        // One xoshiro128+ step in every lane (plain 32-bit ops, vectorizable)
+        uint32_t result[kLanes];
+        for (uint32_t lane = 0; lane < kLanes; ++lane)
+        {
+            result[lane] = s0[lane] + s3[lane];
+            const uint32_t t = s1[lane] << 9;
+
+            s2[lane] ^= s0[lane];
+            s3[lane] ^= s1[lane];
+            s1[lane] ^= s2[lane];
+            s0[lane] ^= s3[lane];
+            s2[lane] ^= t;
+            s3[lane] = Rotl(s3[lane], 11);
+        }
+
+        const size_t n = (count - i < kLanes) ? (count - i) : kLanes;
+        for (size_t lane = 0; lane < n; ++lane)
+            out[i + lane] = ToFloat01(result[lane]);
+        i += n;
+    }
+}
+
+void RandomStream::FillFloat(float* out, size_t count, float min, float max)
+{
+    FillFloat01(out, count);
+
+    const float range = max - min;
+    for (size_t i = 0; i < count; ++i)
+        out[i] = min + range * out[i];
+}
+
+void RandomStream::FillAngles(float* out, size_t count)
+{
+    FillFloat(out, count, 0.0f, glm::two_pi<float>());
+}
+
+void RandomStream::FillDirections(glm::vec2* out, size_t count)
+{
+    // Draw angles into the x slots, then expand in place
+    float angles[kLanes];
+    for (size_t i = 0; i < count; i += kLanes)
+    {
+        const size_t n = (count - i < kLanes) ? (count - i) : kLanes;
+        FillAngles(angles, n);
+        for (size_t lane = 0; lane < n; ++lane)
+            out[i + lane] = glm::vec2(std::cos(angles[lane]), std::sin(angles[lane]));
+    }
+}
+
+uint64_t RandomStream::DeriveSeed(uint64_t base, uint64_t id)
+{
+    uint64_t x = base ^ (id * 0xD1B54A32D192ED03ull);
+    return SplitMix64(x);
+}
+
+RandomStream& RandomStream::ThreadLocal()
+{
+    thread_local RandomStream stream;
+    thread_local uint64_t seededGeneration = ~0ull;
+
+    const uint64_t generation = s_ThreadSeedGeneration.load(std::memory_order_acquire);
+    if (seededGeneration != generation)
+    {
+        stream.Seed(DeriveSeed(s_ThreadSeedBase.load(), ThreadPool::GetCurrentWorkerIndex()));
+        seededGeneration = generation;
+    }
+    return stream;
+}
+
+void RandomStream::SetThreadSeedBase(uint64_t seed)
+{
+    s_ThreadSeedBase.store(seed);
+    s_ThreadSeedGeneration.fetch_add(1, std::memory_order_release);
+}
+
+} // namespace Pillar
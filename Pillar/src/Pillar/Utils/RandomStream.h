@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace Pillar {
+
+    /**
+     * @brief Fast, seedable random number stream (xoshiro128+)
+     *
+     * Unlike Pillar::Random (one global mt19937), a RandomStream is a small
+     * value type: give each system or thread its own instance and seed it
+     * deterministically with DeriveSeed (e.g. from scene seed + entity UUID)
+     * for reproducible replays.
+     *
+     * The Fill* batch generators run kLanes independent xoshiro128+ states
+     * side by side in 32-bit SoA arrays, so the compiler can vectorize them.
+     * Batch and single-value draws use separate state; both are fully
+     * determined by the seed and the sequence of calls.
+     */
+    class PIL_API RandomStream
+    {
+    public:
+        static constexpr uint32_t kLanes = 8;
+
+        RandomStream();
+        explicit RandomStream(uint64_t seed);
+
+        // Reset the stream (single-value and batch state) from a 64-bit seed.
+        void Seed(uint64_t seed);
+
+        // Random 32-bit integer.
+        uint32_t NextU32();
+
+        // Random float in [0, 1).
+        float Float01();
+
+        // Random float in [min, max).
+        float Float(float min, float max);
+
+        // Random angle in radians within [0, 2*pi).
+        float AngleRadians();
+
+        // Random unit-length 2D direction.
+        glm::vec2 Direction2D();
+
+        // Fill out[0..count) with random floats in [0, 1).
+        void FillFloat01(float* out, size_t count);
+
+        // Fill out[0..count) with random floats in [min, max).
+        void FillFloat(float* out, size_t count, float min, float max);
+
+        // Fill out[0..count) with random angles in radians within [0, 2*pi).
+        void FillAngles(float* out, size_t count);
+
+        // Fill out[0..count) with random unit-length 2D directions.
+        void FillDirections(glm::vec2* out, size_t count);
+
+        /**
+         * @brief Mix a base seed with an ID into a well-distributed 64-bit seed
+         * @param base Parent seed (e.g. Scene::GetRandomSeed())
+         * @param id Child identifier (e.g. entity UUID, system index, frame counter)
+         */
+        static uint64_t DeriveSeed(uint64_t base, uint64_t id);
+
+        /**
+         * @brief Stream owned by the calling thread
+         *
+         * Seeded from the thread seed base and ThreadPool::GetCurrentWorkerIndex(),
+         * so worker N gets the same sequence on every run. Threads outside the
+         * pool (the main thread included) all use index 0.
+         */
+        static RandomStream& ThreadLocal();
+
+        /**
+         * @brief Set the base seed for ThreadLocal() streams
+         *
+         * Existing thread streams are reseeded on their next ThreadLocal() call.
+         * Call this while no worker is drawing, e.g. when a scene is loaded.
+         */
+        static void SetThreadSeedBase(uint64_t seed);
+
+    private:
+        uint32_t m_State[4];
+        uint32_t m_LaneState[4][kLanes];
+    };
+
+} // namespace Pillar
@@ -0,0 +1,143 @@
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+
+namespace Pillar {
+
+    namespace {
+
+        thread_local uint32_t t_WorkerIndex = 0;
+
+        // Shared between ParallelFor and its helper tasks. Helpers may start after
+        // ParallelFor has returned; they then find no chunk left and exit without
+        // touching the (already destroyed) callable.
+        struct ParallelForState
+        {
+            const std::function<void(size_t, size_t)>* Fn = nullptr;
+            size_t Count = 0;
+            size_t ChunkSize = 0;
+            size_t ChunkCount = 0;
+            std::atomic<size_t> NextChunk{ 0 };
+            std::atomic<size_t> DoneChunks{ 0 };
+            std::mutex Mutex;
+            std::condition_variable Done;
+
+            // Claim and run chunks until none are left.
+            void Drain()
+            {
+                size_t chunk;
+                while ((chunk = NextChunk.fetch_add(1)) < ChunkCount)
+                {
+                    const size_t begin = chunk * ChunkSize;
+                    const size_t end = std::min(Count, begin + ChunkSize);
+                    (*Fn)(begin, end);
+
+                    if (DoneChunks.fetch_add(1) + 1 == ChunkCount)
+                    {
+                        std::lock_guard<std::mutex> lock(Mutex);
+                        Done.notify_all();
+                    }
+                }
+            }
+        };
+
+    } // namespace
+
+    ThreadPool::ThreadPool(uint32_t workerCount)
+    {
+        if (workerCount == 0)
+        {
+            const uint32_t hardware = std::thread::hardware_concurrency();
+            workerCount = hardware > 1 ? hardware - 1 : 1;
+        }
+
+        m_Workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i)
+            m_Workers.emplace_back([this, i]() { WorkerLoop(i + 1); });
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stopping = true;
+        }
+        m_Condition.notify_all();
+
+        for (auto& worker : m_Workers)
+            worker.join();
+    }
+
+    void ThreadPool::ParallelFor(size_t count, size_t minChunk, const std::function<void(size_t, size_t)>& fn)
+    {
+        if (count == 0)
+            return;
+
+        minChunk = std::max<size_t>(minChunk, 1);
+        const size_t maxChunks = static_cast<size_t>(GetWorkerCount()) + 1;
+        const size_t chunkCount = std::min(maxChunks, (count + minChunk - 1) / minChunk);
+
+        if (chunkCount <= 1)
+        {
+            fn(0, count);
+            return;
+        }
+
+        auto state = std::make_shared<ParallelForState>();
+        state->Fn = &fn;
+        state->Count = count;
+        state->ChunkSize = (count + chunkCount - 1) / chunkCount;
+        state->ChunkCount = (count + state->ChunkSize - 1) / state->ChunkSize;
+
+        for (size_t i = 1; i < state->ChunkCount; ++i)
+            Enqueue([state]() { state->Drain(); });
+
+        state->Drain();
+
+        std::unique_lock<std::mutex> lock(state->Mutex);
+        state->Done.wait(lock, [&state]() { return state->DoneChunks.load() == state->ChunkCount; });
+    }
+
+    ThreadPool& ThreadPool::Get()
+    {
+        static ThreadPool s_Pool;
+        return s_Pool;
+    }
+
+    uint32_t ThreadPool::GetCurrentWorkerIndex()
+    {
+        return t_WorkerIndex;
+    }
+
+    void ThreadPool::Enqueue(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Tasks.push_back(std::move(task));
+        }
+        m_Condition.notify_one();
+    }
+
+    void ThreadPool::WorkerLoop(uint32_t workerIndex)
+    {
+        PIL_PROFILE_THREAD("Worker");
+        t_WorkerIndex = workerIndex;
+
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Condition.wait(lock, [this]() { return m_Stopping || !m_Tasks.empty(); });
+                if (m_Stopping && m_Tasks.empty())
+                    return;
+
+                task = std::move(m_Tasks.front());
+                m_Tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+} // namespace Pillar
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Pillar/Core.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Pillar {
+
+    /**
+     * @brief Fixed set of worker threads for engine background work
+     *
+     * Submit() queues a one-off task and returns a future. ParallelFor() splits an
+     * index range into chunks that the workers and the calling thread claim
+     * dynamically; it blocks until every chunk is done. Because the caller keeps
+     * claiming chunks itself, ParallelFor is safe to call from a worker thread.
+     *
+     * Use ThreadPool::Get() for the shared engine pool rather than creating
+     * pools per system.
+     */
+    class PIL_API ThreadPool
+    {
+    public:
+        // workerCount == 0 -> hardware_concurrency() - 1 (at least 1)
+        explicit ThreadPool(uint32_t workerCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+        // Queue a task; the returned future holds its result (or exception).
+        template<typename Fn>
+        auto Submit(Fn&& fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>>>
+        {
+            using Result = std::invoke_result_t<std::decay_t<Fn>>;
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+            std::future<Result> future = task->get_future();
+            Enqueue([task]() { (*task)(); });
+            return future;
+        }
+
+        /**
+         * @brief Run fn(begin, end) over [0, count) in parallel and wait for completion
+         * @param minChunk Smallest range handed to one call; ranges below this run inline
+         */
+        void ParallelFor(size_t count, size_t minChunk, const std::function<void(size_t, size_t)>& fn);
+
+        // Shared engine-wide pool (created on first use).
+        static ThreadPool& Get();
+
+        // 1-based index of the calling worker within its pool; 0 on threads
+        // not owned by a pool (e.g. the main thread).
+        static uint32_t GetCurrentWorkerIndex();
+
+    private:
+        void Enqueue(std::function<void()> task);
+        void WorkerLoop(uint32_t workerIndex);
+
+        std::vector<std::thread> m_Workers;
+        std::deque<std::function<void()>> m_Tasks;
+        std::mutex m_Mutex;
+        std::condition_variable m_Condition;
+        bool m_Stopping = false;
+    };
+
+} // namespace Pillar
@@ -1,5 +1,6 @@
 #include "Platform/OpenAL/OpenALBuffer.h"
 #include "Platform/OpenAL/OpenALContext.h"
+#include "Pillar/Audio/AudioDecoder.h"
 #include "Pillar/Audio/WavLoader.h"
 #include "Pillar/Utils/AssetManager.h"
 #include "Pillar/Logger.h"
@@ -17,8 +18,25 @@ namespace Pillar {
             return;
         }
 
-        // Load the WAV file
-        if (!LoadWAV(filepath))
+        // Decode the file (WAV, IMA-ADPCM WAV or Ogg Vorbis)
+        if (!LoadFile(filepath))
+        {
+            alDeleteBuffers(1, &m_BufferID);
+            m_BufferID = 0;
+        }
+    }
+
+    OpenALBuffer::OpenALBuffer(const std::string& filepath, const WavData& wavData)
+        : m_FilePath(filepath)
+    {
+        alGenBuffers(1, &m_BufferID);
+        if (!OpenALContext::CheckError("alGenBuffers"))
+        {
+            PIL_CORE_ERROR("OpenALBuffer: Failed to generate buffer");
+            return;
+        }
+
+        if (!Upload(wavData))
         {
             alDeleteBuffers(1, &m_BufferID);
             m_BufferID = 0;
@@ -34,19 +52,24 @@ namespace Pillar {
         }
     }
 
-    bool OpenALBuffer::LoadWAV(const std::string& filepath)
+    bool OpenALBuffer::LoadFile(const std::string& filepath)
     {
         // Resolve the audio path
         std::string resolvedPath = AssetManager::GetAudioPath(filepath);
 
-        // Load WAV data
+        // Decode to PCM
         WavData wavData;
-        if (!WavLoader::Load(resolvedPath, wavData))
+        if (!AudioDecoder::Decode(resolvedPath, wavData))
         {
-            PIL_CORE_ERROR("OpenALBuffer: Failed to load WAV file: {0}", resolvedPath);
+            PIL_CORE_ERROR("OpenALBuffer: Failed to load audio file: {0}", resolvedPath);
             return false;
         }
 
+        return Upload(wavData);
+    }
+
+    bool OpenALBuffer::Upload(const WavData& wavData)
+    {
         // Store format info
         m_SampleRate = wavData.SampleRate;
         m_Channels = wavData.Channels;
@@ -72,9 +95,10 @@ namespace Pillar {
             return false;
         }
 
+        m_SizeInBytes = wavData.Data.size();
         m_Loaded = true;
         PIL_CORE_INFO("OpenALBuffer: Loaded '{0}' ({1}Hz, {2}ch, {3}-bit, {4:.2f}s)",
-            filepath, m_SampleRate, m_Channels, m_BitsPerSample, m_Duration);
+            m_FilePath, m_SampleRate, m_Channels, m_BitsPerSample, m_Duration);
         
         return true;
     }
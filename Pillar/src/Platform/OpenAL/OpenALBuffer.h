@@ -5,6 +5,8 @@
 
 namespace Pillar {
 
+    struct WavData;
+
     /**
      * @brief OpenAL implementation of AudioBuffer.
      */
@@ -12,10 +14,17 @@ namespace Pillar {
     {
     public:
         /**
-         * @brief Create an OpenAL buffer from a WAV file.
-         * @param filepath Path to the WAV file.
+         * @brief Create an OpenAL buffer from an audio file.
+         * @param filepath Path to a .wav or .ogg file.
          */
         OpenALBuffer(const std::string& filepath);
+
+        /**
+         * @brief Create an OpenAL buffer from already decoded WAV data.
+         * @param filepath Path the data was decoded from (for GetFilePath()).
+         * @param wavData Decoded samples and format.
+         */
+        OpenALBuffer(const std::string& filepath, const WavData& wavData);
         
         /**
          * @brief Destructor - releases OpenAL buffer.
@@ -28,16 +37,24 @@ namespace Pillar {
         int GetSampleRate() const override { return m_SampleRate; }
         int GetChannels() const override { return m_Channels; }
         int GetBitsPerSample() const override { return m_BitsPerSample; }
+        size_t GetSizeInBytes() const override { return m_SizeInBytes; }
         bool IsLoaded() const override { return m_Loaded; }
         const std::string& GetFilePath() const override { return m_FilePath; }
 
     private:
         /**
-         * @brief Load a WAV file into the OpenAL buffer.
-         * @param filepath Path to the WAV file.
+         * @brief Decode an audio file into the OpenAL buffer.
+         * @param filepath Path to a .wav or .ogg file.
          * @return true if loading succeeded, false otherwise.
          */
-        bool LoadWAV(const std::string& filepath);
+        bool LoadFile(const std::string& filepath);
+
+        /**
+         * @brief Upload decoded samples into the OpenAL buffer.
+         * @param wavData Decoded samples and format.
+         * @return true if the upload succeeded, false otherwise.
+         */
+        bool Upload(const WavData& wavData);
 
         /**
          * @brief Get the OpenAL format enum for the current audio format.
@@ -51,6 +68,7 @@ namespace Pillar {
         int m_SampleRate = 0;
         int m_Channels = 0;
         int m_BitsPerSample = 0;
+        size_t m_SizeInBytes = 0;
         bool m_Loaded = false;
     };
 
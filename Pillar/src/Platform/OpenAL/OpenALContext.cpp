@@ -6,6 +6,9 @@ namespace Pillar {
     ALCdevice* OpenALContext::s_Device = nullptr;
     ALCcontext* OpenALContext::s_Context = nullptr;
     bool OpenALContext::s_Initialized = false;
+    OpenALContext::DeferUpdatesFn OpenALContext::s_DeferUpdates = nullptr;
+    OpenALContext::DeferUpdatesFn OpenALContext::s_ProcessUpdates = nullptr;
+    int OpenALContext::s_DeferDepth = 0;
 
     bool OpenALContext::Init()
     {
@@ -65,6 +68,16 @@ namespace Pillar {
                                    0.0f, 1.0f, 0.0f }; // Up
         alListenerfv(AL_ORIENTATION, orientation);
 
+        // OpenAL Soft can batch property changes into a single mixer update
+        if (alIsExtensionPresent("AL_SOFT_deferred_updates"))
+        {
+            s_DeferUpdates = reinterpret_cast<DeferUpdatesFn>(alGetProcAddress("alDeferUpdatesSOFT"));
+            s_ProcessUpdates = reinterpret_cast<DeferUpdatesFn>(alGetProcAddress("alProcessUpdatesSOFT"));
+            if (!s_DeferUpdates || !s_ProcessUpdates)
+                s_DeferUpdates = s_ProcessUpdates = nullptr;
+        }
+        s_DeferDepth = 0;
+
         s_Initialized = true;
         PIL_CORE_INFO("OpenALContext: Initialized successfully");
         return true;
@@ -94,6 +107,8 @@ namespace Pillar {
             s_Device = nullptr;
         }
 
+        s_DeferUpdates = s_ProcessUpdates = nullptr;
+        s_DeferDepth = 0;
         s_Initialized = false;
         PIL_CORE_INFO("OpenALContext: Shutdown complete");
     }
@@ -118,4 +133,18 @@ namespace Pillar {
         return true;
     }
 
+    void OpenALContext::BeginDeferUpdates()
+    {
+        if (s_DeferDepth++ == 0 && s_DeferUpdates)
+            s_DeferUpdates();
+    }
+
+    void OpenALContext::EndDeferUpdates()
+    {
+        if (s_DeferDepth == 0)
+            return;
+        if (--s_DeferDepth == 0 && s_ProcessUpdates)
+            s_ProcessUpdates();
+    }
+
 }
@@ -50,10 +50,23 @@ namespace Pillar {
          */
         static bool CheckError(const char* operation);
 
+        /**
+         * @brief Hold property changes until the matching EndDeferUpdates() so
+         *        the mixer picks them up together. Calls nest.
+         * Uses AL_SOFT_deferred_updates; without it changes apply immediately.
+         */
+        static void BeginDeferUpdates();
+        static void EndDeferUpdates();
+
     private:
+        using DeferUpdatesFn = void (AL_APIENTRY*)(void);
+
         static ALCdevice* s_Device;
         static ALCcontext* s_Context;
         static bool s_Initialized;
+        static DeferUpdatesFn s_DeferUpdates;
+        static DeferUpdatesFn s_ProcessUpdates;
+        static int s_DeferDepth;
     };
 
 }
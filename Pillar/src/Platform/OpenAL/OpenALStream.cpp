@@ -0,0 +1,372 @@
+#include "Platform/OpenAL/OpenALStream.h"
+#include "Platform/OpenAL/OpenALContext.h"
+#include "Pillar/Audio/AudioEngine.h"
+#include "Pillar/Audio/AudioSource.h"
+#include "Pillar/Utils/AssetManager.h"
+#include "Pillar/Utils/ThreadPool.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Pillar {
+
+    OpenALStream::OpenALStream(const std::string& filepath)
+        : m_Decode(std::make_shared<DecodeState>()), m_FilePath(filepath)
+    {
+        const std::string resolvedPath = AssetManager::GetAudioPath(filepath);
+
+        auto& decode = *m_Decode;
+        decode.Decoder = AudioDecoder::Open(resolvedPath);
+        if (!decode.Decoder)
+        {
+            PIL_CORE_ERROR("OpenALStream: Failed to open audio file: {0}", resolvedPath);
+            return;
+        }
+
+        const AudioDecoder& decoder = *decode.Decoder;
+        if (decoder.GetChannels() == 1)
+            m_Format = (decoder.GetBitsPerSample() == 8) ? AL_FORMAT_MONO8 : AL_FORMAT_MONO16;
+        else
+            m_Format = (decoder.GetBitsPerSample() == 8) ? AL_FORMAT_STEREO8 : AL_FORMAT_STEREO16;
+
+        m_SampleRate = decoder.GetSampleRate();
+        m_Duration = decoder.GetDuration();
+
+        decode.FrameSize = decoder.GetFrameSize();
+        decode.FrameCount = decoder.GetFrameCount();
+        decode.ChunkFrames = std::max(1u, static_cast<uint32_t>(m_SampleRate) / ChunksPerSecond);
+        if (decode.FrameCount == 0)
+        {
+            PIL_CORE_ERROR("OpenALStream: No sample data in {0}", resolvedPath);
+            return;
+        }
+        decode.SeekFrame(0);
+
+        m_Source = AudioEngine::CreateSource();
+        if (!m_Source || m_Source->GetSourceID() == 0)
+            return;
+
+        alGenBuffers(BufferCount, m_Buffers.data());
+        if (!OpenALContext::CheckError("alGenBuffers"))
+        {
+            PIL_CORE_ERROR("OpenALStream: Failed to generate buffers");
+            m_Buffers.fill(0);
+            return;
+        }
+        m_FreeBuffers.assign(m_Buffers.begin(), m_Buffers.end());
+
+        m_Loaded = true;
+        PIL_CORE_INFO("OpenALStream: Opened '{0}' ({1}Hz, {2}ch, {3}-bit, {4:.2f}s)",
+            m_FilePath, m_SampleRate, decoder.GetChannels(), decoder.GetBitsPerSample(), m_Duration);
+    }
+
+    OpenALStream::~OpenALStream()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Decode->QueueMutex);
+            m_Decode->Cancelled = true;
+        }
+
+        if (m_Source)
+            UnqueueAll();
+
+        if (m_Buffers[0] != 0)
+        {
+            alDeleteBuffers(BufferCount, m_Buffers.data());
+            OpenALContext::CheckError("alDeleteBuffers");
+        }
+    }
+
+    void OpenALStream::Play()
+    {
+        if (!m_Loaded || m_State == State::Playing)
+            return;
+
+        if (m_State == State::Stopped)
+        {
+            // Only the first chunk is decoded on this thread; the rest streams in
+            PrimeFromReader();
+            RequestDecode();
+        }
+
+        m_Source->Play();
+        m_State = State::Playing;
+    }
+
+    void OpenALStream::Pause()
+    {
+        if (m_State != State::Playing)
+            return;
+
+        m_Source->Pause();
+        m_State = State::Paused;
+    }
+
+    void OpenALStream::Stop()
+    {
+        if (!m_Loaded)
+            return;
+
+        UnqueueAll();
+        Reposition(0);
+        m_State = State::Stopped;
+    }
+
+    void OpenALStream::Seek(float seconds)
+    {
+        if (!m_Loaded)
+            return;
+
+        const uint64_t frameCount = m_Decode->FrameCount;
+        const auto target = static_cast<uint64_t>(std::max(0.0f, seconds) * static_cast<float>(m_SampleRate));
+        const uint64_t frame = m_Decode->Looping ? target % frameCount : std::min(target, frameCount);
+
+        UnqueueAll();
+        Reposition(frame);
+
+        if (m_State == State::Stopped)
+            return;
+
+        PrimeFromReader();
+        RequestDecode();
+
+        // A paused stream stays paused; Play() restarts the freshly queued buffers
+        if (m_State == State::Playing)
+            m_Source->Play();
+    }
+
+    void OpenALStream::SetLooping(bool loop)
+    {
+        m_Decode->Looping = loop;
+        if (loop)
+        {
+            // The reader may already have hit the end; it wraps on the next read
+            std::lock_guard<std::mutex> lock(m_Decode->QueueMutex);
+            m_Decode->EndOfStream = false;
+        }
+        RequestDecode();
+    }
+
+    float OpenALStream::GetPlaybackPosition() const
+    {
+        if (!m_Loaded || m_SampleRate == 0)
+            return 0.0f;
+
+        if (m_Queued.empty())
+            return static_cast<float>(m_IdleFrame) / static_cast<float>(m_SampleRate);
+
+        // AL_SAMPLE_OFFSET counts from the first buffer still in the queue
+        ALint offset = 0;
+        alGetSourcei(m_Source->GetSourceID(), AL_SAMPLE_OFFSET, &offset);
+        const uint64_t frame = (m_Queued.front().StartFrame + static_cast<uint64_t>(offset)) % m_Decode->FrameCount;
+        return static_cast<float>(frame) / static_cast<float>(m_SampleRate);
+    }
+
+    void OpenALStream::Update()
+    {
+        if (!m_Loaded || m_State == State::Stopped)
+            return;
+
+        const ALuint source = m_Source->GetSourceID();
+        ALint processed = 0;
+        alGetSourcei(source, AL_BUFFERS_PROCESSED, &processed);
+        while (processed-- > 0 && !m_Queued.empty())
+        {
+            ALuint buffer = 0;
+            alSourceUnqueueBuffers(source, 1, &buffer);
+            m_Queued.pop_front();
+            m_FreeBuffers.push_back(buffer);
+        }
+
+        QueueReadyChunks();
+        RequestDecode();
+
+        if (m_State != State::Playing)
+            return;
+
+        if (m_Queued.empty())
+        {
+            bool finished = false;
+            {
+                std::lock_guard<std::mutex> lock(m_Decode->QueueMutex);
+                finished = m_Decode->EndOfStream && m_Decode->Ready.empty();
+            }
+            if (finished)
+                Stop();
+            return;
+        }
+
+        // The decoder fell behind and the source ran dry; pick up again
+        if (m_Source->IsStopped())
+            m_Source->Play();
+    }
+
+    void OpenALStream::RequestDecode()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Decode->QueueMutex);
+            auto& decode = *m_Decode;
+            if (decode.DecodeInFlight || decode.EndOfStream || decode.Cancelled || decode.Ready.size() >= DecodeAheadChunks)
+                return;
+            decode.DecodeInFlight = true;
+        }
+
+        ThreadPool::Get().Submit([state = m_Decode]() { DecodeAhead(state); });
+    }
+
+    void OpenALStream::DecodeAhead(const std::shared_ptr<DecodeState>& state)
+    {
+        for (;;)
+        {
+            Chunk chunk;
+            bool gotSamples = false;
+            {
+                // The generation is taken under the reader lock (same order as
+                // Reposition), so it always matches the position the read starts at
+                std::lock_guard<std::mutex> readerLock(state->ReaderMutex);
+                {
+                    std::lock_guard<std::mutex> lock(state->QueueMutex);
+                    if (state->Cancelled || state->EndOfStream || state->Ready.size() >= DecodeAheadChunks)
+                    {
+                        state->DecodeInFlight = false;
+                        return;
+                    }
+                    chunk.Generation = state->Generation;
+                }
+                gotSamples = state->Read(chunk);
+            }
+
+            // A seek after the read makes this chunk stale
+            std::lock_guard<std::mutex> lock(state->QueueMutex);
+            if (chunk.Generation != state->Generation)
+                continue;
+            if (gotSamples)
+                state->Ready.push_back(std::move(chunk));
+            else
+                state->EndOfStream = true;
+        }
+    }
+
+    void OpenALStream::QueueReadyChunks()
+    {
+        while (!m_FreeBuffers.empty())
+        {
+            Chunk chunk;
+            {
+                std::lock_guard<std::mutex> lock(m_Decode->QueueMutex);
+                auto& ready = m_Decode->Ready;
+                while (!ready.empty() && ready.front().Generation != m_Decode->Generation)
+                    ready.pop_front();
+                if (ready.empty())
+                    return;
+                chunk = std::move(ready.front());
+                ready.pop_front();
+            }
+            Upload(chunk);
+        }
+    }
+
+    void OpenALStream::PrimeFromReader()
+    {
+        // Anything already decoded goes first
+        QueueReadyChunks();
+        if (!m_Queued.empty() || m_FreeBuffers.empty())
+            return;
+
+        Chunk chunk;
+        {
+            std::lock_guard<std::mutex> readerLock(m_Decode->ReaderMutex);
+            {
+                std::lock_guard<std::mutex> lock(m_Decode->QueueMutex);
+                chunk.Generation = m_Decode->Generation;
+            }
+            if (!m_Decode->Read(chunk))
+            {
+                std::lock_guard<std::mutex> lock(m_Decode->QueueMutex);
+                m_Decode->EndOfStream = true;
+                return;
+            }
+        }
+        Upload(chunk);
+    }
+
+    void OpenALStream::Upload(const Chunk& chunk)
+    {
+        const ALuint buffer = m_FreeBuffers.back();
+        m_FreeBuffers.pop_back();
+
+        alBufferData(buffer, m_Format, chunk.Samples.data(),
+                     static_cast<ALsizei>(chunk.Samples.size()),
+                     static_cast<ALsizei>(m_SampleRate));
+        alSourceQueueBuffers(m_Source->GetSourceID(), 1, &buffer);
+        OpenALContext::CheckError("alSourceQueueBuffers");
+
+        m_Queued.push_back({ buffer, chunk.StartFrame });
+    }
+
+    void OpenALStream::UnqueueAll()
+    {
+        if (!m_Queued.empty())
+            m_IdleFrame = static_cast<uint64_t>(GetPlaybackPosition() * static_cast<float>(m_SampleRate));
+
+        // Setting AL_BUFFER to 0 on a stopped source releases its whole queue
+        m_Source->Stop();
+        alSourcei(m_Source->GetSourceID(), AL_BUFFER, 0);
+
+        for (const auto& queued : m_Queued)
+            m_FreeBuffers.push_back(queued.Buffer);
+        m_Queued.clear();
+    }
+
+    void OpenALStream::Reposition(uint64_t frame)
+    {
+        std::lock_guard<std::mutex> readerLock(m_Decode->ReaderMutex);
+        m_Decode->SeekFrame(frame);
+
+        std::lock_guard<std::mutex> lock(m_Decode->QueueMutex);
+        ++m_Decode->Generation;
+        m_Decode->Ready.clear();
+        m_Decode->EndOfStream = false;
+        m_IdleFrame = frame;
+    }
+
+    bool OpenALStream::DecodeState::Read(Chunk& chunk)
+    {
+        chunk.StartFrame = ReadFrame;
+        chunk.Samples.resize(static_cast<size_t>(ChunkFrames) * FrameSize);
+
+        uint64_t filled = 0;
+        while (filled < ChunkFrames)
+        {
+            if (ReadFrame >= FrameCount)
+            {
+                // Wrap inside the chunk so the loop point is seamless
+                if (!Looping || FrameCount == 0)
+                    break;
+                SeekFrame(0);
+            }
+
+            const uint64_t frames = std::min<uint64_t>(ChunkFrames - filled, FrameCount - ReadFrame);
+            const uint64_t framesRead = Decoder->ReadFrames(chunk.Samples.data() + filled * FrameSize, frames);
+            filled += framesRead;
+            ReadFrame += framesRead;
+
+            if (framesRead < frames)
+            {
+                // Short read: the file is shorter than its header claims or is corrupt; end here
+                ReadFrame = FrameCount;
+                break;
+            }
+        }
+
+        chunk.Samples.resize(static_cast<size_t>(filled) * FrameSize);
+        return filled > 0;
+    }
+
+    void OpenALStream::DecodeState::SeekFrame(uint64_t frame)
+    {
+        ReadFrame = std::min(frame, FrameCount);
+        Decoder->SeekFrame(ReadFrame);
+    }
+
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Pillar/Audio/AudioStream.h"
+#include "Pillar/Audio/AudioDecoder.h"
+#include <AL/al.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace Pillar {
+
+    /**
+     * @brief OpenAL implementation of AudioStream.
+     *
+     * A ring of BufferCount AL buffers is queued on one source with
+     * alSourceQueueBuffers. Decode tasks on the ThreadPool keep up to
+     * DecodeAheadChunks chunks ready; Update() swaps processed buffers for
+     * ready chunks on the main thread, so AL calls never leave it.
+     */
+    class OpenALStream : public AudioStream
+    {
+    public:
+        static constexpr uint32_t BufferCount = 4;
+        static constexpr uint32_t DecodeAheadChunks = 2;
+        static constexpr uint32_t ChunksPerSecond = 4;  // 250 ms per chunk
+
+        /**
+         * @brief Open an audio file for streaming.
+         * @param filepath Path to a .wav or .ogg file.
+         */
+        OpenALStream(const std::string& filepath);
+
+        /**
+         * @brief Destructor - stops playback and releases the AL buffers.
+         */
+        ~OpenALStream();
+
+        // AudioStream interface
+        void Play() override;
+        void Pause() override;
+        void Stop() override;
+        void Seek(float seconds) override;
+        void SetLooping(bool loop) override;
+        bool IsLooping() const override { return m_Decode->Looping; }
+
+        bool IsPlaying() const override { return m_State == State::Playing; }
+        bool IsPaused() const override { return m_State == State::Paused; }
+        bool IsLoaded() const override { return m_Loaded; }
+        float GetPlaybackPosition() const override;
+        float GetDuration() const override { return m_Duration; }
+        const std::string& GetFilePath() const override { return m_FilePath; }
+        std::shared_ptr<AudioSource> GetSource() const override { return m_Source; }
+
+        void Update() override;
+
+    private:
+        enum class State { Stopped, Playing, Paused };
+
+        struct Chunk
+        {
+            std::vector<char> Samples;
+            uint64_t StartFrame = 0;
+            uint32_t Generation = 0;
+        };
+
+        // Everything decode tasks touch; shared so a task can outlive the stream
+        struct DecodeState
+        {
+            // Guarded by ReaderMutex
+            std::mutex ReaderMutex;
+            std::unique_ptr<AudioDecoder> Decoder;
+            uint64_t FrameCount = 0;
+            uint64_t ReadFrame = 0;
+            uint32_t FrameSize = 0;
+            uint32_t ChunkFrames = 0;
+
+            // Guarded by QueueMutex
+            std::mutex QueueMutex;
+            std::deque<Chunk> Ready;
+            uint32_t Generation = 0;    // Bumped by seeks; older chunks are dropped
+            bool DecodeInFlight = false;
+            bool EndOfStream = false;
+            bool Cancelled = false;
+
+            std::atomic<bool> Looping{ false };
+
+            // Fill one chunk from the reader, wrapping at the end when looping. ReaderMutex must be held.
+            bool Read(Chunk& chunk);
+            void SeekFrame(uint64_t frame);
+        };
+
+        static void DecodeAhead(const std::shared_ptr<DecodeState>& state);
+
+        void RequestDecode();
+        void QueueReadyChunks();
+        void PrimeFromReader();
+        void Upload(const Chunk& chunk);
+        void UnqueueAll();
+        void Reposition(uint64_t frame);
+
+        std::shared_ptr<AudioSource> m_Source;
+        std::shared_ptr<DecodeState> m_Decode;
+
+        std::array<ALuint, BufferCount> m_Buffers{};
+        std::vector<ALuint> m_FreeBuffers;
+
+        struct QueuedBuffer
+        {
+            ALuint Buffer = 0;
+            uint64_t StartFrame = 0;
+        };
+        std::deque<QueuedBuffer> m_Queued;  // In play order
+
+        std::string m_FilePath;
+        ALenum m_Format = 0;
+        int m_SampleRate = 0;
+        float m_Duration = 0.0f;
+        uint64_t m_IdleFrame = 0;           // Position reported while nothing is queued
+        State m_State = State::Stopped;
+        bool m_Loaded = false;
+    };
+
+}
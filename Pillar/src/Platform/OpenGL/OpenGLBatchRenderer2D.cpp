@@ -3,8 +3,8 @@
 #include "Pillar/Renderer/VertexArray.h"
 #include "Pillar/Renderer/Shader.h"
 #include "Pillar/Logger.h"
+#include "Pillar/Utils/Profiler.h"
 #include <glad/gl.h>
-#include <glm/gtc/matrix_transform.hpp>
 
 namespace Pillar {
 
@@ -237,6 +237,8 @@ namespace Pillar {
 
     void OpenGLBatchRenderer2D::Flush()
     {
+        PIL_PROFILE_FUNCTION();
+
         if (m_Batches.empty())
             return;
 
@@ -356,52 +358,11 @@ namespace Pillar {
 
         QuadBatch& currentBatch = it->second;
 
-        // Calculate quad vertices
-        glm::vec3 vertices[4];
-        
-        if (rotation != 0.0f)
-        {
-            // Rotated quad
-            glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-                                * glm::rotate(glm::mat4(1.0f), rotation, glm::vec3(0.0f, 0.0f, 1.0f))
-                                * glm::scale(glm::mat4(1.0f), glm::vec3(size, 1.0f));
-
-            vertices[0] = transform * glm::vec4(-0.5f, -0.5f, 0.0f, 1.0f);
-            vertices[1] = transform * glm::vec4( 0.5f, -0.5f, 0.0f, 1.0f);
-            vertices[2] = transform * glm::vec4( 0.5f,  0.5f, 0.0f, 1.0f);
-            vertices[3] = transform * glm::vec4(-0.5f,  0.5f, 0.0f, 1.0f);
-        }
-        else
-        {
-            // Non-rotated quad (faster)
-            glm::vec3 halfSize = glm::vec3(size * 0.5f, 0.0f);
-            vertices[0] = position + glm::vec3(-halfSize.x, -halfSize.y, 0.0f);
-            vertices[1] = position + glm::vec3( halfSize.x, -halfSize.y, 0.0f);
-            vertices[2] = position + glm::vec3( halfSize.x,  halfSize.y, 0.0f);
-            vertices[3] = position + glm::vec3(-halfSize.x,  halfSize.y, 0.0f);
-        }
-
-	// Texture coordinates (with optional flipping)
-	float uvMinX = flipX ? texCoordMax.x : texCoordMin.x;
-	float uvMaxX = flipX ? texCoordMin.x : texCoordMax.x;
-	float uvMinY = flipY ? texCoordMax.y : texCoordMin.y;
-	float uvMaxY = flipY ? texCoordMin.y : texCoordMax.y;
-	
-	glm::vec2 texCoords[4] = {
-		{ uvMinX, uvMinY },  // Bottom-left
-		{ uvMaxX, uvMinY },  // Bottom-right
-		{ uvMaxX, uvMaxY },  // Top-right
-		{ uvMinX, uvMaxY }   // Top-left
-	};        // Add 4 vertices to batch
-        for (int i = 0; i < 4; ++i)
-        {
-            QuadVertex vertex;
-            vertex.Position = vertices[i];
-            vertex.Color = color;
-            vertex.TexCoord = texCoords[i];
-            vertex.TexIndex = static_cast<float>(textureSlot);
-            currentBatch.Vertices.push_back(vertex);
-        }
+        // Add 4 vertices to batch
+        const size_t first = currentBatch.Vertices.size();
+        currentBatch.Vertices.resize(first + 4);
+        QuadGeometry::WriteQuad(&currentBatch.Vertices[first], position, size, rotation, color,
+                                texCoordMin, texCoordMax, flipX, flipY, static_cast<float>(textureSlot));
 
         currentBatch.QuadCount++;
     }
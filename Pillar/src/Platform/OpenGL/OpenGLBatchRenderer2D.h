@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Pillar/Renderer/BatchRenderer2D.h"
+#include "Pillar/Renderer/QuadGeometry.h"
 #include "Pillar/Renderer/VertexArray.h"
 #include "Pillar/Renderer/Shader.h"
 #include "Pillar/Renderer/Texture.h"
@@ -67,14 +68,8 @@ namespace Pillar {
         void FlushAndReset() override;
 
     private:
-        // Vertex structure (per quad corner)
-        struct QuadVertex
-        {
-            glm::vec3 Position;
-            glm::vec4 Color;
-            glm::vec2 TexCoord;
-            float TexIndex;  // Which texture slot (0-31)
-        };
+        // Vertex structure (per quad corner), filled by QuadGeometry::WriteQuad
+        using QuadVertex = QuadGeometry::QuadVertex;
 
         // Batch data structure (per texture)
         struct QuadBatch
@@ -4,6 +4,14 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+// S3TC is an extension rather than core GL, but every desktop driver exposes it
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 namespace Pillar {
 
     OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height)
@@ -32,6 +40,60 @@ namespace Pillar {
         m_Width = width;
         m_Height = height;
 
+        Upload(static_cast<uint32_t>(channels), data);
+
+        stbi_image_free(data);
+    }
+
+    OpenGLTexture2D::OpenGLTexture2D(const TextureImage& image)
+        : m_Path(image.Path), m_Width(image.Width), m_Height(image.Height)
+    {
+        Upload(image.Channels, image.Pixels.data());
+    }
+
+    OpenGLTexture2D::OpenGLTexture2D(const CookedTexture& cooked)
+        : m_Path(cooked.GetPath()), m_Width(cooked.GetWidth()), m_Height(cooked.GetHeight())
+    {
+        const CookedTextures::Format format = cooked.GetFormat();
+        switch (format)
+        {
+            case CookedTextures::Format::RGBA8: m_InternalFormat = GL_RGBA8; break;
+            case CookedTextures::Format::BC1:   m_InternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+            case CookedTextures::Format::BC3:   m_InternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+            case CookedTextures::Format::BC7:   m_InternalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM; break;
+        }
+        // SetData only supports uncompressed textures
+        m_DataFormat = format == CookedTextures::Format::RGBA8 ? GL_RGBA : 0;
+
+        const uint32_t levels = cooked.GetLevelCount();
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+        glTextureStorage2D(m_RendererID, levels, m_InternalFormat, m_Width, m_Height);
+
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levels - 1));
+
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+        // Levels go up straight from the mapping
+        for (uint32_t i = 0; i < levels; ++i)
+        {
+            const CookedTexture::Level& level = cooked.GetLevel(i);
+            if (format == CookedTextures::Format::RGBA8)
+            {
+                glTextureSubImage2D(m_RendererID, i, 0, 0, level.Width, level.Height, GL_RGBA, GL_UNSIGNED_BYTE, level.Data);
+            }
+            else
+            {
+                glCompressedTextureSubImage2D(m_RendererID, i, 0, 0, level.Width, level.Height,
+                    m_InternalFormat, static_cast<GLsizei>(level.Size), level.Data);
+            }
+        }
+    }
+
+    void OpenGLTexture2D::Upload(uint32_t channels, const void* pixels)
+    {
         GLenum internalFormat = 0, dataFormat = 0;
         if (channels == 4)
         {
@@ -58,9 +120,7 @@ namespace Pillar {
         glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
         glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-        glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, data);
-
-        stbi_image_free(data);
+        glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, pixels);
     }
 
     OpenGLTexture2D::~OpenGLTexture2D()
@@ -70,6 +130,11 @@ namespace Pillar {
 
     void OpenGLTexture2D::SetData(void* data, uint32_t size)
     {
+        if (m_DataFormat == 0)
+        {
+            PIL_CORE_WARN("SetData is not supported on compressed texture '{0}'", m_Path);
+            return;
+        }
         uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
         PIL_CORE_ASSERT(size == m_Width * m_Height * bpp, "Data must be entire texture!");
         glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
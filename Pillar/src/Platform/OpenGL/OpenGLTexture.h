@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Pillar/Renderer/Texture.h"
+#include "Pillar/Renderer/CookedTexture.h"
 #include <glad/gl.h>
 
 namespace Pillar {
@@ -10,6 +11,8 @@ namespace Pillar {
     public:
         OpenGLTexture2D(uint32_t width, uint32_t height);
         OpenGLTexture2D(const std::string& path);
+        OpenGLTexture2D(const TextureImage& image);
+        OpenGLTexture2D(const CookedTexture& cooked);
         virtual ~OpenGLTexture2D();
 
         virtual uint32_t GetWidth() const override { return m_Width; }
@@ -19,6 +22,9 @@ namespace Pillar {
         virtual void SetData(void* data, uint32_t size) override;
         virtual void Bind(uint32_t slot = 0) const override;
 
+    private:
+        void Upload(uint32_t channels, const void* pixels);
+
     private:
         std::string m_Path;
         uint32_t m_Width, m_Height;
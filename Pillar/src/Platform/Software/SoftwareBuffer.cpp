@@ -0,0 +1,75 @@
+#include "Platform/Software/SoftwareBuffer.h"
+#include "Pillar/Audio/AudioDecoder.h"
+#include "Pillar/Audio/WavLoader.h"
+#include "Pillar/Utils/AssetManager.h"
+#include "Pillar/Logger.h"
+#include <cstring>
+
+namespace Pillar {
+
+    namespace {
+        uint32_t s_NextBufferID = 1;
+    }
+
+    SoftwareBuffer::SoftwareBuffer(const std::string& filepath)
+        : m_BufferID(s_NextBufferID++), m_FilePath(filepath)
+    {
+        std::string resolvedPath = AssetManager::GetAudioPath(filepath);
+
+        WavData wavData;
+        if (!AudioDecoder::Decode(resolvedPath, wavData))
+        {
+            PIL_CORE_ERROR("SoftwareBuffer: Failed to load audio file: {0}", resolvedPath);
+            return;
+        }
+
+        m_Loaded = Convert(wavData);
+    }
+
+    SoftwareBuffer::SoftwareBuffer(const std::string& filepath, const WavData& wavData)
+        : m_BufferID(s_NextBufferID++), m_FilePath(filepath)
+    {
+        m_Loaded = Convert(wavData);
+    }
+
+    bool SoftwareBuffer::Convert(const WavData& wavData)
+    {
+        if ((wavData.Channels != 1 && wavData.Channels != 2) ||
+            (wavData.BitsPerSample != 8 && wavData.BitsPerSample != 16) || wavData.SampleRate <= 0)
+        {
+            PIL_CORE_ERROR("SoftwareBuffer: Unsupported format ({0} channels, {1}-bit)",
+                wavData.Channels, wavData.BitsPerSample);
+            return false;
+        }
+
+        m_SampleRate = wavData.SampleRate;
+        m_Channels = wavData.Channels;
+        m_BitsPerSample = wavData.BitsPerSample;
+
+        const size_t bytesPerSample = static_cast<size_t>(m_BitsPerSample / 8);
+        const size_t sampleCount = wavData.Data.size() / bytesPerSample;
+        m_FrameCount = sampleCount / static_cast<size_t>(m_Channels);
+        m_Samples.resize(static_cast<size_t>(m_FrameCount) * m_Channels);
+
+        if (m_BitsPerSample == 16)
+        {
+            const char* src = wavData.Data.data();
+            for (size_t i = 0; i < m_Samples.size(); ++i)
+            {
+                int16_t sample;
+                std::memcpy(&sample, src + i * 2, sizeof(sample));
+                m_Samples[i] = static_cast<float>(sample) * (1.0f / 32768.0f);
+            }
+        }
+        else
+        {
+            // 8-bit WAV is unsigned, centred on 128
+            for (size_t i = 0; i < m_Samples.size(); ++i)
+                m_Samples[i] = (static_cast<float>(static_cast<uint8_t>(wavData.Data[i])) - 128.0f) * (1.0f / 128.0f);
+        }
+
+        m_Duration = static_cast<float>(m_FrameCount) / static_cast<float>(m_SampleRate);
+        return m_FrameCount > 0;
+    }
+
+}
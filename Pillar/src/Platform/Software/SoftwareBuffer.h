@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Pillar/Audio/AudioBuffer.h"
+#include <vector>
+
+namespace Pillar {
+
+    struct WavData;
+
+    /**
+     * @brief AudioBuffer for the software mixer: decoded samples kept in memory as floats.
+     *
+     * Samples are interleaved, mono or stereo, scaled to [-1, 1] at load time
+     * so the mixer never converts formats while rendering.
+     */
+    class SoftwareBuffer : public AudioBuffer
+    {
+    public:
+        /**
+         * @brief Decode an audio file into memory.
+         * @param filepath Path to a .wav or .ogg file.
+         */
+        SoftwareBuffer(const std::string& filepath);
+
+        /**
+         * @brief Convert already decoded WAV data.
+         * @param filepath Path the data was decoded from (for GetFilePath()).
+         * @param wavData Decoded samples and format.
+         */
+        SoftwareBuffer(const std::string& filepath, const WavData& wavData);
+
+        // AudioBuffer interface
+        uint32_t GetBufferID() const override { return m_BufferID; }
+        float GetDuration() const override { return m_Duration; }
+        int GetSampleRate() const override { return m_SampleRate; }
+        int GetChannels() const override { return m_Channels; }
+        int GetBitsPerSample() const override { return m_BitsPerSample; }
+        size_t GetSizeInBytes() const override { return m_Samples.size() * sizeof(float); }
+        bool IsLoaded() const override { return m_Loaded; }
+        const std::string& GetFilePath() const override { return m_FilePath; }
+
+        // Mixer access
+        const float* GetSamples() const { return m_Samples.data(); }
+        uint64_t GetFrameCount() const { return m_FrameCount; }
+
+    private:
+        bool Convert(const WavData& wavData);
+
+        uint32_t m_BufferID = 0;
+        std::string m_FilePath;
+        std::vector<float> m_Samples;
+        uint64_t m_FrameCount = 0;
+        float m_Duration = 0.0f;
+        int m_SampleRate = 0;
+        int m_Channels = 0;
+        int m_BitsPerSample = 0;
+        bool m_Loaded = false;
+    };
+
+}
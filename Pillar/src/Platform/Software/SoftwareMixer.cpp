@@ -0,0 +1,284 @@
+#include "Platform/Software/SoftwareMixer.h"
+#include "Platform/Software/SoftwareBuffer.h"
+#include "Platform/Software/SoftwareSource.h"
+#include "Pillar/Audio/AudioEngine.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Pillar {
+
+    namespace {
+        constexpr uint32_t Lanes = 4;
+
+        inline uint32_t PadToLanes(uint32_t count)
+        {
+            return (count + Lanes - 1) & ~(Lanes - 1);
+        }
+
+        // The mix loops run four frames per iteration over lane-padded blocks, which
+        // the compiler turns into one SSE/NEON operation per line even at -O2.
+        // dst[i] += src[i] * (gain + step * i)
+        inline void MixRamp(float* __restrict dst, const float* __restrict src, float gain, float step, uint32_t count)
+        {
+            const float step0 = 0.0f, step1 = step, step2 = step * 2.0f, step3 = step * 3.0f;
+            for (uint32_t i = 0; i < count; i += Lanes)
+            {
+                const float g = gain + step * static_cast<float>(i);
+                dst[i + 0] += src[i + 0] * (g + step0);
+                dst[i + 1] += src[i + 1] * (g + step1);
+                dst[i + 2] += src[i + 2] * (g + step2);
+                dst[i + 3] += src[i + 3] * (g + step3);
+            }
+        }
+
+        inline void MixConstant(float* __restrict dst, const float* __restrict src, float gain, uint32_t count)
+        {
+            for (uint32_t i = 0; i < count; i += Lanes)
+            {
+                dst[i + 0] += src[i + 0] * gain;
+                dst[i + 1] += src[i + 1] * gain;
+                dst[i + 2] += src[i + 2] * gain;
+                dst[i + 3] += src[i + 3] * gain;
+            }
+        }
+
+        // Ramps over frameCount frames; count may include trailing pad frames
+        inline void Mix(float* dst, const float* src, float from, float to, uint32_t frameCount, uint32_t count)
+        {
+            if (from == to)
+                MixConstant(dst, src, to, count);
+            else
+                MixRamp(dst, src, from, (to - from) / static_cast<float>(frameCount), count);
+        }
+    }
+
+    SoftwareMixer::SoftwareMixer(uint32_t sampleRate)
+        : m_SampleRate(std::max(sampleRate, 1u)),
+          m_MixL(BlockFrames), m_MixR(BlockFrames),
+          m_VoiceL(BlockFrames), m_VoiceR(BlockFrames)
+    {
+    }
+
+    void SoftwareMixer::AddSource(const std::shared_ptr<SoftwareSource>& source)
+    {
+        if (source)
+            m_Sources.push_back(source);
+    }
+
+    void SoftwareMixer::Render(float* out, uint32_t frameCount)
+    {
+        m_MixedVoices = 0;
+
+        // Drop sources nobody holds any more
+        m_Sources.erase(std::remove_if(m_Sources.begin(), m_Sources.end(),
+            [](const std::weak_ptr<SoftwareSource>& source) { return source.expired(); }), m_Sources.end());
+
+        while (frameCount > 0)
+        {
+            const uint32_t block = std::min(frameCount, BlockFrames);
+            RenderBlock(out, block);
+            out += static_cast<size_t>(block) * 2;
+            frameCount -= block;
+        }
+    }
+
+    void SoftwareMixer::RenderBlock(float* out, uint32_t frameCount)
+    {
+        const uint32_t padded = PadToLanes(frameCount);
+        std::fill_n(m_MixL.data(), padded, 0.0f);
+        std::fill_n(m_MixR.data(), padded, 0.0f);
+
+        const float listenerGain = AudioEngine::GetMasterVolume();
+        const glm::vec3 listenerPosition = AudioEngine::GetListenerPosition();
+        const glm::vec3 listenerForward = AudioEngine::GetListenerForward();
+        const glm::vec3 listenerUp = AudioEngine::GetListenerUp();
+
+        uint32_t mixed = 0;
+        for (const auto& weak : m_Sources)
+        {
+            auto source = weak.lock();
+            if (!source || source->m_State != AudioState::Playing || !source->m_Samples)
+                continue;
+
+            const bool mono = source->m_Samples->GetChannels() == 1;
+            glm::vec2 gain(listenerGain * source->m_Volume);
+            if (mono)
+            {
+                gain *= ComputeSpatialGain(source->m_Position, source->m_MinDistance, source->m_MaxDistance,
+                                           source->m_RolloffFactor, listenerPosition, listenerForward, listenerUp);
+            }
+
+            // A source that just started has nothing to ramp from
+            if (!source->m_GainPrimed)
+            {
+                source->m_AppliedGainL = gain.x;
+                source->m_AppliedGainR = gain.y;
+                source->m_GainPrimed = true;
+            }
+
+            const uint32_t fetched = FetchSource(*source, frameCount);
+            if (fetched > 0)
+            {
+                Mix(m_MixL.data(), m_VoiceL.data(), source->m_AppliedGainL, gain.x, frameCount, padded);
+                Mix(m_MixR.data(), mono ? m_VoiceL.data() : m_VoiceR.data(), source->m_AppliedGainR, gain.y, frameCount, padded);
+                ++mixed;
+            }
+            source->m_AppliedGainL = gain.x;
+            source->m_AppliedGainR = gain.y;
+        }
+        m_MixedVoices = std::max(m_MixedVoices, mixed);
+
+        for (uint32_t i = 0; i < frameCount; ++i)
+        {
+            out[i * 2] = std::clamp(m_MixL[i], -1.0f, 1.0f);
+            out[i * 2 + 1] = std::clamp(m_MixR[i], -1.0f, 1.0f);
+        }
+    }
+
+    uint32_t SoftwareMixer::FetchSource(SoftwareSource& source, uint32_t frameCount)
+    {
+        // Queued buffers (streams) share one format, so only the samples change when advancing
+        const float* samples = source.m_Samples->GetSamples();
+        uint64_t total = source.m_Samples->GetFrameCount();
+        const int channels = source.m_Samples->GetChannels();
+        const double step = static_cast<double>(source.m_Pitch) * source.m_Samples->GetSampleRate() / m_SampleRate;
+        auto advanceQueue = [&]() {
+            if (!source.AdvanceQueue())
+                return false;
+            samples = source.m_Samples->GetSamples();
+            total = source.m_Samples->GetFrameCount();
+            return true;
+        };
+        float* left = m_VoiceL.data();
+        float* right = m_VoiceR.data();
+
+        double cursor = source.m_Cursor;
+        uint32_t written = 0;
+
+        if (step == 1.0 && cursor == std::floor(cursor))
+        {
+            // Rates match: straight copies, split at the loop point
+            while (written < frameCount)
+            {
+                auto frame = static_cast<uint64_t>(cursor);
+                if (frame >= total)
+                {
+                    if (!advanceQueue() && !source.m_Looping)
+                        break;
+                    frame = 0;
+                }
+
+                const auto count = static_cast<uint32_t>(std::min<uint64_t>(frameCount - written, total - frame));
+                const float* src = samples + frame * channels;
+                if (channels == 1)
+                {
+                    std::memcpy(left + written, src, count * sizeof(float));
+                }
+                else
+                {
+                    for (uint32_t i = 0; i < count; ++i)
+                    {
+                        left[written + i] = src[i * 2];
+                        right[written + i] = src[i * 2 + 1];
+                    }
+                }
+                written += count;
+                cursor = static_cast<double>(frame + count);
+            }
+        }
+        else
+        {
+            // Pitch or rate conversion: linear interpolation between neighbouring frames
+            for (; written < frameCount; ++written)
+            {
+                bool ended = false;
+                while (cursor >= static_cast<double>(total))
+                {
+                    const double length = static_cast<double>(total);
+                    if (advanceQueue())
+                        cursor -= length;
+                    else if (source.m_Looping)
+                        cursor = std::fmod(cursor, length);
+                    else
+                    {
+                        ended = true;
+                        break;
+                    }
+                }
+                if (ended)
+                    break;
+
+                const auto frame0 = static_cast<uint64_t>(cursor);
+                uint64_t frame1 = frame0 + 1;
+                if (frame1 >= total)
+                    frame1 = source.m_Looping ? 0 : frame0;
+                const auto t = static_cast<float>(cursor - static_cast<double>(frame0));
+
+                const float* a = samples + frame0 * channels;
+                const float* b = samples + frame1 * channels;
+                left[written] = a[0] + (b[0] - a[0]) * t;
+                if (channels == 2)
+                    right[written] = a[1] + (b[1] - a[1]) * t;
+                cursor += step;
+            }
+        }
+
+        // Silence after the end of a one-shot, and in the lane padding
+        const uint32_t padded = PadToLanes(frameCount);
+        std::fill(left + written, left + padded, 0.0f);
+        if (channels == 2)
+            std::fill(right + written, right + padded, 0.0f);
+
+        if (cursor >= static_cast<double>(total))
+        {
+            const double length = static_cast<double>(total);
+            if (advanceQueue())
+                cursor -= length;
+        }
+
+        if (written < frameCount || (!source.m_Looping && cursor >= static_cast<double>(total)))
+        {
+            source.m_State = AudioState::Stopped;
+            source.m_Cursor = 0.0;
+
+            // A drained queue has played its last buffer too
+            if (!source.m_Queue.empty())
+            {
+                source.m_Queue.clear();
+                ++source.m_Processed;
+                source.m_Buffer.reset();
+                source.m_Samples = nullptr;
+            }
+        }
+        else
+        {
+            source.m_Cursor = cursor;
+        }
+        return written;
+    }
+
+    glm::vec2 SoftwareMixer::ComputeSpatialGain(const glm::vec3& sourcePosition, float minDistance, float maxDistance,
+                                                float rolloffFactor, const glm::vec3& listenerPosition,
+                                                const glm::vec3& listenerForward, const glm::vec3& listenerUp)
+    {
+        const glm::vec3 offset = sourcePosition - listenerPosition;
+        const float distance = glm::length(offset);
+
+        // AL_INVERSE_DISTANCE_CLAMPED: the curve flattens outside [min, max]
+        const float reference = std::max(minDistance, 0.0001f);
+        const float clamped = std::clamp(distance, reference, std::max(maxDistance, reference));
+        const float attenuation = reference / (reference + rolloffFactor * (clamped - reference));
+
+        // Equal-power pan from where the source sits along the listener's right axis
+        float pan = 0.0f;
+        const glm::vec3 right = glm::cross(listenerForward, listenerUp);
+        const float rightLength = glm::length(right);
+        if (distance > 0.0001f && rightLength > 0.0001f)
+            pan = std::clamp(glm::dot(offset, right) / (distance * rightLength), -1.0f, 1.0f);
+
+        const float angle = (pan + 1.0f) * 0.785398163f;   // [0, pi/2]
+        return { attenuation * std::cos(angle), attenuation * std::sin(angle) };
+    }
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Pillar {
+
+    class SoftwareSource;
+
+    /**
+     * @brief CPU mixer behind AudioBackend::Software: renders every playing source into memory.
+     *
+     * Nothing here touches an audio device, so the output is bit-for-bit
+     * repeatable - tests can assert on samples, and headless servers can run
+     * gameplay that plays sounds without an OpenAL install.
+     *
+     * Each source gets the gain OpenAL would give it: listener gain (master
+     * volume) times source gain (user x bus volume, set by AudioEngine) times
+     * inverse-distance-clamped attenuation for mono sources, which are then
+     * panned equal-power across the listener's right axis. Stereo sources
+     * play unattenuated, as they do in OpenAL. Gains ramp linearly across
+     * each block, so bus fades and moving sources don't click.
+     *
+     * Work is done in planar float blocks of BlockFrames with plain
+     * contiguous loops the compiler vectorizes. Render() is not thread-safe;
+     * call it from the thread that drives AudioEngine.
+     */
+    class SoftwareMixer
+    {
+    public:
+        static constexpr uint32_t DefaultSampleRate = 48000;
+        static constexpr uint32_t BlockFrames = 256;
+
+        explicit SoftwareMixer(uint32_t sampleRate = DefaultSampleRate);
+
+        SoftwareMixer(const SoftwareMixer&) = delete;
+        SoftwareMixer& operator=(const SoftwareMixer&) = delete;
+
+        uint32_t GetSampleRate() const { return m_SampleRate; }
+
+        /**
+         * @brief Include a source in the mix for as long as something else holds it.
+         */
+        void AddSource(const std::shared_ptr<SoftwareSource>& source);
+
+        /**
+         * @brief Mix the next frames of every playing source.
+         * @param out Destination of frameCount interleaved stereo frames, clipped to [-1, 1].
+         * @param frameCount Frames to render.
+         */
+        void Render(float* out, uint32_t frameCount);
+
+        /**
+         * @brief Sources that contributed to the last Render() call.
+         */
+        uint32_t GetMixedVoiceCount() const { return m_MixedVoices; }
+
+        /**
+         * @brief Sources alive in the mixer, playing or not.
+         */
+        size_t GetSourceCount() const { return m_Sources.size(); }
+
+        /**
+         * @brief Per-channel gain for a mono source, as OpenAL's inverse-distance-clamped model computes it.
+         * @return Left and right gain before listener and source gain.
+         */
+        static glm::vec2 ComputeSpatialGain(const glm::vec3& sourcePosition, float minDistance, float maxDistance,
+                                            float rolloffFactor, const glm::vec3& listenerPosition,
+                                            const glm::vec3& listenerForward, const glm::vec3& listenerUp);
+
+    private:
+        void RenderBlock(float* out, uint32_t frameCount);
+        uint32_t FetchSource(SoftwareSource& source, uint32_t frameCount);
+
+        uint32_t m_SampleRate;
+        uint32_t m_MixedVoices = 0;
+        std::vector<std::weak_ptr<SoftwareSource>> m_Sources;
+
+        // Planar scratch: the block being accumulated and one voice's resampled input
+        std::vector<float> m_MixL, m_MixR;
+        std::vector<float> m_VoiceL, m_VoiceR;
+    };
+
+}
@@ -0,0 +1,151 @@
+#include "Platform/Software/SoftwareSource.h"
+#include "Platform/Software/SoftwareBuffer.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+
+namespace Pillar {
+
+    namespace {
+        uint32_t s_NextSourceID = 1;
+    }
+
+    SoftwareSource::SoftwareSource()
+        : m_SourceID(s_NextSourceID++)
+    {
+    }
+
+    void SoftwareSource::SetBuffer(const std::shared_ptr<AudioBuffer>& buffer)
+    {
+        // Like alSourcei(AL_BUFFER), swapping the buffer leaves the source stopped at the start
+        m_State = AudioState::Stopped;
+        m_Cursor = 0.0;
+        m_Queue.clear();
+        m_Processed = 0;
+        m_Buffer = buffer;
+        m_Samples = dynamic_cast<const SoftwareBuffer*>(buffer.get());
+
+        if (buffer && !m_Samples)
+            PIL_CORE_ERROR("SoftwareSource: Buffer '{0}' was not created by the software backend", buffer->GetFilePath());
+    }
+
+    void SoftwareSource::Play()
+    {
+        if (!m_Samples)
+            return;
+
+        // Restart from the top unless resuming a pause
+        if (m_State != AudioState::Paused)
+        {
+            if (m_State == AudioState::Playing)
+                m_Cursor = 0.0;
+            m_GainPrimed = false;
+        }
+        m_State = AudioState::Playing;
+    }
+
+    void SoftwareSource::Pause()
+    {
+        if (m_State == AudioState::Playing)
+            m_State = AudioState::Paused;
+    }
+
+    void SoftwareSource::Stop()
+    {
+        m_State = AudioState::Stopped;
+        m_Cursor = 0.0;
+    }
+
+    void SoftwareSource::Rewind()
+    {
+        m_State = AudioState::Stopped;
+        m_Cursor = 0.0;
+    }
+
+    void SoftwareSource::QueueBuffer(const std::shared_ptr<SoftwareBuffer>& buffer)
+    {
+        if (!buffer)
+            return;
+
+        // The first buffer of a new queue starts stopped at its beginning, as with SetBuffer
+        if (m_Queue.empty())
+        {
+            m_State = AudioState::Stopped;
+            m_Cursor = 0.0;
+            m_Buffer = buffer;
+            m_Samples = buffer.get();
+        }
+        m_Queue.push_back(buffer);
+    }
+
+    uint32_t SoftwareSource::UnqueueProcessed()
+    {
+        const uint32_t processed = m_Processed;
+        m_Processed = 0;
+        return processed;
+    }
+
+    void SoftwareSource::ClearQueue()
+    {
+        m_State = AudioState::Stopped;
+        m_Cursor = 0.0;
+        m_Queue.clear();
+        m_Processed = 0;
+        m_Buffer.reset();
+        m_Samples = nullptr;
+    }
+
+    bool SoftwareSource::AdvanceQueue()
+    {
+        if (m_Queue.size() < 2)
+            return false;
+
+        m_Queue.pop_front();
+        ++m_Processed;
+        m_Buffer = m_Queue.front();
+        m_Samples = m_Queue.front().get();
+        return true;
+    }
+
+    void SoftwareSource::SetVolume(float volume)
+    {
+        m_Volume = std::clamp(volume, 0.0f, 1.0f);
+    }
+
+    void SoftwareSource::SetPitch(float pitch)
+    {
+        m_Pitch = std::clamp(pitch, 0.5f, 2.0f);
+    }
+
+    void SoftwareSource::SetMinDistance(float distance)
+    {
+        m_MinDistance = std::max(0.0f, distance);
+    }
+
+    void SoftwareSource::SetMaxDistance(float distance)
+    {
+        m_MaxDistance = std::max(0.0f, distance);
+    }
+
+    void SoftwareSource::SetRolloffFactor(float factor)
+    {
+        m_RolloffFactor = std::max(0.0f, factor);
+    }
+
+    void SoftwareSource::SetPlaybackPosition(float seconds)
+    {
+        if (!m_Samples)
+            return;
+
+        const double frame = static_cast<double>(std::max(0.0f, seconds)) * m_Samples->GetSampleRate();
+        m_Cursor = std::min(frame, static_cast<double>(m_Samples->GetFrameCount()));
+    }
+
+    float SoftwareSource::GetPlaybackPosition() const
+    {
+        if (!m_Samples || m_Samples->GetSampleRate() <= 0)
+            return 0.0f;
+
+        return static_cast<float>(m_Cursor / m_Samples->GetSampleRate());
+    }
+
+}
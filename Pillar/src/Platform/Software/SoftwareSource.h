@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Pillar/Audio/AudioSource.h"
+#include <deque>
+
+namespace Pillar {
+
+    class SoftwareBuffer;
+
+    /**
+     * @brief AudioSource for the software mixer.
+     *
+     * Holds the same properties OpenAL keeps per source plus a fractional
+     * play cursor; SoftwareMixer advances the cursor and changes the state
+     * when a non-looping buffer runs out.
+     *
+     * Like an OpenAL source it can also play a queue of buffers back to back
+     * (QueueBuffer), which is how SoftwareStream feeds it.
+     */
+    class SoftwareSource : public AudioSource
+    {
+    public:
+        SoftwareSource();
+
+        // Buffer management
+        void SetBuffer(const std::shared_ptr<AudioBuffer>& buffer) override;
+        std::shared_ptr<AudioBuffer> GetBuffer() const override { return m_Buffer; }
+
+        // Playback control
+        void Play() override;
+        void Pause() override;
+        void Stop() override;
+        void Rewind() override;
+
+        // State queries
+        AudioState GetState() const override { return m_State; }
+        bool IsPlaying() const override { return m_State == AudioState::Playing; }
+        bool IsPaused() const override { return m_State == AudioState::Paused; }
+        bool IsStopped() const override { return m_State == AudioState::Stopped; }
+
+        // Audio properties
+        void SetVolume(float volume) override;
+        float GetVolume() const override { return m_Volume; }
+        void SetPitch(float pitch) override;
+        float GetPitch() const override { return m_Pitch; }
+        void SetLooping(bool loop) override { m_Looping = loop; }
+        bool IsLooping() const override { return m_Looping; }
+
+        // 3D spatial audio
+        void SetPosition(const glm::vec3& position) override { m_Position = position; }
+        glm::vec3 GetPosition() const override { return m_Position; }
+        void SetVelocity(const glm::vec3& velocity) override { m_Velocity = velocity; }
+        void SetDirection(const glm::vec3& direction) override { m_Direction = direction; }
+
+        // Attenuation
+        void SetMinDistance(float distance) override;
+        void SetMaxDistance(float distance) override;
+        void SetRolloffFactor(float factor) override;
+
+        // Playback position
+        void SetPlaybackPosition(float seconds) override;
+        float GetPlaybackPosition() const override;
+
+        // Internal
+        uint32_t GetSourceID() const override { return m_SourceID; }
+
+        // ==================== Buffer Queue ====================
+
+        /**
+         * @brief Append a buffer to play after the ones already queued (replaces a SetBuffer buffer).
+         */
+        void QueueBuffer(const std::shared_ptr<SoftwareBuffer>& buffer);
+
+        /**
+         * @brief Buffers played to the end since the last call. They have already left the queue.
+         */
+        uint32_t UnqueueProcessed();
+        uint32_t GetProcessedCount() const { return m_Processed; }
+
+        /**
+         * @brief Stop and drop every queued buffer.
+         */
+        void ClearQueue();
+
+    private:
+        friend class SoftwareMixer;
+
+        // Move on to the next queued buffer; false when there is none
+        bool AdvanceQueue();
+
+        uint32_t m_SourceID = 0;
+        std::shared_ptr<AudioBuffer> m_Buffer;
+        const SoftwareBuffer* m_Samples = nullptr;  // m_Buffer, if it holds software samples
+
+        // Queued buffers, front = playing (m_Buffer); empty unless QueueBuffer was used
+        std::deque<std::shared_ptr<SoftwareBuffer>> m_Queue;
+        uint32_t m_Processed = 0;
+
+        AudioState m_State = AudioState::Stopped;
+        double m_Cursor = 0.0;          // Frames into the buffer, fractional when resampling
+
+        // Gains the last mixed block ended on, so the next block ramps from them
+        float m_AppliedGainL = 0.0f;
+        float m_AppliedGainR = 0.0f;
+        bool m_GainPrimed = false;
+
+        float m_Volume = 1.0f;
+        float m_Pitch = 1.0f;
+        bool m_Looping = false;
+        glm::vec3 m_Position = { 0.0f, 0.0f, 0.0f };
+        glm::vec3 m_Velocity = { 0.0f, 0.0f, 0.0f };
+        glm::vec3 m_Direction = { 0.0f, 0.0f, 0.0f };
+        float m_MinDistance = 1.0f;
+        float m_MaxDistance = 1000.0f;
+        float m_RolloffFactor = 1.0f;
+    };
+
+}
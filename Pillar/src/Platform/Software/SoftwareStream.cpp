@@ -0,0 +1,226 @@
+#include "Platform/Software/SoftwareStream.h"
+#include "Platform/Software/SoftwareBuffer.h"
+#include "Platform/Software/SoftwareSource.h"
+#include "Pillar/Audio/AudioEngine.h"
+#include "Pillar/Audio/WavLoader.h"
+#include "Pillar/Utils/AssetManager.h"
+#include "Pillar/Logger.h"
+#include <algorithm>
+
+namespace Pillar {
+
+    SoftwareStream::SoftwareStream(const std::string& filepath)
+        : m_FilePath(filepath)
+    {
+        const std::string resolvedPath = AssetManager::GetAudioPath(filepath);
+
+        m_Decoder = AudioDecoder::Open(resolvedPath);
+        if (!m_Decoder)
+        {
+            PIL_CORE_ERROR("SoftwareStream: Failed to open audio file: {0}", resolvedPath);
+            return;
+        }
+
+        m_SampleRate = m_Decoder->GetSampleRate();
+        m_Channels = m_Decoder->GetChannels();
+        m_BitsPerSample = m_Decoder->GetBitsPerSample();
+        m_Duration = m_Decoder->GetDuration();
+        m_FrameSize = m_Decoder->GetFrameSize();
+        m_FrameCount = m_Decoder->GetFrameCount();
+        m_ChunkFrames = std::max(1u, static_cast<uint32_t>(m_SampleRate) / ChunksPerSecond);
+        if (m_FrameCount == 0)
+        {
+            PIL_CORE_ERROR("SoftwareStream: No sample data in {0}", resolvedPath);
+            return;
+        }
+
+        m_Source = AudioEngine::CreateSource();
+        m_SoftwareSource = std::dynamic_pointer_cast<SoftwareSource>(m_Source);
+        if (!m_SoftwareSource)
+            return;
+
+        m_Loaded = true;
+        PIL_CORE_INFO("SoftwareStream: Opened '{0}' ({1}Hz, {2}ch, {3}-bit, {4:.2f}s)",
+            m_FilePath, m_SampleRate, m_Channels, m_BitsPerSample, m_Duration);
+    }
+
+    SoftwareStream::~SoftwareStream()
+    {
+        if (m_SoftwareSource)
+            m_SoftwareSource->ClearQueue();
+    }
+
+    void SoftwareStream::Play()
+    {
+        if (!m_Loaded || m_State == State::Playing)
+            return;
+
+        if (m_State == State::Stopped)
+            FillQueue();
+
+        m_Source->Play();
+        m_State = State::Playing;
+    }
+
+    void SoftwareStream::Pause()
+    {
+        if (m_State != State::Playing)
+            return;
+
+        m_Source->Pause();
+        m_State = State::Paused;
+    }
+
+    void SoftwareStream::Stop()
+    {
+        if (!m_Loaded)
+            return;
+
+        UnqueueAll();
+        Reposition(0);
+        m_State = State::Stopped;
+    }
+
+    void SoftwareStream::Seek(float seconds)
+    {
+        if (!m_Loaded)
+            return;
+
+        const auto target = static_cast<uint64_t>(std::max(0.0f, seconds) * static_cast<float>(m_SampleRate));
+        const uint64_t frame = m_Looping ? target % m_FrameCount : std::min(target, m_FrameCount);
+
+        UnqueueAll();
+        Reposition(frame);
+
+        if (m_State == State::Stopped)
+            return;
+
+        FillQueue();
+
+        // A paused stream stays paused; Play() starts the freshly queued chunks
+        if (m_State == State::Playing)
+            m_Source->Play();
+    }
+
+    void SoftwareStream::SetLooping(bool loop)
+    {
+        m_Looping = loop;
+        if (loop)
+            m_EndOfStream = false;  // The reader may already have hit the end; it wraps on the next read
+    }
+
+    float SoftwareStream::GetPlaybackPosition() const
+    {
+        if (!m_Loaded || m_SampleRate == 0)
+            return 0.0f;
+
+        // The mixer may have moved past chunks Update() hasn't collected yet
+        const size_t playing = m_SoftwareSource->GetProcessedCount();
+        if (playing >= m_QueuedStarts.size())
+            return static_cast<float>(m_IdleFrame) / static_cast<float>(m_SampleRate);
+
+        const auto offset = static_cast<uint64_t>(m_SoftwareSource->GetPlaybackPosition() * static_cast<float>(m_SampleRate));
+        const uint64_t frame = (m_QueuedStarts[playing] + offset) % m_FrameCount;
+        return static_cast<float>(frame) / static_cast<float>(m_SampleRate);
+    }
+
+    void SoftwareStream::Update()
+    {
+        if (!m_Loaded || m_State == State::Stopped)
+            return;
+
+        uint32_t processed = m_SoftwareSource->UnqueueProcessed();
+        while (processed-- > 0 && !m_QueuedStarts.empty())
+            m_QueuedStarts.pop_front();
+
+        FillQueue();
+
+        if (m_State != State::Playing)
+            return;
+
+        if (m_QueuedStarts.empty())
+        {
+            if (m_EndOfStream)
+                Stop();
+            return;
+        }
+
+        // The queue ran dry between updates; pick up again
+        if (m_Source->IsStopped())
+            m_Source->Play();
+    }
+
+    bool SoftwareStream::QueueChunk()
+    {
+        if (m_EndOfStream)
+            return false;
+
+        WavData chunk;
+        chunk.SampleRate = m_SampleRate;
+        chunk.Channels = m_Channels;
+        chunk.BitsPerSample = m_BitsPerSample;
+        chunk.Data.resize(static_cast<size_t>(m_ChunkFrames) * m_FrameSize);
+
+        const uint64_t startFrame = m_ReadFrame;
+        uint64_t filled = 0;
+        while (filled < m_ChunkFrames)
+        {
+            if (m_ReadFrame >= m_FrameCount)
+            {
+                // Wrap inside the chunk so the loop point is seamless
+                if (!m_Looping)
+                    break;
+                m_ReadFrame = 0;
+                m_Decoder->SeekFrame(0);
+            }
+
+            const uint64_t frames = std::min<uint64_t>(m_ChunkFrames - filled, m_FrameCount - m_ReadFrame);
+            const uint64_t framesRead = m_Decoder->ReadFrames(chunk.Data.data() + filled * m_FrameSize, frames);
+            filled += framesRead;
+            m_ReadFrame += framesRead;
+
+            if (framesRead < frames)
+            {
+                // Short read: the file is shorter than its header claims or is corrupt; end here
+                m_ReadFrame = m_FrameCount;
+                break;
+            }
+        }
+
+        if (filled == 0)
+        {
+            m_EndOfStream = true;
+            return false;
+        }
+
+        chunk.Data.resize(static_cast<size_t>(filled) * m_FrameSize);
+        m_SoftwareSource->QueueBuffer(std::make_shared<SoftwareBuffer>(m_FilePath, chunk));
+        m_QueuedStarts.push_back(startFrame);
+        return true;
+    }
+
+    void SoftwareStream::FillQueue()
+    {
+        while (m_QueuedStarts.size() < BufferCount && QueueChunk())
+        {
+        }
+    }
+
+    void SoftwareStream::UnqueueAll()
+    {
+        if (!m_QueuedStarts.empty())
+            m_IdleFrame = static_cast<uint64_t>(GetPlaybackPosition() * static_cast<float>(m_SampleRate));
+
+        m_SoftwareSource->ClearQueue();
+        m_QueuedStarts.clear();
+    }
+
+    void SoftwareStream::Reposition(uint64_t frame)
+    {
+        m_ReadFrame = std::min(frame, m_FrameCount);
+        m_Decoder->SeekFrame(m_ReadFrame);
+        m_EndOfStream = false;
+        m_IdleFrame = frame;
+    }
+
+}
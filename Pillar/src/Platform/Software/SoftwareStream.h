@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Pillar/Audio/AudioStream.h"
+#include "Pillar/Audio/AudioDecoder.h"
+#include <cstdint>
+#include <deque>
+#include <memory>
+
+namespace Pillar {
+
+    class SoftwareSource;
+
+    /**
+     * @brief AudioStream for the software mixer.
+     *
+     * Keeps up to BufferCount short chunks queued on a SoftwareSource. Unlike
+     * OpenALStream, chunks are decoded on the calling thread (Play, Seek and
+     * Update) rather than on the ThreadPool, so the mixer's output stays
+     * repeatable from run to run.
+     */
+    class SoftwareStream : public AudioStream
+    {
+    public:
+        static constexpr uint32_t BufferCount = 4;
+        static constexpr uint32_t ChunksPerSecond = 4;  // 250 ms per chunk
+
+        /**
+         * @brief Open an audio file for streaming.
+         * @param filepath Path to a .wav or .ogg file.
+         */
+        SoftwareStream(const std::string& filepath);
+
+        /**
+         * @brief Destructor - stops playback and drops the queued chunks.
+         */
+        ~SoftwareStream();
+
+        // AudioStream interface
+        void Play() override;
+        void Pause() override;
+        void Stop() override;
+        void Seek(float seconds) override;
+        void SetLooping(bool loop) override;
+        bool IsLooping() const override { return m_Looping; }
+
+        bool IsPlaying() const override { return m_State == State::Playing; }
+        bool IsPaused() const override { return m_State == State::Paused; }
+        bool IsLoaded() const override { return m_Loaded; }
+        float GetPlaybackPosition() const override;
+        float GetDuration() const override { return m_Duration; }
+        const std::string& GetFilePath() const override { return m_FilePath; }
+        std::shared_ptr<AudioSource> GetSource() const override { return m_Source; }
+
+        void Update() override;
+
+    private:
+        enum class State { Stopped, Playing, Paused };
+
+        // Decode the next chunk (wrapping at the end when looping) and queue it; false at the end
+        bool QueueChunk();
+        void FillQueue();
+        void UnqueueAll();
+        void Reposition(uint64_t frame);
+
+        std::shared_ptr<AudioSource> m_Source;
+        std::shared_ptr<SoftwareSource> m_SoftwareSource;   // m_Source, for the buffer queue
+        std::unique_ptr<AudioDecoder> m_Decoder;
+
+        std::deque<uint64_t> m_QueuedStarts;   // First frame of each queued chunk, in play order
+
+        std::string m_FilePath;
+        int m_SampleRate = 0;
+        int m_Channels = 0;
+        int m_BitsPerSample = 0;
+        float m_Duration = 0.0f;
+        uint64_t m_FrameCount = 0;
+        uint64_t m_ReadFrame = 0;
+        uint64_t m_IdleFrame = 0;           // Position reported while nothing is queued
+        uint32_t m_FrameSize = 0;
+        uint32_t m_ChunkFrames = 0;
+        State m_State = State::Stopped;
+        bool m_Looping = false;
+        bool m_EndOfStream = false;
+        bool m_Loaded = false;
+    };
+
+}
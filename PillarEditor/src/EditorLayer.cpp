@@ -2053,8 +2053,8 @@ namespace PillarEditor {
 
         m_EditorState = EditorState::Play;
         
-        // Backup the editor scene
-        m_EditorScene = Pillar::Scene::Copy(m_ActiveScene);
+        // Snapshot the edit-mode state; play mode runs on the same scene
+        m_EditorSnapshot.Capture(*m_ActiveScene);
         
         // Attach all systems to the active scene
         if (m_AnimationSystem)
@@ -2125,9 +2125,9 @@ namespace PillarEditor {
         // Stop runtime
         m_ActiveScene->OnRuntimeStop();
         
-        // Restore editor scene
-        m_ActiveScene = m_EditorScene;
-        m_EditorScene = nullptr;
+        // Restore the edit-mode state in place (entity ids are preserved)
+        m_EditorSnapshot.Restore(*m_ActiveScene);
+        m_EditorSnapshot.Clear();
         
         // Update panel contexts
         m_HierarchyPanel->SetContext(m_ActiveScene, &m_SelectionContext);
@@ -3,6 +3,7 @@
 #include "Pillar/Layer.h"
 #include "Pillar/ECS/Scene.h"
 #include "Pillar/ECS/SceneManager.h"
+#include "Pillar/ECS/SceneSnapshot.h"
 #include "Pillar/ECS/Systems/AnimationSystem.h"
 #include "Pillar/ECS/Systems/VelocityIntegrationSystem.h"
 #include "Pillar/ECS/Systems/PhysicsSystem.h"
@@ -97,7 +98,7 @@ namespace PillarEditor {
     private:
         // Scene management
         std::shared_ptr<Pillar::Scene> m_ActiveScene;
-        std::shared_ptr<Pillar::Scene> m_EditorScene;    // Backup for edit mode
+        Pillar::SceneSnapshot m_EditorSnapshot;          // Edit-mode state, restored on stop
         std::string m_CurrentScenePath;
 
         // Thesis start menu
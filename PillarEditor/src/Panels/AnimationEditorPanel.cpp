@@ -255,7 +255,7 @@ namespace PillarEditor {
 		}
 
 		// Get clip from system
-		Pillar::AnimationClip* clip = m_AnimSystem->GetClip(clipName);
+		const Pillar::AnimationClip* clip = m_AnimSystem->GetClip(clipName);
 		if (!clip)
 		{
 			ConsolePanel::Log("Animation clip not found: " + clipName, LogLevel::Error);
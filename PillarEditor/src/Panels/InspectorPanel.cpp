@@ -240,7 +240,7 @@ namespace PillarEditor {
         ImGui::PushItemWidth(-1);
         if (ImGui::InputText("##Tag", buffer, sizeof(buffer)))
         {
-            tag.Tag = std::string(buffer);
+            entity.SetName(std::string(buffer));
         }
         ImGui::PopItemWidth();
 
@@ -1694,7 +1694,7 @@ namespace PillarEditor {
                 bool isSelected = anim.CurrentClipName.empty();
                 if (ImGui::Selectable("None", isSelected))
                 {
-                    anim.CurrentClipName = "";
+                    anim.SetClip("");
                 }
                 if (isSelected)
                     ImGui::SetItemDefaultFocus();
@@ -1705,10 +1705,11 @@ namespace PillarEditor {
                     isSelected = (anim.CurrentClipName == clipName);
                     if (ImGui::Selectable(clipName.c_str(), isSelected))
                     {
-                        anim.CurrentClipName = clipName;
-                        if (anim.Playing)
+                        const bool wasPlaying = anim.Playing;
+                        anim.SetClip(clipName);
+                        if (wasPlaying)
                         {
-                            anim.Play(clipName); // Restart with new clip
+                            anim.Play(clipName, true); // Restart with new clip
                         }
                     }
                     if (isSelected)
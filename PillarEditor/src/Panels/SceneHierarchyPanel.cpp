@@ -238,7 +238,7 @@ namespace PillarEditor {
                     
                     // Assign clip to component
                     auto& anim = entity.GetComponent<Pillar::AnimationComponent>();
-                    anim.CurrentClipName = clipName;
+                    anim.SetClip(clipName);
                     
                     // Make sure clip is loaded (should already be via AnimationLibraryManager)
                     // If not, we could load it here, but that's handled automatically by the manager
@@ -226,7 +226,7 @@ namespace PillarEditor {
 		return names;
 	}
 
-	Pillar::AnimationClip* AnimationLibraryManager::GetClip(const std::string& name) const
+	const Pillar::AnimationClip* AnimationLibraryManager::GetClip(const std::string& name) const
 	{
 		if (!m_AnimSystem)
 			return nullptr;
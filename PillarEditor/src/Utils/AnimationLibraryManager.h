@@ -68,7 +68,7 @@ namespace PillarEditor {
 		 * @param name Name of the clip
 		 * @return Pointer to clip, or nullptr if not found
 		 */
-		Pillar::AnimationClip* GetClip(const std::string& name) const;
+		const Pillar::AnimationClip* GetClip(const std::string& name) const;
 
 		/**
 		 * @brief Set the directory to scan for animations
@@ -420,6 +420,36 @@ TEST_F(AudioSourceComponentTests, AssignmentOperator_DoesNotCopySource) {
     EXPECT_NE(copy.Source, original.Source);
 }
 
+TEST_F(AudioSourceComponentTests, Setters_FlagOnlyChangedFields) {
+    AudioSourceComponent comp;
+    comp.Dirty = 0;
+
+    comp.SetVolume(0.25f);
+    EXPECT_FLOAT_EQ(comp.Volume, 0.25f);
+    EXPECT_EQ(comp.Dirty, AudioSourceComponent::DirtyVolume);
+
+    comp.SetMaxDistance(40.0f);
+    EXPECT_EQ(comp.Dirty, AudioSourceComponent::DirtyVolume | AudioSourceComponent::DirtyAttenuation);
+    EXPECT_FALSE(comp.Dirty & AudioSourceComponent::DirtyPitch);
+}
+
+TEST_F(AudioSourceComponentTests, Copy_MarksEverythingDirty) {
+    AudioSourceComponent original;
+    original.Dirty = 0;
+    original.HasAppliedPosition = true;
+
+    AudioSourceComponent copy(original);
+    EXPECT_EQ(copy.Dirty, AudioSourceComponent::DirtyAll);
+    EXPECT_FALSE(copy.HasAppliedPosition);
+
+    AudioSourceComponent assigned;
+    assigned.Dirty = 0;
+    assigned.HasAppliedPosition = true;
+    assigned = original;
+    EXPECT_EQ(assigned.Dirty, AudioSourceComponent::DirtyAll);
+    EXPECT_FALSE(assigned.HasAppliedPosition);
+}
+
 // ==================== AudioListenerComponent Tests ====================
 
 class AudioListenerComponentTests : public ::testing::Test {
@@ -1,5 +1,5 @@
 #include <gtest/gtest.h>
-// AudioTests: unit tests for AudioEngine, AudioSource, AudioBuffer, WavLoader
+// AudioTests: unit tests for AudioEngine, AudioSource, AudioBuffer, WavLoader, AudioDecoder
 // and factory functions to validate initialization, properties and error cases.
 #include <gmock/gmock.h>
 #include "Pillar/Audio/AudioEngine.h"
@@ -7,7 +7,15 @@
 #include "Pillar/Audio/AudioSource.h"
 #include "Pillar/Audio/AudioClip.h"
 #include "Pillar/Audio/WavLoader.h"
+#include "Pillar/Audio/AudioDecoder.h"
+#include "Pillar/Audio/WavDecoder.h"
+#include "Pillar/Audio/VoicePool.h"
+#include "Pillar/Audio/AudioStream.h"
 #include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 
 namespace Pillar {
 namespace Tests {
@@ -76,11 +84,12 @@ TEST_F(AudioEngineTests, MasterVolume_ClampsToBounds) {
     EXPECT_GE(AudioEngine::GetMasterVolume(), 0.0f);
 }
 
-TEST_F(AudioEngineTests, PlayOneShot_InvalidPath_ReturnsNull) {
+TEST_F(AudioEngineTests, PlayOneShot_InvalidPath_ReturnsInvalidHandle) {
     AudioEngine::Init();
 
-    auto source = AudioEngine::PlayOneShot("nonexistent.wav");
-    EXPECT_EQ(source, nullptr);
+    auto voice = AudioEngine::PlayOneShot("nonexistent.wav");
+    EXPECT_FALSE(voice.IsValid());
+    EXPECT_FALSE(AudioEngine::IsVoicePlaying(voice));
 }
 
 TEST_F(AudioEngineTests, BusVolume_AppliesToTrackedSource) {
@@ -147,6 +156,212 @@ TEST_F(AudioEngineTests, ListenerPosition_DefaultsToOrigin) {
     EXPECT_FLOAT_EQ(result.z, 0.0f);
 }
 
+// ==================== Buffer Cache Tests ====================
+
+namespace {
+    // Writes a 16-bit mono PCM WAV of silence and returns its absolute path
+    std::string WriteSilentWav(const std::string& name, uint32_t sampleCount)
+    {
+        auto path = std::filesystem::temp_directory_path() / name;
+        std::ofstream file(path, std::ios::binary);
+
+        const uint32_t dataSize = sampleCount * 2;
+        const uint32_t chunkSize = 36 + dataSize;
+        const uint32_t fmtSize = 16;
+        const uint16_t format = 1, channels = 1, blockAlign = 2, bits = 16;
+        const uint32_t sampleRate = 22050, byteRate = sampleRate * 2;
+
+        file.write("RIFF", 4);
+        file.write(reinterpret_cast<const char*>(&chunkSize), 4);
+        file.write("WAVEfmt ", 8);
+        file.write(reinterpret_cast<const char*>(&fmtSize), 4);
+        file.write(reinterpret_cast<const char*>(&format), 2);
+        file.write(reinterpret_cast<const char*>(&channels), 2);
+        file.write(reinterpret_cast<const char*>(&sampleRate), 4);
+        file.write(reinterpret_cast<const char*>(&byteRate), 4);
+        file.write(reinterpret_cast<const char*>(&blockAlign), 2);
+        file.write(reinterpret_cast<const char*>(&bits), 2);
+        file.write("data", 4);
+        file.write(reinterpret_cast<const char*>(&dataSize), 4);
+        std::vector<char> samples(dataSize, 0);
+        file.write(samples.data(), samples.size());
+        return path.string();
+    }
+}
+
+// Runs on the software backend, so no audio device is needed
+class AudioBufferCacheTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        AudioEngine::Init(AudioBackend::Software);
+        m_PreviousBudget = AudioEngine::GetBufferCacheBudget();
+    }
+
+    void TearDown() override {
+        AudioEngine::SetBufferCacheBudget(m_PreviousBudget);
+        AudioEngine::Shutdown();
+    }
+
+    size_t m_PreviousBudget = 0;
+};
+
+TEST_F(AudioBufferCacheTests, CreateBuffer_SharesBufferPerPath) {
+    auto path = WriteSilentWav("pillar_cache_shared.wav", 1000);
+
+    auto first = AudioEngine::CreateBuffer(path);
+    auto second = AudioEngine::CreateBuffer(path);
+
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(AudioEngine::GetCachedBufferCount(), 1u);
+    EXPECT_EQ(AudioEngine::GetBufferCacheMemory(), first->GetSizeInBytes());
+}
+
+TEST_F(AudioBufferCacheTests, CreateBufferFromDecodedData_UsesCache) {
+    auto path = WriteSilentWav("pillar_cache_decoded.wav", 1000);
+    WavData data;
+    ASSERT_TRUE(WavLoader::Load(path, data));
+
+    // Decoded data fills the cache on a miss; later lookups by path share it
+    auto decoded = AudioEngine::CreateBuffer(path, data);
+    ASSERT_NE(decoded, nullptr);
+    EXPECT_TRUE(AudioEngine::IsBufferCached(path));
+    EXPECT_EQ(AudioEngine::CreateBuffer(path), decoded);
+    EXPECT_EQ(AudioEngine::CreateBuffer(path, data), decoded);
+    EXPECT_EQ(AudioEngine::GetCachedBufferCount(), 1u);
+}
+
+TEST_F(AudioBufferCacheTests, Budget_EvictsLeastRecentlyUsedUnusedBuffers) {
+    auto a = WriteSilentWav("pillar_cache_a.wav", 1000);
+    auto b = WriteSilentWav("pillar_cache_b.wav", 1000);
+    auto c = WriteSilentWav("pillar_cache_c.wav", 1000);
+
+    // Room for two of the three (equally sized) buffers
+    const size_t bytes = AudioEngine::CreateBuffer(a)->GetSizeInBytes();
+    AudioEngine::SetBufferCacheBudget(bytes * 2);
+    auto held = AudioEngine::CreateBuffer(b);
+    AudioEngine::CreateBuffer(c);
+
+    // a is the oldest unused entry; b is still referenced
+    EXPECT_FALSE(AudioEngine::IsBufferCached(a));
+    EXPECT_TRUE(AudioEngine::IsBufferCached(b));
+    EXPECT_TRUE(AudioEngine::IsBufferCached(c));
+    EXPECT_LE(AudioEngine::GetBufferCacheMemory(), bytes * 2);
+}
+
+TEST_F(AudioBufferCacheTests, PreloadBuffers_PinsUntilUnpinned) {
+    auto a = WriteSilentWav("pillar_cache_bank_a.wav", 1000);
+    auto b = WriteSilentWav("pillar_cache_bank_b.wav", 1000);
+
+    EXPECT_EQ(AudioEngine::PreloadBuffers({ a, b }), 2u);
+    AudioEngine::SetBufferCacheBudget(0);
+    EXPECT_EQ(AudioEngine::GetCachedBufferCount(), 2u);
+
+    AudioEngine::UnpinBuffers({ a, b });
+    EXPECT_EQ(AudioEngine::GetCachedBufferCount(), 0u);
+    EXPECT_EQ(AudioEngine::GetBufferCacheMemory(), 0u);
+}
+
+// ==================== Voice Pool Tests ====================
+
+class VoicePoolTests : public AudioBufferCacheTests {
+protected:
+    std::shared_ptr<AudioBuffer> LoadOneSecond() {
+        // Long enough that nothing finishes during a test
+        return AudioEngine::CreateBuffer(WriteSilentWav("pillar_voice_pool.wav", 22050));
+    }
+};
+
+TEST_F(VoicePoolTests, Play_StealsFromLowerPriority) {
+    auto buffer = LoadOneSecond();
+    ASSERT_NE(buffer, nullptr);
+    VoicePool pool(2, 8);
+    ASSERT_EQ(pool.GetSourceCount(), 2u);
+
+    VoiceParams low;
+    auto first = pool.Play(buffer, low);
+    auto second = pool.Play(buffer, low);
+    EXPECT_EQ(pool.GetRealVoiceCount(), 2u);
+
+    VoiceParams high;
+    high.Priority = 5;
+    auto important = pool.Play(buffer, high);
+
+    EXPECT_FALSE(pool.IsVirtual(important));
+    EXPECT_EQ(pool.GetRealVoiceCount(), 2u);
+    EXPECT_EQ(pool.GetVirtualVoiceCount(), 1u);
+    EXPECT_TRUE(pool.IsVirtual(first) || pool.IsVirtual(second));
+}
+
+TEST_F(VoicePoolTests, OutOfRangeVoice_IsVirtualUntilAudible) {
+    auto buffer = LoadOneSecond();
+    ASSERT_NE(buffer, nullptr);
+    VoicePool pool(2, 8);
+
+    VoiceParams params;
+    params.Position = glm::vec3(500.0f, 0.0f, 0.0f);
+    params.MaxDistance = 100.0f;
+    auto voice = pool.Play(buffer, params);
+
+    ASSERT_TRUE(pool.IsActive(voice));
+    EXPECT_TRUE(pool.IsVirtual(voice));
+    EXPECT_EQ(pool.GetRealVoiceCount(), 0u);
+
+    pool.SetPosition(voice, glm::vec3(1.0f, 0.0f, 0.0f));
+    pool.Update(0.01f);
+    EXPECT_FALSE(pool.IsVirtual(voice));
+}
+
+TEST_F(VoicePoolTests, StoppedHandle_GoesStaleWhenSlotIsReused) {
+    auto buffer = LoadOneSecond();
+    ASSERT_NE(buffer, nullptr);
+    VoicePool pool(1, 1);
+
+    auto first = pool.Play(buffer, VoiceParams{});
+    pool.Stop(first);
+    auto second = pool.Play(buffer, VoiceParams{});
+
+    EXPECT_EQ(first.Index, second.Index);
+    EXPECT_FALSE(pool.IsActive(first));
+    EXPECT_TRUE(pool.IsActive(second));
+    EXPECT_EQ(pool.GetActiveVoiceCount(), 1u);
+}
+
+// ==================== Streaming Tests ====================
+
+class AudioStreamTests : public AudioBufferCacheTests {};
+
+TEST_F(AudioStreamTests, Play_QueuesWithoutLoadingWholeFile) {
+    // 10 s of audio; only a few 250 ms chunks should ever be resident
+    auto stream = AudioEngine::CreateStream(WriteSilentWav("pillar_stream_play.wav", 220500));
+    ASSERT_NE(stream, nullptr);
+    EXPECT_NEAR(stream->GetDuration(), 10.0f, 0.01f);
+
+    stream->Play();
+    EXPECT_TRUE(stream->IsPlaying());
+    AudioEngine::Update(0.016f);
+    EXPECT_LT(stream->GetPlaybackPosition(), 1.0f);
+
+    stream->Stop();
+    EXPECT_FALSE(stream->IsPlaying());
+    EXPECT_FLOAT_EQ(stream->GetPlaybackPosition(), 0.0f);
+}
+
+TEST_F(AudioStreamTests, Seek_MovesPlaybackPosition) {
+    auto stream = AudioEngine::CreateStream(WriteSilentWav("pillar_stream_seek.wav", 220500));
+    ASSERT_NE(stream, nullptr);
+
+    stream->Play();
+    stream->Seek(6.0f);
+    EXPECT_TRUE(stream->IsPlaying());
+    EXPECT_NEAR(stream->GetPlaybackPosition(), 6.0f, 0.1f);
+
+    // Past the end: clamped without looping, wrapped with it
+    stream->SetLooping(true);
+    stream->Seek(12.0f);
+    EXPECT_NEAR(stream->GetPlaybackPosition(), 2.0f, 0.1f);
+}
+
 // ==================== AudioSource Tests ====================
 
 class AudioSourceTests : public ::testing::Test {
@@ -297,6 +512,105 @@ TEST_F(WavLoaderTests, LoadFromMemory_TooSmall_ReturnsFalse) {
     EXPECT_FALSE(result);
 }
 
+TEST_F(WavLoaderTests, ReadHeader_LocatesSampleData) {
+    auto path = WriteSilentWav("pillar_wav_header.wav", 2205);
+
+    WavData format;
+    size_t dataOffset = 0;
+    size_t dataSize = 0;
+    ASSERT_TRUE(WavLoader::ReadHeader(path, format, dataOffset, dataSize));
+    EXPECT_EQ(format.SampleRate, 22050);
+    EXPECT_EQ(format.Channels, 1);
+    EXPECT_EQ(format.BitsPerSample, 16);
+    EXPECT_EQ(dataOffset, 44u);
+    EXPECT_EQ(dataSize, 4410u);
+    EXPECT_NEAR(format.Duration, 0.1f, 0.001f);
+    EXPECT_TRUE(format.Data.empty());
+}
+
+// ==================== AudioDecoder Tests ====================
+
+namespace {
+    // 440 Hz sine at 22050 Hz, interleaved
+    std::vector<int16_t> MakeSine(uint64_t frameCount, int channels)
+    {
+        std::vector<int16_t> samples(frameCount * channels);
+        for (uint64_t i = 0; i < frameCount; ++i)
+            for (int c = 0; c < channels; ++c)
+                samples[i * channels + c] = static_cast<int16_t>(8000.0 * std::sin(i * 2.0 * 3.14159265 * 440.0 / 22050.0));
+        return samples;
+    }
+}
+
+TEST(AudioDecoderTests, ImaAdpcm_RoundTripsWithinCodecError) {
+    const uint64_t frameCount = 5000;  // Not a whole number of blocks
+    const auto pcm = MakeSine(frameCount, 2);
+    const auto path = (std::filesystem::temp_directory_path() / "pillar_adpcm_roundtrip.wav").string();
+    ASSERT_TRUE(ImaAdpcmDecoder::Encode(path, pcm.data(), frameCount, 2, 22050, 512));
+
+    WavData decoded;
+    ASSERT_TRUE(AudioDecoder::Decode(path, decoded));
+    EXPECT_EQ(decoded.Channels, 2);
+    EXPECT_EQ(decoded.BitsPerSample, 16);
+    EXPECT_EQ(decoded.SampleRate, 22050);
+    ASSERT_EQ(decoded.Data.size(), frameCount * 2 * sizeof(int16_t));
+
+    // The file is about a quarter of the PCM size
+    EXPECT_LT(std::filesystem::file_size(path), frameCount * 2 * sizeof(int16_t) / 3);
+
+    const auto* samples = reinterpret_cast<const int16_t*>(decoded.Data.data());
+    double totalError = 0.0;
+    for (size_t i = 0; i < pcm.size(); ++i)
+        totalError += std::abs(samples[i] - pcm[i]);
+    EXPECT_LT(totalError / static_cast<double>(pcm.size()), 200.0);
+}
+
+TEST(AudioDecoderTests, ImaAdpcm_SeekMatchesSequentialDecode) {
+    const uint64_t frameCount = 3000;
+    const auto pcm = MakeSine(frameCount, 1);
+    const auto path = (std::filesystem::temp_directory_path() / "pillar_adpcm_seek.wav").string();
+    ASSERT_TRUE(ImaAdpcmDecoder::Encode(path, pcm.data(), frameCount, 1, 22050, 256));
+
+    WavData whole;
+    ASSERT_TRUE(AudioDecoder::Decode(path, whole));
+    const auto* expected = reinterpret_cast<const int16_t*>(whole.Data.data());
+
+    auto decoder = AudioDecoder::Open(path);
+    ASSERT_NE(decoder, nullptr);
+    EXPECT_EQ(decoder->GetFrameCount(), frameCount);
+
+    // Land in the middle of a block, then read across the next block boundary
+    int16_t chunk[600] = {};
+    ASSERT_TRUE(decoder->SeekFrame(1000));
+    ASSERT_EQ(decoder->ReadFrames(reinterpret_cast<char*>(chunk), 600), 600u);
+    for (int i = 0; i < 600; ++i)
+        ASSERT_EQ(chunk[i], expected[1000 + i]) << "frame " << 1000 + i;
+
+    // Reads stop at the end of the file
+    ASSERT_TRUE(decoder->SeekFrame(frameCount - 10));
+    EXPECT_EQ(decoder->ReadFrames(reinterpret_cast<char*>(chunk), 600), 10u);
+}
+
+TEST(AudioDecoderTests, PcmWav_MatchesWavLoader) {
+    auto path = WriteSilentWav("pillar_decoder_pcm.wav", 2205);
+
+    WavData loaded;
+    WavData decoded;
+    ASSERT_TRUE(WavLoader::Load(path, loaded));
+    ASSERT_TRUE(AudioDecoder::Decode(path, decoded));
+    EXPECT_EQ(decoded.Data, loaded.Data);
+    EXPECT_EQ(decoded.SampleRate, loaded.SampleRate);
+    EXPECT_NEAR(decoded.Duration, loaded.Duration, 0.0001f);
+}
+
+TEST(AudioDecoderTests, Open_RejectsUnknownFormats) {
+    const auto path = (std::filesystem::temp_directory_path() / "pillar_decoder_garbage.ogg").string();
+    std::ofstream(path, std::ios::binary) << "not an audio file";
+
+    EXPECT_EQ(AudioDecoder::Open(path), nullptr);
+    EXPECT_EQ(AudioDecoder::Open("nonexistent_file.ogg"), nullptr);
+}
+
 // ==================== AudioBuffer Tests ====================
 
 class AudioBufferTests : public ::testing::Test {
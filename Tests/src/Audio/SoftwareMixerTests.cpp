@@ -0,0 +1,268 @@
+#include <gtest/gtest.h>
+// SoftwareMixerTests: the in-memory audio backend - rendering, gain staging,
+// distance attenuation, panning, bus fades and end-of-buffer handling. Needs no device.
+#include "Pillar/Audio/AudioEngine.h"
+#include "Pillar/Audio/AudioBuffer.h"
+#include "Pillar/Audio/AudioSource.h"
+#include "Pillar/Audio/AudioStream.h"
+#include "Pillar/Audio/WavLoader.h"
+#include "Platform/Software/SoftwareMixer.h"
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace Pillar {
+namespace Tests {
+
+namespace {
+    constexpr float EqualPowerCentre = 0.70710678f;
+
+    // In-memory buffer of a constant 16-bit signal, one value per channel
+    std::shared_ptr<AudioBuffer> MakeConstantBuffer(const std::vector<int16_t>& frame, uint32_t frameCount, int sampleRate = 48000)
+    {
+        WavData data;
+        data.SampleRate = sampleRate;
+        data.Channels = static_cast<int>(frame.size());
+        data.BitsPerSample = 16;
+        data.Duration = static_cast<float>(frameCount) / static_cast<float>(sampleRate);
+        data.Data.resize(static_cast<size_t>(frameCount) * frame.size() * sizeof(int16_t));
+        for (uint32_t i = 0; i < frameCount; ++i)
+            std::memcpy(data.Data.data() + i * frame.size() * sizeof(int16_t), frame.data(), frame.size() * sizeof(int16_t));
+        return AudioBuffer::Create("constant", data);
+    }
+
+    // 48 kHz mono 16-bit WAV file of a constant signal; returns its absolute path
+    std::string WriteConstantWav(const std::string& name, int16_t value, uint32_t frameCount)
+    {
+        auto path = std::filesystem::temp_directory_path() / name;
+        std::ofstream file(path, std::ios::binary);
+
+        const uint32_t dataSize = frameCount * 2;
+        const uint32_t chunkSize = 36 + dataSize;
+        const uint32_t fmtSize = 16;
+        const uint16_t format = 1, channels = 1, blockAlign = 2, bits = 16;
+        const uint32_t sampleRate = 48000, byteRate = sampleRate * 2;
+
+        file.write("RIFF", 4);
+        file.write(reinterpret_cast<const char*>(&chunkSize), 4);
+        file.write("WAVEfmt ", 8);
+        file.write(reinterpret_cast<const char*>(&fmtSize), 4);
+        file.write(reinterpret_cast<const char*>(&format), 2);
+        file.write(reinterpret_cast<const char*>(&channels), 2);
+        file.write(reinterpret_cast<const char*>(&sampleRate), 4);
+        file.write(reinterpret_cast<const char*>(&byteRate), 4);
+        file.write(reinterpret_cast<const char*>(&blockAlign), 2);
+        file.write(reinterpret_cast<const char*>(&bits), 2);
+        file.write("data", 4);
+        file.write(reinterpret_cast<const char*>(&dataSize), 4);
+        std::vector<int16_t> samples(frameCount, value);
+        file.write(reinterpret_cast<const char*>(samples.data()), dataSize);
+        return path.string();
+    }
+}
+
+class SoftwareMixerTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        AudioEngine::Init(AudioBackend::Software);
+    }
+
+    void TearDown() override {
+        AudioEngine::Shutdown();
+    }
+
+    std::shared_ptr<AudioSource> PlayConstant(const std::vector<int16_t>& frame, uint32_t frameCount = 48000) {
+        auto source = AudioEngine::CreateSource();
+        source->SetBuffer(MakeConstantBuffer(frame, frameCount));
+        source->Play();
+        return source;
+    }
+
+    std::vector<float> Render(uint32_t frameCount) {
+        std::vector<float> out(frameCount * 2);
+        AudioEngine::GetSoftwareMixer()->Render(out.data(), frameCount);
+        return out;
+    }
+};
+
+TEST_F(SoftwareMixerTests, Init_NeedsNoDevice) {
+    EXPECT_TRUE(AudioEngine::IsInitialized());
+    EXPECT_EQ(AudioEngine::GetBackend(), AudioBackend::Software);
+    ASSERT_NE(AudioEngine::GetSoftwareMixer(), nullptr);
+
+    // Streams open on the software backend too; a missing file still fails
+    EXPECT_EQ(AudioEngine::CreateStream("music.ogg"), nullptr);
+
+    AudioEngine::Shutdown();
+    EXPECT_FALSE(AudioEngine::IsInitialized());
+    EXPECT_EQ(AudioEngine::GetSoftwareMixer(), nullptr);
+}
+
+TEST_F(SoftwareMixerTests, Render_SilentWithNothingPlaying) {
+    auto source = AudioEngine::CreateSource();
+    ASSERT_NE(source, nullptr);
+
+    for (float sample : Render(600))
+        EXPECT_EQ(sample, 0.0f);
+    EXPECT_EQ(AudioEngine::GetSoftwareMixer()->GetMixedVoiceCount(), 0u);
+}
+
+TEST_F(SoftwareMixerTests, MonoAtListener_PansEqualPower) {
+    auto source = PlayConstant({ 16384 });
+    const auto out = Render(600);
+
+    EXPECT_EQ(AudioEngine::GetSoftwareMixer()->GetMixedVoiceCount(), 1u);
+    for (size_t i = 0; i < out.size(); ++i)
+        ASSERT_NEAR(out[i], 0.5f * EqualPowerCentre, 1e-6f) << "sample " << i;
+}
+
+TEST_F(SoftwareMixerTests, Stereo_PassesThroughUnpanned) {
+    auto source = PlayConstant({ 16384, -8192 });
+    source->SetPosition({ 50.0f, 0.0f, 0.0f });   // Ignored for stereo, as in OpenAL
+    const auto out = Render(300);
+
+    for (size_t i = 0; i < out.size(); i += 2)
+    {
+        ASSERT_NEAR(out[i], 0.5f, 1e-6f);
+        ASSERT_NEAR(out[i + 1], -0.25f, 1e-6f);
+    }
+}
+
+TEST_F(SoftwareMixerTests, Attenuation_MatchesInverseDistanceClamped) {
+    auto source = PlayConstant({ 16384 });
+    source->SetPosition({ 0.0f, 0.0f, -4.0f });   // Straight ahead
+    source->SetMinDistance(1.0f);
+    source->SetRolloffFactor(1.0f);
+
+    auto out = Render(256);
+    EXPECT_NEAR(out[0], 0.5f * 0.25f * EqualPowerCentre, 1e-5f);
+    EXPECT_NEAR(out[1], out[0], 1e-6f);
+
+    // Past the max distance the curve stops falling
+    source->SetMaxDistance(2.0f);
+    Render(256);
+    out = Render(256);
+    EXPECT_NEAR(out[0], 0.5f * 0.5f * EqualPowerCentre, 1e-5f);
+
+    EXPECT_NEAR(SoftwareMixer::ComputeSpatialGain({ 0.0f, 0.0f, -0.5f }, 1.0f, 100.0f, 1.0f,
+        glm::vec3(0.0f), { 0.0f, 0.0f, -1.0f }, { 0.0f, 1.0f, 0.0f }).x, EqualPowerCentre, 1e-6f);
+}
+
+TEST_F(SoftwareMixerTests, Pan_FollowsListenerRightAxis) {
+    auto source = PlayConstant({ 16384 });
+    source->SetPosition({ 3.0f, 0.0f, 0.0f });
+
+    auto out = Render(256);
+    EXPECT_NEAR(out[0], 0.0f, 1e-6f);
+    EXPECT_NEAR(out[1], 0.5f / 3.0f, 1e-5f);
+
+    // Turn around: the source is now on the left
+    AudioEngine::SetListenerOrientation({ 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 0.0f });
+    Render(256);
+    out = Render(256);
+    EXPECT_NEAR(out[0], 0.5f / 3.0f, 1e-5f);
+    EXPECT_NEAR(out[1], 0.0f, 1e-6f);
+}
+
+TEST_F(SoftwareMixerTests, BusFade_RampsAcrossTheBlock) {
+    auto source = PlayConstant({ 16384 });
+    Render(SoftwareMixer::BlockFrames);
+
+    AudioEngine::FadeOut(AudioEngine::AudioBus::SFX, 1.0f);
+    AudioEngine::Update(0.5f);
+    ASSERT_NEAR(source->GetVolume(), 0.5f, 1e-5f);
+
+    const auto ramp = Render(SoftwareMixer::BlockFrames);
+    const float from = 0.5f * EqualPowerCentre;
+    const float to = 0.5f * 0.5f * EqualPowerCentre;
+    EXPECT_NEAR(ramp[0], from, 1e-5f);
+    for (size_t i = 2; i < ramp.size(); i += 2)
+    {
+        ASSERT_LE(ramp[i], ramp[i - 2]);
+        ASSERT_LT(ramp[i - 2] - ramp[i], 0.001f);   // No zipper steps
+    }
+    EXPECT_NEAR(ramp[ramp.size() - 2], to, 0.001f);
+
+    // Once there the gain holds
+    for (float sample : Render(SoftwareMixer::BlockFrames))
+        ASSERT_NEAR(sample, to, 1e-6f);
+}
+
+TEST_F(SoftwareMixerTests, OneShot_StopsAtEndAndLoopWraps) {
+    auto oneShot = PlayConstant({ 16384 }, 100);
+    auto out = Render(256);
+    EXPECT_GT(out[99 * 2], 0.0f);
+    EXPECT_EQ(out[100 * 2], 0.0f);
+    EXPECT_TRUE(oneShot->IsStopped());
+    EXPECT_FLOAT_EQ(oneShot->GetPlaybackPosition(), 0.0f);
+
+    oneShot.reset();
+    auto loop = PlayConstant({ 16384 }, 100);
+    loop->SetLooping(true);
+    out = Render(256);
+    for (size_t i = 0; i < out.size(); ++i)
+        ASSERT_GT(out[i], 0.0f);
+    EXPECT_TRUE(loop->IsPlaying());
+    EXPECT_NEAR(loop->GetPlaybackPosition(), 56.0f / 48000.0f, 1e-7f);
+}
+
+TEST_F(SoftwareMixerTests, Pitch_ResamplesBuffer) {
+    auto source = PlayConstant({ 16384 }, 100);
+    source->SetPitch(2.0f);
+    auto out = Render(256);
+    EXPECT_NEAR(out[49 * 2], 0.5f * EqualPowerCentre, 1e-6f);
+    EXPECT_EQ(out[50 * 2], 0.0f);
+    EXPECT_TRUE(source->IsStopped());
+
+    // A 24 kHz buffer plays at half speed on the 48 kHz mixer
+    auto slow = AudioEngine::CreateSource();
+    slow->SetBuffer(MakeConstantBuffer({ 16384 }, 100, 24000));
+    slow->Play();
+    out = Render(256);
+    EXPECT_GT(out[199 * 2], 0.0f);
+    EXPECT_EQ(out[200 * 2], 0.0f);
+}
+
+TEST_F(SoftwareMixerTests, PauseAndResume_KeepCursor) {
+    auto source = PlayConstant({ 16384 }, 1000);
+    Render(300);
+    source->Pause();
+    for (float sample : Render(300))
+        ASSERT_EQ(sample, 0.0f);
+    EXPECT_NEAR(source->GetPlaybackPosition(), 300.0f / 48000.0f, 1e-7f);
+
+    source->Play();
+    Render(300);
+    EXPECT_NEAR(source->GetPlaybackPosition(), 600.0f / 48000.0f, 1e-7f);
+}
+
+TEST_F(SoftwareMixerTests, Stream_PlaysAcrossChunksUntilTheEnd) {
+    // 2 s of audio: more than the stream keeps queued, so Update() has to refill it
+    auto stream = AudioEngine::CreateStream(WriteConstantWav("pillar_software_stream.wav", 16384, 96000));
+    ASSERT_NE(stream, nullptr);
+    stream->Play();
+
+    // Every chunk boundary is crossed without a gap
+    for (int i = 0; i < 8; ++i)
+    {
+        const auto out = Render(12000);
+        for (size_t j = 0; j < out.size(); ++j)
+            ASSERT_NEAR(out[j], 0.5f * EqualPowerCentre, 1e-6f) << "block " << i << ", sample " << j;
+        AudioEngine::Update(0.0f);
+        if (i < 7)
+            EXPECT_NEAR(stream->GetPlaybackPosition(), (i + 1) * 0.25f, 1e-4f);
+    }
+
+    // The last chunk ran out: the stream stops and rewinds
+    EXPECT_FALSE(stream->IsPlaying());
+    EXPECT_FLOAT_EQ(stream->GetPlaybackPosition(), 0.0f);
+    for (float sample : Render(256))
+        ASSERT_EQ(sample, 0.0f);
+}
+
+} // namespace Tests
+} // namespace Pillar
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 // AssetManagerTests: verifies asset path resolution, subdirectory lookup and
-// behavior when directories or files are missing or absolute/relative paths.
+// behavior when directories or files are missing or absolute/relative paths,
+// plus the texture registry's handles and background decoding.
 #include "Pillar/Utils/AssetManager.h"
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <thread>
 
 using namespace Pillar;
 
@@ -224,3 +227,127 @@ TEST_F(AssetManagerTests, PathResolution_MusicSubdirectory)
 	// Cleanup
 	std::filesystem::remove_all(tempDir);
 }
+
+// ============================================================================
+// Texture registry Tests (no GPU: textures stop at Decoded or Failed)
+// ============================================================================
+
+// Polls until the texture leaves the Decoding state or a few seconds pass
+static TextureLoadState WaitForDecode(TextureHandle handle)
+{
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	TextureLoadState state = AssetManager::GetTextureState(handle);
+	while (state == TextureLoadState::Decoding && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		state = AssetManager::GetTextureState(handle);
+	}
+	return state;
+}
+
+TEST_F(AssetManagerTests, TextureHandle_DeduplicatesByPath)
+{
+	TextureHandle a = AssetManager::GetTextureHandle("registry_test_a.png");
+	TextureHandle b = AssetManager::GetTextureHandle("registry_test_b.png");
+
+	EXPECT_NE(a, InvalidTextureHandle);
+	EXPECT_NE(b, InvalidTextureHandle);
+	EXPECT_NE(a, b);
+	EXPECT_EQ(AssetManager::GetTextureHandle("registry_test_a.png"), a);
+	EXPECT_EQ(AssetManager::GetTextureHandle(""), InvalidTextureHandle);
+}
+
+TEST_F(AssetManagerTests, TextureHandle_RegisteringDoesNotLoad)
+{
+	TextureHandle handle = AssetManager::GetTextureHandle("registry_test_unloaded.png");
+
+	EXPECT_EQ(AssetManager::GetTextureState(handle), TextureLoadState::Unloaded);
+	EXPECT_EQ(AssetManager::GetTextureState(InvalidTextureHandle), TextureLoadState::Unloaded);
+	EXPECT_EQ(AssetManager::GetTexture(InvalidTextureHandle), nullptr);
+}
+
+TEST_F(AssetManagerTests, PrefetchTexture_MissingFileFails)
+{
+	AssetManager::SetAssetsDirectory("C:/NonExistentPath/Assets");
+	TextureHandle handle = AssetManager::GetTextureHandle("registry_test_missing.png");
+
+	AssetManager::PrefetchTexture(handle);
+	EXPECT_EQ(WaitForDecode(handle), TextureLoadState::Failed);
+}
+
+TEST_F(AssetManagerTests, PrefetchTextures_DecodesOnWorkers)
+{
+	// Two 2x2 24-bit BMPs (rows padded to 4 bytes)
+	std::filesystem::path tempDir = std::filesystem::temp_directory_path() / "pillar_test_texture_registry";
+	std::filesystem::create_directories(tempDir);
+
+	auto writeBmp = [](const std::filesystem::path& path) {
+		const uint8_t header[54] = {
+			'B', 'M', 70, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,
+			40, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 1, 0, 24, 0,
+			0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+		const uint8_t pixels[16] = { 0, 0, 255, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 255, 255, 0 };
+		std::ofstream file(path, std::ios::binary);
+		file.write(reinterpret_cast<const char*>(header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(pixels), sizeof(pixels));
+	};
+	writeBmp(tempDir / "frame0.bmp");
+	writeBmp(tempDir / "frame1.bmp");
+
+	std::vector<TextureHandle> handles = {
+		AssetManager::GetTextureHandle((tempDir / "frame0.bmp").string()),
+		AssetManager::GetTextureHandle((tempDir / "frame1.bmp").string())
+	};
+	AssetManager::PrefetchTextures(handles);
+
+	EXPECT_EQ(WaitForDecode(handles[0]), TextureLoadState::Decoded);
+	EXPECT_EQ(WaitForDecode(handles[1]), TextureLoadState::Decoded);
+
+	// Decoded textures wait for ProcessTextureUploads; unloading leaves them queued
+	EXPECT_EQ(AssetManager::GetTexture(handles[0]), nullptr);
+	AssetManager::UnloadTextures();
+	EXPECT_EQ(AssetManager::GetTextureState(handles[0]), TextureLoadState::Decoded);
+	EXPECT_EQ(AssetManager::GetTextureHandle((tempDir / "frame0.bmp").string()), handles[0]);
+
+	std::filesystem::remove_all(tempDir);
+}
+
+TEST_F(AssetManagerTests, LoadTextureAsync_SharesStandInPerPath)
+{
+	AssetManager::SetAssetsDirectory("C:/NonExistentPath/Assets");
+
+	// Nothing is uploaded without a renderer, so every call gets the same stand-in,
+	// whether the decode is still running or has already failed
+	TextureHandle handle = AssetManager::GetTextureHandle("registry_test_async.png");
+	std::shared_ptr<Texture2D> first = AssetManager::LoadTextureAsync("registry_test_async.png");
+	std::shared_ptr<Texture2D> second = AssetManager::LoadTextureAsync("registry_test_async.png");
+
+	ASSERT_NE(first, nullptr);
+	EXPECT_EQ(first, second);
+	ASSERT_EQ(WaitForDecode(handle), TextureLoadState::Failed);
+	EXPECT_EQ(AssetManager::LoadTextureAsync("registry_test_async.png"), first);
+	EXPECT_EQ(AssetManager::LoadTextureAsync(""), nullptr);
+}
+
+TEST_F(AssetManagerTests, FailedTextureRetriesAfterUnload)
+{
+	AssetManager::SetAssetsDirectory("C:/NonExistentPath/Assets");
+	TextureHandle handle = AssetManager::GetTextureHandle("registry_test_retry.png");
+
+	AssetManager::PrefetchTexture(handle);
+	ASSERT_EQ(WaitForDecode(handle), TextureLoadState::Failed);
+
+	AssetManager::UnloadTextures();
+	EXPECT_EQ(AssetManager::GetTextureState(handle), TextureLoadState::Unloaded);
+}
+
+TEST_F(AssetManagerTests, TextureUploadBudget)
+{
+	const size_t original = AssetManager::GetTextureUploadBudget();
+	EXPECT_GT(original, 0u);
+
+	AssetManager::SetTextureUploadBudget(1024);
+	EXPECT_EQ(AssetManager::GetTextureUploadBudget(), 1024u);
+
+	AssetManager::SetTextureUploadBudget(original);
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+// ProfilerTests: zone capture, nesting, per-thread buffers and Chrome trace export.
+#include "Pillar/Utils/Profiler.h"
+#include "Pillar/Utils/ThreadPool.h"
+#include <nlohmann/json.hpp>
+#include <set>
+#include <sstream>
+#include <string>
+
+using namespace Pillar;
+
+namespace {
+
+    size_t CountNamed(const std::vector<ProfileEvent>& events, const std::string& name)
+    {
+        size_t count = 0;
+        for (const ProfileEvent& event : events)
+        {
+            if (event.Name && name == event.Name)
+                ++count;
+        }
+        return count;
+    }
+
+}
+
+TEST(ProfilerTests, ScopesOutsideCaptureAreNotRecorded)
+{
+    Profiler::Start();
+    Profiler::Stop();
+
+    {
+        PIL_PROFILE_SCOPE("NotCaptured");
+    }
+
+    EXPECT_FALSE(Profiler::IsCapturing());
+    EXPECT_EQ(CountNamed(Profiler::Collect(), "NotCaptured"), 0u);
+}
+
+// The zone macros compile to nothing without PILLAR_ENABLE_PROFILER
+#if PIL_PROFILE
+
+TEST(ProfilerTests, NestedScopesRecordDepthAndContainment)
+{
+    Profiler::Start();
+    {
+        PIL_PROFILE_SCOPE("Outer");
+        {
+            PIL_PROFILE_SCOPE("Inner");
+        }
+    }
+    Profiler::Stop();
+
+    const auto events = Profiler::Collect();
+    ASSERT_EQ(events.size(), 2u);
+
+    // Ordered by start time, so the parent comes first even though it closed last
+    const ProfileEvent& outer = events[0];
+    const ProfileEvent& inner = events[1];
+    EXPECT_STREQ(outer.Name, "Outer");
+    EXPECT_STREQ(inner.Name, "Inner");
+    EXPECT_EQ(outer.Depth, 0u);
+    EXPECT_EQ(inner.Depth, 1u);
+    EXPECT_EQ(outer.ThreadId, inner.ThreadId);
+    EXPECT_GE(inner.StartNs, outer.StartNs);
+    EXPECT_LE(inner.StartNs + inner.DurationNs, outer.StartNs + outer.DurationNs);
+}
+
+TEST(ProfilerTests, StartDiscardsPreviousCapture)
+{
+    Profiler::Start();
+    {
+        PIL_PROFILE_SCOPE("First");
+    }
+    Profiler::Stop();
+
+    Profiler::Start();
+    {
+        PIL_PROFILE_SCOPE("Second");
+    }
+    Profiler::Stop();
+
+    const auto events = Profiler::Collect();
+    EXPECT_EQ(CountNamed(events, "First"), 0u);
+    EXPECT_EQ(CountNamed(events, "Second"), 1u);
+}
+
+TEST(ProfilerTests, FunctionScopeUsesFunctionName)
+{
+    Profiler::Start();
+    {
+        PIL_PROFILE_FUNCTION();
+    }
+    Profiler::Stop();
+
+    const auto events = Profiler::Collect();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_NE(std::string(events[0].Name).find("TestBody"), std::string::npos);
+}
+
+TEST(ProfilerTests, EventsSpanSeveralChunks)
+{
+    const size_t count = Profiler::ChunkCapacity * 2 + 17;
+
+    Profiler::Start();
+    for (size_t i = 0; i < count; ++i)
+    {
+        PIL_PROFILE_SCOPE("Tiny");
+    }
+    Profiler::Stop();
+
+    EXPECT_EQ(CountNamed(Profiler::Collect(), "Tiny"), count);
+    EXPECT_EQ(Profiler::GetDroppedEventCount(), 0u);
+}
+
+TEST(ProfilerTests, WorkerThreadsRecordIntoTheirOwnBuffers)
+{
+    ThreadPool pool(3);
+
+    Profiler::Start();
+    {
+        PIL_PROFILE_SCOPE("Dispatch");
+        pool.ParallelFor(64, 1, [](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                PIL_PROFILE_SCOPE("Item");
+            }
+        });
+    }
+    Profiler::Stop();
+
+    const auto events = Profiler::Collect();
+    EXPECT_EQ(CountNamed(events, "Item"), 64u);
+    EXPECT_EQ(CountNamed(events, "Dispatch"), 1u);
+
+    // Events come grouped by thread, each group in start order
+    std::set<uint32_t> finishedThreads;
+    for (size_t i = 1; i < events.size(); ++i)
+    {
+        if (events[i].ThreadId == events[i - 1].ThreadId)
+        {
+            EXPECT_GE(events[i].StartNs, events[i - 1].StartNs);
+            continue;
+        }
+        EXPECT_TRUE(finishedThreads.insert(events[i - 1].ThreadId).second);
+        EXPECT_EQ(finishedThreads.count(events[i].ThreadId), 0u);
+    }
+}
+
+TEST(ProfilerTests, ChromeTraceIsValidJson)
+{
+    Profiler::SetThreadName("Test \"Main\"");
+
+    Profiler::Start();
+    {
+        PIL_PROFILE_SCOPE("Frame");
+        {
+            PIL_PROFILE_SCOPE("Update");
+        }
+    }
+    Profiler::Stop();
+
+    std::stringstream trace;
+    Profiler::WriteChromeTrace(trace);
+
+    const nlohmann::json json = nlohmann::json::parse(trace.str());
+    ASSERT_TRUE(json.contains("traceEvents"));
+
+    bool foundThreadName = false;
+    size_t zones = 0;
+    for (const auto& event : json["traceEvents"])
+    {
+        if (event["ph"] == "M" && event["args"]["name"] == "Test \"Main\"")
+            foundThreadName = true;
+        if (event["ph"] == "X")
+        {
+            ++zones;
+            EXPECT_TRUE(event["name"] == "Frame" || event["name"] == "Update");
+            EXPECT_GE(event["dur"].get<double>(), 0.0);
+            EXPECT_GE(event["ts"].get<double>(), 0.0);
+        }
+    }
+    EXPECT_TRUE(foundThreadName);
+    EXPECT_EQ(zones, 2u);
+}
+
+#else
+
+TEST(ProfilerTests, DisabledScopesRecordNothing)
+{
+    Profiler::Start();
+    {
+        PIL_PROFILE_SCOPE("CompiledOut");
+        PIL_PROFILE_FUNCTION();
+    }
+    Profiler::Stop();
+
+    EXPECT_TRUE(Profiler::Collect().empty());
+
+    std::stringstream trace;
+    Profiler::WriteChromeTrace(trace);
+    EXPECT_TRUE(nlohmann::json::parse(trace.str()).contains("traceEvents"));
+}
+
+#endif
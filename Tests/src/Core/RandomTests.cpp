@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 #include "Pillar/Utils/Random.h"
+#include "Pillar/Utils/RandomStream.h"
+#include "Pillar/Utils/ThreadPool.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using namespace Pillar::Random;
 
@@ -62,3 +67,142 @@ TEST(RandomTests, Direction2DIsUnitLength)
         EXPECT_NEAR(len, 1.0f, 1e-3f);
     }
 }
+
+// ============================================================================
+// RandomStream Tests
+// ============================================================================
+
+TEST(RandomStreamTests, SameSeedSameSequence)
+{
+    Pillar::RandomStream a(1234u);
+    Pillar::RandomStream b(1234u);
+
+    for (int i = 0; i < 20; ++i)
+        EXPECT_EQ(a.NextU32(), b.NextU32());
+}
+
+TEST(RandomStreamTests, DifferentSeedsDiffer)
+{
+    Pillar::RandomStream a(1u);
+    Pillar::RandomStream b(2u);
+
+    int equal = 0;
+    for (int i = 0; i < 20; ++i)
+        equal += (a.NextU32() == b.NextU32()) ? 1 : 0;
+    EXPECT_LT(equal, 20);
+}
+
+TEST(RandomStreamTests, Float01WithinRange)
+{
+    Pillar::RandomStream stream(7u);
+    for (int i = 0; i < 1000; ++i)
+    {
+        float v = stream.Float01();
+        EXPECT_GE(v, 0.0f);
+        EXPECT_LT(v, 1.0f);
+    }
+}
+
+TEST(RandomStreamTests, FillFloatWithinBoundsAndDeterministic)
+{
+    // 37 = several lane groups plus a partial one
+    std::vector<float> a(37), b(37);
+    Pillar::RandomStream(99u).FillFloat(a.data(), a.size(), -3.0f, 5.0f);
+    Pillar::RandomStream(99u).FillFloat(b.data(), b.size(), -3.0f, 5.0f);
+
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        EXPECT_GE(a[i], -3.0f);
+        EXPECT_LT(a[i], 5.0f);
+        EXPECT_FLOAT_EQ(a[i], b[i]);
+    }
+}
+
+TEST(RandomStreamTests, FillFloatMeanIsCentered)
+{
+    Pillar::RandomStream stream(2024u);
+    std::vector<float> values(10000);
+    stream.FillFloat01(values.data(), values.size());
+
+    double sum = 0.0;
+    for (float v : values)
+        sum += v;
+    EXPECT_NEAR(sum / values.size(), 0.5, 0.02);
+}
+
+TEST(RandomStreamTests, FillAnglesAndDirections)
+{
+    Pillar::RandomStream stream(5u);
+
+    std::vector<float> angles(20);
+    stream.FillAngles(angles.data(), angles.size());
+    for (float a : angles)
+    {
+        EXPECT_GE(a, 0.0f);
+        EXPECT_LT(a, glm::two_pi<float>());
+    }
+
+    std::vector<glm::vec2> dirs(20);
+    stream.FillDirections(dirs.data(), dirs.size());
+    for (const auto& d : dirs)
+        EXPECT_NEAR(glm::length(d), 1.0f, 1e-3f);
+}
+
+TEST(RandomStreamTests, DeriveSeedDependsOnBothInputs)
+{
+    using Pillar::RandomStream;
+    EXPECT_EQ(RandomStream::DeriveSeed(1u, 2u), RandomStream::DeriveSeed(1u, 2u));
+    EXPECT_NE(RandomStream::DeriveSeed(1u, 2u), RandomStream::DeriveSeed(1u, 3u));
+    EXPECT_NE(RandomStream::DeriveSeed(1u, 2u), RandomStream::DeriveSeed(2u, 2u));
+}
+
+TEST(RandomStreamTests, ThreadLocalStreamsAreIndependent)
+{
+    Pillar::RandomStream* mainStream = &Pillar::RandomStream::ThreadLocal();
+    Pillar::RandomStream* workerStream = nullptr;
+
+    std::thread worker([&]() { workerStream = &Pillar::RandomStream::ThreadLocal(); });
+    worker.join();
+
+    EXPECT_EQ(mainStream, &Pillar::RandomStream::ThreadLocal());
+    EXPECT_NE(mainStream, workerStream);
+}
+
+TEST(RandomStreamTests, ThreadLocalSeededFromWorkerIndex)
+{
+    using Pillar::RandomStream;
+    RandomStream::SetThreadSeedBase(1234u);
+
+    RandomStream expectedMain(RandomStream::DeriveSeed(1234u, 0u));
+    EXPECT_EQ(RandomStream::ThreadLocal().NextU32(), expectedMain.NextU32());
+
+    Pillar::ThreadPool pool(2);
+    for (int i = 0; i < 8; ++i)
+    {
+        // Reseed first so the draw does not depend on which worker ran earlier tasks
+        auto [index, value] = pool.Submit([]() {
+            RandomStream::SetThreadSeedBase(1234u);
+            return std::make_pair(Pillar::ThreadPool::GetCurrentWorkerIndex(), RandomStream::ThreadLocal().NextU32());
+        }).get();
+
+        EXPECT_GE(index, 1u);
+        EXPECT_LE(index, 2u);
+        RandomStream expected(RandomStream::DeriveSeed(1234u, index));
+        EXPECT_EQ(value, expected.NextU32());
+    }
+}
+
+TEST(RandomStreamTests, SetThreadSeedBaseReseedsExistingStreams)
+{
+    using Pillar::RandomStream;
+    RandomStream::SetThreadSeedBase(42u);
+    const uint32_t first = RandomStream::ThreadLocal().NextU32();
+    RandomStream::ThreadLocal().NextU32();
+
+    RandomStream::SetThreadSeedBase(42u);
+    EXPECT_EQ(RandomStream::ThreadLocal().NextU32(), first);
+
+    RandomStream::SetThreadSeedBase(43u);
+    RandomStream expected(RandomStream::DeriveSeed(43u, 0u));
+    EXPECT_EQ(RandomStream::ThreadLocal().NextU32(), expected.NextU32());
+}
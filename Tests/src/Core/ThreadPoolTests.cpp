@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+// ThreadPoolTests: task submission, ParallelFor coverage and nesting.
+#include "Pillar/Utils/ThreadPool.h"
+#include <atomic>
+#include <vector>
+
+using namespace Pillar;
+
+TEST(ThreadPoolTests, Submit_ReturnsResult)
+{
+    ThreadPool pool(2);
+    auto future = pool.Submit([]() { return 21 * 2; });
+    EXPECT_EQ(future.get(), 42);
+}
+
+TEST(ThreadPoolTests, ParallelFor_VisitsEveryIndexOnce)
+{
+    ThreadPool pool(4);
+    std::vector<int> visits(10007, 0);
+
+    pool.ParallelFor(visits.size(), 16, [&visits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            ++visits[i];
+    });
+
+    for (int v : visits)
+        EXPECT_EQ(v, 1);
+}
+
+TEST(ThreadPoolTests, ParallelFor_SmallRangeRunsInline)
+{
+    ThreadPool pool(4);
+    int calls = 0;
+
+    pool.ParallelFor(10, 64, [&calls](size_t begin, size_t end) {
+        ++calls;
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 10u);
+    });
+
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ThreadPoolTests, ParallelFor_NestedDoesNotDeadlock)
+{
+    ThreadPool pool(2);
+    std::atomic<int> total{ 0 };
+
+    pool.ParallelFor(8, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            pool.ParallelFor(100, 1, [&total](size_t b, size_t e) {
+                total += static_cast<int>(e - b);
+            });
+        }
+    });
+
+    EXPECT_EQ(total.load(), 800);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 // ComponentRegistryTests: ensures component registration, (de)serialization
-// callbacks, copying and registry inspection for built-in and custom types.
+// callbacks, copying, the id-indexed registration table and bulk per-type
+// operations for built-in and custom types.
 #include "Pillar/ECS/ComponentRegistry.h"
 #include "Pillar/ECS/Scene.h"
 #include "Pillar/ECS/Entity.h"
@@ -8,6 +9,8 @@
 #include "Pillar/ECS/Components/Core/TagComponent.h"
 #include "Pillar/ECS/Components/Physics/VelocityComponent.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <vector>
 
 using namespace Pillar;
 using json = nlohmann::json;
@@ -220,3 +223,76 @@ TEST_F(ComponentRegistryTests, CopyFunction_CopiesComponent)
 	EXPECT_FLOAT_EQ(dstTransform.Scale.x, 5.0f);
 	EXPECT_FLOAT_EQ(dstTransform.Scale.y, 5.0f);
 }
+
+TEST_F(ComponentRegistryTests, RegistrationTable_IsDenseAndIndexedById)
+{
+	auto& registry = ComponentRegistry::Get();
+	const auto& table = registry.GetRegistrationTable();
+
+	EXPECT_EQ(table.size(), registry.GetRegistrationCount());
+	for (size_t i = 0; i < table.size(); ++i)
+	{
+		ASSERT_NE(table[i], nullptr);
+		EXPECT_EQ(table[i]->Id, i);
+		EXPECT_EQ(registry.GetRegistrationById(static_cast<uint32_t>(i)), table[i]);
+		EXPECT_EQ(registry.GetRegistration(table[i]->Name), table[i]);
+	}
+	EXPECT_EQ(registry.GetRegistrationById(static_cast<uint32_t>(table.size())), nullptr);
+}
+
+TEST_F(ComponentRegistryTests, Has_ChecksTypedStorage)
+{
+	Scene scene;
+	Entity moving = scene.CreateEntity("Moving");
+	Entity still = scene.CreateEntity("Still");
+	moving.AddComponent<VelocityComponent>();
+
+	const ComponentRegistration* reg = ComponentRegistry::Get().GetRegistration("velocity");
+	ASSERT_NE(reg, nullptr);
+	EXPECT_TRUE(reg->Has(scene.GetRegistry(), moving));
+	EXPECT_FALSE(reg->Has(scene.GetRegistry(), still));
+}
+
+TEST_F(ComponentRegistryTests, CopyAllComponents_CopiesOnlyPresentComponents)
+{
+	Scene src;
+	Entity moving = src.CreateEntity("Moving");
+	moving.AddComponent<VelocityComponent>(glm::vec2(3.0f, 4.0f));
+	moving.GetComponent<TransformComponent>().Position = glm::vec2(1.0f, 2.0f);
+	Entity still = src.CreateEntity("Still");
+
+	Scene dst;
+	Entity movingCopy = dst.CreateEntity("Moving");
+	Entity stillCopy = dst.CreateEntity("Still");
+
+	std::vector<entt::entity> entityMap(std::max(entt::to_entity(moving), entt::to_entity(still)) + 1, entt::null);
+	entityMap[entt::to_entity(moving)] = movingCopy;
+	entityMap[entt::to_entity(still)] = stillCopy;
+
+	ComponentRegistry::Get().CopyAllComponents(src, dst, entityMap);
+
+	ASSERT_TRUE(movingCopy.HasComponent<VelocityComponent>());
+	EXPECT_FLOAT_EQ(movingCopy.GetComponent<VelocityComponent>().Velocity.y, 4.0f);
+	EXPECT_FLOAT_EQ(movingCopy.GetComponent<TransformComponent>().Position.x, 1.0f);
+	EXPECT_FALSE(stillCopy.HasComponent<VelocityComponent>());
+}
+
+TEST_F(ComponentRegistryTests, SerializeAllComponents_FillsEntityObjects)
+{
+	Scene scene;
+	Entity moving = scene.CreateEntity("Moving");
+	moving.AddComponent<VelocityComponent>(glm::vec2(3.0f, 4.0f));
+	Entity still = scene.CreateEntity("Still");
+
+	std::vector<uint32_t> entityIndex(std::max(entt::to_entity(moving), entt::to_entity(still)) + 1, UINT32_MAX);
+	entityIndex[entt::to_entity(moving)] = 0;
+	entityIndex[entt::to_entity(still)] = 1;
+	std::vector<json> entities(2, json::object());
+
+	ComponentRegistry::Get().SerializeAllComponents(scene, entityIndex, entities);
+
+	EXPECT_TRUE(entities[0].contains("velocity"));
+	EXPECT_TRUE(entities[0].contains("transform"));
+	EXPECT_FALSE(entities[1].contains("velocity"));
+	EXPECT_TRUE(entities[1].contains("transform"));
+}
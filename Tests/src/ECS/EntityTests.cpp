@@ -5,6 +5,7 @@
 #include "Pillar/ECS/Entity.h"
 #include "Pillar/ECS/Components/Core/TagComponent.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include <type_traits>
 
 using namespace Pillar;
 
@@ -198,6 +199,8 @@ TEST(EntityTests, NameAndUUIDConvenienceAccessors)
 	Scene scene;
 	Entity entity = scene.CreateEntity("Player");
 
+	// Renames must go through SetName so Scene's name index stays in sync
+	static_assert(std::is_same_v<decltype(entity.Name()), const std::string&>);
 	EXPECT_TRUE(entity.HasComponent<TagComponent>());
 	EXPECT_EQ(entity.Name(), "Player");
 	entity.SetName("Hero");
@@ -93,6 +93,36 @@ TEST_F(ObjectPoolTests, Acquire_ExhaustsPool_CreatesNew)
 	EXPECT_EQ(pool.GetActiveCount(), 3);
 }
 
+TEST_F(ObjectPoolTests, AcquireBatch_TakesFromPool)
+{
+	ObjectPool pool;
+	pool.Init(m_Scene.get(), 10);
+
+	std::vector<Entity> entities;
+	pool.AcquireBatch(6, entities);
+
+	EXPECT_EQ(entities.size(), 6);
+	EXPECT_EQ(pool.GetAvailableCount(), 4);
+	EXPECT_EQ(pool.GetActiveCount(), 6);
+	EXPECT_EQ(pool.GetTotalCount(), 10);
+}
+
+TEST_F(ObjectPoolTests, AcquireBatch_ExhaustsPool_CreatesRemainder)
+{
+	ObjectPool pool;
+	pool.Init(m_Scene.get(), 3);
+
+	std::vector<Entity> entities;
+	pool.AcquireBatch(5, entities);
+
+	EXPECT_EQ(entities.size(), 5);
+	for (const auto& entity : entities)
+		EXPECT_TRUE(entity);
+	EXPECT_EQ(pool.GetAvailableCount(), 0);
+	EXPECT_EQ(pool.GetTotalCount(), 5);
+	EXPECT_EQ(pool.GetActiveCount(), 5);
+}
+
 TEST_F(ObjectPoolTests, Release_ReturnsEntityToPool)
 {
 	ObjectPool pool;
@@ -1,7 +1,8 @@
 #include <gtest/gtest.h>
 // SceneSerializerTests: tests serialization and deserialization of scenes,
-// components and SceneManager behaviors including round-trips and UUID
-// preservation.
+// components and SceneManager behaviors (including async loads), covering
+// round-trips, UUID preservation, the streaming JSON loader and the chunked
+// binary format.
 #include "Pillar/ECS/Scene.h"
 #include "Pillar/ECS/Entity.h"
 #include "Pillar/ECS/SceneManager.h"
@@ -9,9 +10,20 @@
 #include "Pillar/ECS/Components/Core/TagComponent.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
 #include "Pillar/ECS/Components/Core/UUIDComponent.h"
+#include "Pillar/ECS/Components/Core/HierarchyComponent.h"
 #include "Pillar/ECS/Components/Physics/VelocityComponent.h"
+#include "Pillar/ECS/Components/Physics/RigidbodyComponent.h"
+#include "Pillar/ECS/Components/Physics/ColliderComponent.h"
+#include "Pillar/ECS/Components/Rendering/SpriteComponent.h"
 #include "Pillar/ECS/Components/Gameplay/XPGemComponent.h"
+#include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
 
 using namespace Pillar;
 
@@ -198,6 +210,324 @@ TEST_F(SceneSerializerTests, Serialize_XPGemComponent)
     EXPECT_FLOAT_EQ(gem.MoveSpeed, 12.0f);
 }
 
+// ========================================
+// Streaming JSON Loader Tests
+// ========================================
+
+TEST_F(SceneSerializerTests, Streaming_MatchesDomLoader)
+{
+    uint64_t parentUUID = 0;
+    {
+        Scene scene("StreamScene");
+        scene.SetRandomSeed(99);
+        auto parent = scene.CreateEntity("Parent");
+        parentUUID = parent.GetUUID();
+        for (int i = 0; i < 50; ++i)
+        {
+            auto entity = scene.CreateEntity("Gem");
+            entity.GetComponent<TransformComponent>().Position = glm::vec2(static_cast<float>(i), 1.0f);
+            entity.AddComponent<XPGemComponent>(i);
+            entity.AddComponent<HierarchyComponent>(parentUUID);
+        }
+
+        SceneSerializer serializer(&scene);
+        ASSERT_TRUE(serializer.Serialize(m_TestFilePath.string()));
+    }
+
+    Scene domScene;
+    SceneSerializer domSerializer(&domScene);
+    ASSERT_TRUE(domSerializer.Deserialize(m_TestFilePath.string()));
+
+    Scene streamScene;
+    SceneSerializer streamSerializer(&streamScene);
+    ASSERT_TRUE(streamSerializer.DeserializeStreaming(m_TestFilePath.string()));
+
+    EXPECT_EQ(streamScene.GetName(), "StreamScene");
+    EXPECT_EQ(streamScene.GetRandomSeed(), 99u);
+    EXPECT_EQ(streamScene.GetEntityCount(), domScene.GetEntityCount());
+    EXPECT_EQ(streamSerializer.SerializeToString(), domSerializer.SerializeToString());
+    EXPECT_TRUE(streamScene.FindEntityByUUID(parentUUID));
+}
+
+TEST_F(SceneSerializerTests, Streaming_ReportsProgressToCompletion)
+{
+    {
+        Scene scene("ProgressScene");
+        for (int i = 0; i < 10000; ++i)
+            scene.CreateEntity("Entity");
+        SceneSerializer serializer(&scene);
+        ASSERT_TRUE(serializer.Serialize(m_TestFilePath.string()));
+    }
+
+    std::vector<SceneLoadProgress> reports;
+    Scene loadedScene;
+    SceneSerializer serializer(&loadedScene);
+    ASSERT_TRUE(serializer.DeserializeStreaming(m_TestFilePath.string(),
+        [&](const SceneLoadProgress& progress) { reports.push_back(progress); }));
+
+    ASSERT_GE(reports.size(), 2u);
+    for (size_t i = 1; i < reports.size(); ++i)
+    {
+        EXPECT_GE(reports[i].BytesRead, reports[i - 1].BytesRead);
+        EXPECT_GE(reports[i].EntitiesLoaded, reports[i - 1].EntitiesLoaded);
+    }
+    EXPECT_FLOAT_EQ(reports.back().GetFraction(), 1.0f);
+    EXPECT_EQ(reports.back().EntitiesLoaded, 10000u);
+    EXPECT_EQ(loadedScene.GetEntityCount(), 10000u);
+}
+
+TEST_F(SceneSerializerTests, Serialize_WritesSceneBeforeEntities)
+{
+    Scene scene("Ordered");
+    scene.CreateEntity("Entity");
+    SceneSerializer serializer(&scene);
+    ASSERT_TRUE(serializer.Serialize(m_TestFilePath.string()));
+
+    std::ifstream file(m_TestFilePath);
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::string version = "unset";
+    std::istringstream stream(text);
+    ASSERT_TRUE(SceneStreamLoader::ReadFileVersion(stream, version));
+    EXPECT_EQ(version, SceneSerializer::GetCurrentVersion());
+    EXPECT_LT(text.find("\"scene\""), text.find("\"entities\""));
+}
+
+TEST_F(SceneSerializerTests, Streaming_MigratesOldFilesBeforeBuildingEntities)
+{
+    {
+        // Older writers let nlohmann sort the keys, so "entities" precedes "scene"
+        std::ofstream file(m_TestFilePath);
+        file << R"({ "entities": [ { "tag": "Old", "uuid": 7 }, { "tag": "Old", "uuid": 8 } ],
+                    "scene": { "name": "Legacy", "version": "0.9.0" } })";
+    }
+
+    int migrations = 0;
+    SceneSerializer::SetMigrationCallback([&](nlohmann::json& root, const std::string& fileVersion, const std::string&) {
+        ++migrations;
+        EXPECT_EQ(fileVersion, "0.9.0");
+        for (auto& entity : root["entities"])
+            entity["tag"] = "Migrated";
+    });
+
+    Scene loadedScene;
+    SceneSerializer serializer(&loadedScene);
+    const bool loaded = serializer.DeserializeStreaming(m_TestFilePath.string());
+    SceneSerializer::SetMigrationCallback(nullptr);
+
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(migrations, 1);
+    EXPECT_EQ(loadedScene.GetEntityCount(), 2u);
+    Entity entity = loadedScene.FindEntityByUUID(7);
+    ASSERT_TRUE(entity);
+    EXPECT_EQ(entity.GetComponent<TagComponent>().Tag, "Migrated");
+    // Clearing a registry bumps entity versions, so version 0 means nothing was built before the migration
+    EXPECT_EQ(entt::to_version(static_cast<entt::entity>(entity)), 0u);
+}
+
+TEST_F(SceneSerializerTests, Streaming_RejectsMalformedJson)
+{
+    {
+        std::ofstream file(m_TestFilePath);
+        file << R"({ "entities": [ { "tag": "A" }, { "tag": )";
+    }
+
+    Scene loadedScene;
+    loadedScene.CreateEntity("Existing");
+    SceneSerializer serializer(&loadedScene);
+    EXPECT_FALSE(serializer.DeserializeStreaming(m_TestFilePath.string()));
+    EXPECT_EQ(loadedScene.GetEntityCount(), 0u);
+}
+
+// ========================================
+// Chunked Binary Format Tests
+// ========================================
+
+TEST_F(SceneSerializerTests, Chunked_RoundTripsNativeChunks)
+{
+    std::vector<uint8_t> data;
+    uint64_t parentUUID = 0;
+    {
+        Scene scene("ChunkedScene");
+        scene.SetRandomSeed(1234);
+        auto parent = scene.CreateEntity("Parent");
+        parent.GetComponent<TransformComponent>().Position = glm::vec2(1.0f, 2.0f);
+        parentUUID = parent.GetUUID();
+
+        auto child = scene.CreateEntity("Child");
+        auto& transform = child.GetComponent<TransformComponent>();
+        transform.Position = glm::vec2(-3.0f, 4.5f);
+        transform.Rotation = 0.75f;
+        transform.Scale = glm::vec2(2.0f, 0.5f);
+        child.AddComponent<HierarchyComponent>(parentUUID);
+        auto& vel = child.AddComponent<VelocityComponent>(glm::vec2(6.0f, -7.0f));
+        vel.Drag = 0.25f;
+        vel.MaxSpeed = 40.0f;
+
+        SceneSerializer serializer(&scene);
+        data = serializer.SerializeChunkedToBuffer();
+    }
+
+    Scene loadedScene;
+    SceneSerializer serializer(&loadedScene);
+    ASSERT_TRUE(serializer.DeserializeChunkedFromMemory(data.data(), data.size()));
+
+    EXPECT_EQ(loadedScene.GetName(), "ChunkedScene");
+    EXPECT_EQ(loadedScene.GetRandomSeed(), 1234u);
+    EXPECT_EQ(loadedScene.GetEntityCount(), 2u);
+    EXPECT_TRUE(loadedScene.FindEntityByUUID(parentUUID));
+
+    auto child = loadedScene.FindEntityByName("Child");
+    ASSERT_TRUE(child);
+    const auto& transform = child.GetComponent<TransformComponent>();
+    EXPECT_FLOAT_EQ(transform.Position.x, -3.0f);
+    EXPECT_FLOAT_EQ(transform.Position.y, 4.5f);
+    EXPECT_FLOAT_EQ(transform.Rotation, 0.75f);
+    EXPECT_FLOAT_EQ(transform.Scale.x, 2.0f);
+    EXPECT_FLOAT_EQ(transform.Scale.y, 0.5f);
+    ASSERT_TRUE(child.HasComponent<HierarchyComponent>());
+    EXPECT_EQ(child.GetComponent<HierarchyComponent>().ParentUUID, parentUUID);
+    ASSERT_TRUE(child.HasComponent<VelocityComponent>());
+    const auto& vel = child.GetComponent<VelocityComponent>();
+    EXPECT_FLOAT_EQ(vel.Velocity.x, 6.0f);
+    EXPECT_FLOAT_EQ(vel.Velocity.y, -7.0f);
+    EXPECT_FLOAT_EQ(vel.Drag, 0.25f);
+    EXPECT_FLOAT_EQ(vel.MaxSpeed, 40.0f);
+
+    auto parent = loadedScene.FindEntityByName("Parent");
+    ASSERT_TRUE(parent);
+    EXPECT_FALSE(parent.HasComponent<VelocityComponent>());
+    EXPECT_FLOAT_EQ(parent.GetComponent<TransformComponent>().Position.y, 2.0f);
+}
+
+TEST_F(SceneSerializerTests, Chunked_RoundTripsSpriteAndPhysicsChunks)
+{
+    std::vector<uint8_t> data;
+    {
+        Scene scene("PhysicsScene");
+        auto entity = scene.CreateEntity("Body");
+
+        // No texture path, so loading does not go through the AssetManager
+        auto& sprite = entity.AddComponent<SpriteComponent>(glm::vec4(0.25f, 0.5f, 0.75f, 1.0f));
+        sprite.Size = glm::vec2(2.0f, 3.0f);
+        sprite.TexCoordMax = glm::vec2(0.5f, 0.25f);
+        sprite.ZIndex = 4.0f;
+        sprite.FlipX = true;
+        sprite.Visible = false;
+        sprite.Layer = "Player";
+        sprite.OrderInLayer = -3;
+
+        auto& rb = entity.AddComponent<RigidbodyComponent>(b2_kinematicBody);
+        rb.FixedRotation = true;
+        rb.GravityScale = 0.5f;
+        rb.LinearDamping = 0.1f;
+
+        auto& collider = entity.AddComponent<ColliderComponent>(ColliderComponent::Box(glm::vec2(1.5f, 0.75f)));
+        collider.Offset = glm::vec2(0.25f, -0.5f);
+        collider.CategoryBits = 0x0004;
+        collider.IsSensor = true;
+
+        auto triangle = scene.CreateEntity("Triangle");
+        triangle.AddComponent<ColliderComponent>(ColliderComponent::RegularPolygon(3, 1.0f));
+
+        SceneSerializer serializer(&scene);
+        data = serializer.SerializeChunkedToBuffer();
+    }
+
+    Scene loadedScene;
+    SceneSerializer serializer(&loadedScene);
+    ASSERT_TRUE(serializer.DeserializeChunkedFromMemory(data.data(), data.size()));
+
+    auto entity = loadedScene.FindEntityByName("Body");
+    ASSERT_TRUE(entity);
+    ASSERT_TRUE(entity.HasComponent<SpriteComponent>());
+    const auto& sprite = entity.GetComponent<SpriteComponent>();
+    EXPECT_EQ(sprite.Color, glm::vec4(0.25f, 0.5f, 0.75f, 1.0f));
+    EXPECT_EQ(sprite.Size, glm::vec2(2.0f, 3.0f));
+    EXPECT_EQ(sprite.TexCoordMax, glm::vec2(0.5f, 0.25f));
+    EXPECT_FLOAT_EQ(sprite.ZIndex, 4.0f);
+    EXPECT_TRUE(sprite.FlipX);
+    EXPECT_FALSE(sprite.FlipY);
+    EXPECT_FALSE(sprite.Visible);
+    EXPECT_EQ(sprite.Layer, "Player");
+    EXPECT_EQ(sprite.OrderInLayer, -3);
+    EXPECT_TRUE(sprite.TexturePath.empty());
+
+    ASSERT_TRUE(entity.HasComponent<RigidbodyComponent>());
+    const auto& rb = entity.GetComponent<RigidbodyComponent>();
+    EXPECT_EQ(rb.BodyType, b2_kinematicBody);
+    EXPECT_TRUE(rb.FixedRotation);
+    EXPECT_TRUE(rb.IsEnabled);
+    EXPECT_FLOAT_EQ(rb.GravityScale, 0.5f);
+    EXPECT_FLOAT_EQ(rb.LinearDamping, 0.1f);
+    EXPECT_EQ(rb.Body, nullptr);
+
+    ASSERT_TRUE(entity.HasComponent<ColliderComponent>());
+    const auto& collider = entity.GetComponent<ColliderComponent>();
+    EXPECT_EQ(collider.Type, ColliderType::Box);
+    EXPECT_EQ(collider.HalfExtents, glm::vec2(1.5f, 0.75f));
+    EXPECT_EQ(collider.Offset, glm::vec2(0.25f, -0.5f));
+    EXPECT_EQ(collider.CategoryBits, 0x0004);
+    EXPECT_TRUE(collider.IsSensor);
+
+    auto triangle = loadedScene.FindEntityByName("Triangle");
+    ASSERT_TRUE(triangle);
+    EXPECT_FALSE(triangle.HasComponent<SpriteComponent>());
+    const auto& polygon = triangle.GetComponent<ColliderComponent>();
+    EXPECT_EQ(polygon.Type, ColliderType::Polygon);
+    ASSERT_EQ(polygon.Vertices.size(), 3u);
+    EXPECT_FLOAT_EQ(polygon.Vertices[0].x, 1.0f);
+}
+
+TEST_F(SceneSerializerTests, Chunked_FileRoundTripsRegistryComponents)
+{
+    auto chunkedPath = std::filesystem::temp_directory_path() / "pillar_test_scene.pscene";
+    {
+        Scene scene("GemScene");
+        auto entity = scene.CreateEntity("Gem");
+        auto& gem = entity.AddComponent<XPGemComponent>(25);
+        gem.AttractionRadius = 5.0f;
+
+        SceneSerializer serializer(&scene);
+        ASSERT_TRUE(serializer.SerializeChunked(chunkedPath.string()));
+    }
+
+    Scene loadedScene;
+    SceneSerializer serializer(&loadedScene);
+    ASSERT_TRUE(serializer.DeserializeChunked(chunkedPath.string()));
+    std::filesystem::remove(chunkedPath);
+
+    // XPGemComponent has no native chunk and goes through its registry entry
+    auto entity = loadedScene.FindEntityByName("Gem");
+    ASSERT_TRUE(entity);
+    ASSERT_TRUE(entity.HasComponent<XPGemComponent>());
+    EXPECT_EQ(entity.GetComponent<XPGemComponent>().XPValue, 25);
+    EXPECT_FLOAT_EQ(entity.GetComponent<XPGemComponent>().AttractionRadius, 5.0f);
+}
+
+TEST_F(SceneSerializerTests, Chunked_RejectsCorruptData)
+{
+    Scene scene("Source");
+    for (int i = 0; i < 8; ++i)
+        scene.CreateEntity("Entity");
+
+    SceneSerializer serializer(&scene);
+    std::vector<uint8_t> data = serializer.SerializeChunkedToBuffer();
+
+    Scene loadedScene;
+    SceneSerializer loader(&loadedScene);
+
+    std::vector<uint8_t> truncated(data.begin(), data.begin() + data.size() / 2);
+    EXPECT_FALSE(loader.DeserializeChunkedFromMemory(truncated.data(), truncated.size()));
+    EXPECT_EQ(loadedScene.GetEntityCount(), 0u);
+
+    std::vector<uint8_t> badMagic = data;
+    badMagic[0] ^= 0xFF;
+    EXPECT_FALSE(loader.DeserializeChunkedFromMemory(badMagic.data(), badMagic.size()));
+
+    EXPECT_TRUE(loader.DeserializeChunkedFromMemory(data.data(), data.size()));
+    EXPECT_EQ(loadedScene.GetEntityCount(), 8u);
+}
+
 // ========================================
 // Scene Manager Tests
 // ========================================
@@ -474,3 +804,68 @@ TEST(EnhancedSceneTests, CreateEntityWithUUID_PreservesUUID)
 
     EXPECT_EQ(entity.GetUUID(), specificUUID);
 }
+
+TEST_F(SceneManagerTests, LoadSceneAsync_SwapsAtSceneChangePoint)
+{
+    auto scenePath = std::filesystem::temp_directory_path() / "pillar_test_async_scene.json";
+    {
+        Scene scene("AsyncSource");
+        for (int i = 0; i < 100; ++i)
+            scene.CreateEntity("Entity" + std::to_string(i));
+        SceneSerializer serializer(&scene);
+        ASSERT_TRUE(serializer.Serialize(scenePath.string()));
+    }
+
+    auto& manager = SceneManager::Get();
+    manager.CreateScene("Menu");
+    manager.SetActiveScene("Menu");
+
+    std::vector<AsyncSceneLoadProgress> reports;
+    manager.LoadSceneAsync(scenePath.string(), "Level", [&](const AsyncSceneLoadProgress& progress) {
+        reports.push_back(progress);
+    });
+    EXPECT_TRUE(manager.IsLoading());
+    EXPECT_EQ(manager.GetActiveSceneName(), "Menu");
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (manager.IsLoading() && std::chrono::steady_clock::now() < deadline)
+    {
+        manager.OnUpdate(0.016f);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::filesystem::remove(scenePath);
+
+    ASSERT_FALSE(manager.IsLoading());
+    EXPECT_EQ(manager.GetActiveSceneName(), "Level");
+    EXPECT_EQ(manager.GetActiveScene()->GetEntityCount(), 100u);
+    EXPECT_TRUE(manager.GetActiveScene()->FindEntityByName("Entity42"));
+
+    ASSERT_FALSE(reports.empty());
+    for (size_t i = 1; i < reports.size(); ++i)
+        EXPECT_GE(reports[i].Progress, reports[i - 1].Progress);
+    EXPECT_EQ(reports.back().Stage, AsyncSceneLoadStage::Complete);
+    EXPECT_FLOAT_EQ(reports.back().Progress, 1.0f);
+}
+
+TEST_F(SceneManagerTests, LoadSceneAsync_MissingFileFails)
+{
+    auto& manager = SceneManager::Get();
+    manager.CreateScene("Menu");
+
+    AsyncSceneLoadStage lastStage = AsyncSceneLoadStage::Parsing;
+    manager.LoadSceneAsync("definitely/not/a/scene.json", "Broken", [&](const AsyncSceneLoadProgress& progress) {
+        lastStage = progress.Stage;
+    });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (manager.IsLoading() && std::chrono::steady_clock::now() < deadline)
+    {
+        manager.OnUpdate(0.016f);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_FALSE(manager.IsLoading());
+    EXPECT_EQ(lastStage, AsyncSceneLoadStage::Failed);
+    EXPECT_FALSE(manager.HasScene("Broken"));
+    EXPECT_EQ(manager.GetActiveSceneName(), "Menu");
+}
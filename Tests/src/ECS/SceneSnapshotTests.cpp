@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+// SceneSnapshotTests: storage-level Capture/Restore used for play mode, and
+// Scene::Copy which shares the same copy path.
+#include "Pillar/ECS/Scene.h"
+#include "Pillar/ECS/Entity.h"
+#include "Pillar/ECS/SceneSnapshot.h"
+#include "Pillar/ECS/Components/Core/TagComponent.h"
+#include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Core/UUIDComponent.h"
+#include "Pillar/ECS/Components/Physics/RigidbodyComponent.h"
+#include "Pillar/ECS/Components/Physics/VelocityComponent.h"
+
+using namespace Pillar;
+
+namespace {
+	// Not registered with ComponentRegistry; Entity::AddComponent records its storage for snapshots
+	struct ScoreComponent
+	{
+		int Value = 0;
+	};
+}
+
+TEST(SceneSnapshotTests, Restore_PreservesEntityIdsAndUUIDs)
+{
+	Scene scene("Level");
+	Entity a = scene.CreateEntity("A");
+	Entity b = scene.CreateEntity("B");
+	const entt::entity idA = a;
+	const entt::entity idB = b;
+	const uint64_t uuidA = a.GetUUID();
+	const uint64_t uuidB = b.GetUUID();
+
+	SceneSnapshot snapshot;
+	snapshot.Capture(scene);
+	EXPECT_EQ(snapshot.GetEntityCount(), 2u);
+
+	scene.DestroyEntity(a);
+	scene.CreateEntity("Spawned");
+	snapshot.Restore(scene);
+
+	EXPECT_EQ(scene.GetEntityCount(), 2u);
+	Entity restoredA = scene.FindEntityByUUID(uuidA);
+	Entity restoredB = scene.FindEntityByUUID(uuidB);
+	ASSERT_TRUE(restoredA);
+	ASSERT_TRUE(restoredB);
+	EXPECT_EQ(static_cast<entt::entity>(restoredA), idA);
+	EXPECT_EQ(static_cast<entt::entity>(restoredB), idB);
+	EXPECT_EQ(scene.FindEntityByName("A"), restoredA);
+	EXPECT_FALSE(scene.FindEntityByName("Spawned"));
+}
+
+TEST(SceneSnapshotTests, Restore_UndoesComponentChanges)
+{
+	Scene scene;
+	Entity entity = scene.CreateEntity("Player");
+	entity.GetComponent<TransformComponent>().Position = { 1.0f, 2.0f };
+	entity.AddComponent<ScoreComponent>().Value = 5;
+
+	SceneSnapshot snapshot;
+	snapshot.Capture(scene);
+
+	entity.GetComponent<TransformComponent>().Position = { 50.0f, 60.0f };
+	entity.GetComponent<ScoreComponent>().Value = 99;
+	entity.AddComponent<VelocityComponent>();
+	snapshot.Restore(scene);
+
+	Entity restored = scene.FindEntityByName("Player");
+	ASSERT_TRUE(restored);
+	EXPECT_FLOAT_EQ(restored.GetComponent<TransformComponent>().Position.x, 1.0f);
+	EXPECT_FLOAT_EQ(restored.GetComponent<TransformComponent>().Position.y, 2.0f);
+	EXPECT_EQ(restored.GetComponent<ScoreComponent>().Value, 5);
+	EXPECT_FALSE(restored.HasComponent<VelocityComponent>());
+}
+
+TEST(SceneSnapshotTests, Capture_CopiesRigidbodyWithoutBody)
+{
+	Scene scene;
+	Entity entity = scene.CreateEntity("Crate");
+	auto& rigidbody = entity.AddComponent<RigidbodyComponent>(b2_kinematicBody);
+	rigidbody.GravityScale = 0.5f;
+	rigidbody.IsBullet = true;
+
+	SceneSnapshot snapshot;
+	snapshot.Capture(scene);
+	entity.RemoveComponent<RigidbodyComponent>();
+	snapshot.Restore(scene);
+
+	Entity restored = scene.FindEntityByName("Crate");
+	ASSERT_TRUE(restored.HasComponent<RigidbodyComponent>());
+	const auto& restoredBody = restored.GetComponent<RigidbodyComponent>();
+	EXPECT_EQ(restoredBody.Body, nullptr);
+	EXPECT_EQ(restoredBody.BodyType, b2_kinematicBody);
+	EXPECT_FLOAT_EQ(restoredBody.GravityScale, 0.5f);
+	EXPECT_TRUE(restoredBody.IsBullet);
+}
+
+TEST(SceneSnapshotTests, Capture_SkipsRemovedRigidbodies)
+{
+	Scene scene;
+	Entity removed = scene.CreateEntity("Removed");
+	removed.AddComponent<RigidbodyComponent>(b2_dynamicBody);
+	Entity kept = scene.CreateEntity("Kept");
+	kept.AddComponent<RigidbodyComponent>(b2_staticBody);
+
+	// In-place deletion leaves a tombstone in the rigidbody storage
+	removed.RemoveComponent<RigidbodyComponent>();
+
+	SceneSnapshot snapshot;
+	snapshot.Capture(scene);
+	snapshot.Restore(scene);
+
+	EXPECT_FALSE(scene.FindEntityByName("Removed").HasComponent<RigidbodyComponent>());
+	ASSERT_TRUE(scene.FindEntityByName("Kept").HasComponent<RigidbodyComponent>());
+	EXPECT_EQ(scene.FindEntityByName("Kept").GetComponent<RigidbodyComponent>().BodyType, b2_staticBody);
+}
+
+TEST(SceneSnapshotTests, SceneCopy_KeepsEntityIds)
+{
+	auto original = std::make_shared<Scene>("Original");
+	original->SetRandomSeed(42);
+	Entity first = original->CreateEntity("First");
+	Entity second = original->CreateEntity("Second");
+	original->DestroyEntity(first);
+	Entity third = original->CreateEntity("Third");
+
+	auto copy = Scene::Copy(original);
+
+	EXPECT_EQ(copy->GetRandomSeed(), 42u);
+	EXPECT_EQ(copy->GetEntityCount(), 2u);
+	EXPECT_EQ(static_cast<entt::entity>(copy->FindEntityByName("Second")), static_cast<entt::entity>(second));
+	EXPECT_EQ(static_cast<entt::entity>(copy->FindEntityByName("Third")), static_cast<entt::entity>(third));
+	EXPECT_EQ(copy->FindEntityByUUID(third.GetUUID()).GetComponent<TagComponent>().Tag, "Third");
+}
@@ -2,7 +2,7 @@
 #include <algorithm>
 #include <vector>
 // SceneTests: basic Scene API tests covering entity creation/destruction,
-// UUID uniqueness and default component values.
+// UUID uniqueness, default component values and the UUID/name lookup indices.
 #include "Pillar/ECS/Scene.h"
 #include "Pillar/ECS/Entity.h"
 #include "Pillar/ECS/Components/Core/TagComponent.h"
@@ -167,3 +167,89 @@ TEST(SceneTests, ForEach_ProvidesComponentsAndEntity)
 	EXPECT_EQ(entity.Name(), "Renamed");
 	EXPECT_EQ(entity.GetComponent<DummyComponent>().Value, 99);
 }
+
+// ========================================
+// Lookup Index Tests
+// ========================================
+
+TEST(SceneTests, FindEntityByUUID_ForgetsDestroyedEntity)
+{
+	Scene scene;
+	Entity entity = scene.CreateEntityWithUUID(42, "Indexed");
+	EXPECT_EQ(scene.FindEntityByUUID(42), entity);
+
+	scene.DestroyEntity(entity);
+	EXPECT_FALSE(scene.FindEntityByUUID(42));
+}
+
+TEST(SceneTests, FindEntityByUUID_FollowsReplacedUUID)
+{
+	Scene scene;
+	Entity entity = scene.CreateEntityWithUUID(7, "Indexed");
+
+	entity.AddOrReplaceComponent<UUIDComponent>(uint64_t(8));
+
+	EXPECT_FALSE(scene.FindEntityByUUID(7));
+	EXPECT_EQ(scene.FindEntityByUUID(8), entity);
+}
+
+TEST(SceneTests, FindEntityByName_FollowsSetName)
+{
+	Scene scene;
+	Entity entity = scene.CreateEntity("Before");
+
+	entity.SetName("After");
+
+	EXPECT_FALSE(scene.FindEntityByName("Before"));
+	EXPECT_EQ(scene.FindEntityByName("After"), entity);
+}
+
+TEST(SceneTests, FindEntityByName_DuplicateNamesSurviveDestroy)
+{
+	Scene scene;
+	Entity first = scene.CreateEntity("Enemy");
+	Entity second = scene.CreateEntity("Enemy");
+	Entity third = scene.CreateEntity("Enemy");
+
+	scene.DestroyEntity(first);
+	Entity found = scene.FindEntityByName("Enemy");
+	EXPECT_TRUE(found == second || found == third);
+
+	scene.DestroyEntity(second);
+	EXPECT_EQ(scene.FindEntityByName("Enemy"), third);
+
+	scene.DestroyEntity(third);
+	EXPECT_FALSE(scene.FindEntityByName("Enemy"));
+}
+
+TEST(SceneTests, GetEntityCount_TracksCreateAndDestroy)
+{
+	Scene scene;
+	std::vector<Entity> entities;
+	for (int i = 0; i < 10; ++i)
+		entities.push_back(scene.CreateEntity());
+	EXPECT_EQ(scene.GetEntityCount(), 10u);
+
+	scene.DestroyEntity(entities[3]);
+	scene.DestroyEntity(entities[7]);
+	EXPECT_EQ(scene.GetEntityCount(), 8u);
+
+	scene.CreateEntity(); // Recycles a destroyed slot
+	EXPECT_EQ(scene.GetEntityCount(), 9u);
+}
+
+TEST(SceneTests, GetAllEntities_ReusesOutputBuffer)
+{
+	Scene scene;
+	for (int i = 0; i < 16; ++i)
+		scene.CreateEntity();
+
+	std::vector<Entity> entities;
+	scene.GetAllEntities(entities);
+	EXPECT_EQ(entities.size(), 16u);
+
+	const Entity* storage = entities.data();
+	scene.GetAllEntities(entities);
+	EXPECT_EQ(entities.size(), 16u);
+	EXPECT_EQ(entities.data(), storage);
+}
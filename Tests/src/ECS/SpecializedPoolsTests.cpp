@@ -8,6 +8,7 @@
 #include "Pillar/ECS/Components/Physics/VelocityComponent.h"
 #include "Pillar/ECS/Components/Gameplay/BulletComponent.h"
 #include "Pillar/ECS/Components/Gameplay/ParticleComponent.h"
+#include "Pillar/ECS/Components/Rendering/SpriteComponent.h"
 
 using namespace Pillar;
 
@@ -276,3 +277,61 @@ TEST_F(ParticlePoolTests, HighVolume_ManyParticles)
 	EXPECT_EQ(pool.GetActiveCount(), 500);
 	EXPECT_EQ(pool.GetAvailableCount(), 500);
 }
+
+TEST_F(ParticlePoolTests, SpawnBatch_SetsAllComponents)
+{
+	ParticlePool pool;
+	pool.Init(m_Scene.get(), 16);
+
+	ParticleSpawnBatch batch;
+	batch.Resize(8);
+	for (uint32_t i = 0; i < batch.Count; i++)
+	{
+		batch.Positions[i] = glm::vec2(static_cast<float>(i), 1.0f);
+		batch.Velocities[i] = glm::vec2(0.0f, static_cast<float>(i));
+		batch.Colors[i] = glm::vec4(1.0f, 0.5f, 0.25f, 1.0f);
+		batch.Sizes[i] = 0.2f;
+		batch.Lifetimes[i] = 2.0f;
+	}
+	batch.Gravity = glm::vec2(0.0f, -5.0f);
+	batch.ScaleOverTime = true;
+	batch.EndScale = 0.25f;
+
+	std::vector<Entity> spawned;
+	EXPECT_EQ(pool.SpawnBatch(batch, &spawned), 8u);
+	ASSERT_EQ(spawned.size(), 8);
+	EXPECT_EQ(pool.GetActiveCount(), 8);
+
+	for (uint32_t i = 0; i < batch.Count; i++)
+	{
+		Entity particle = spawned[i];
+		EXPECT_EQ(particle.GetComponent<TransformComponent>().Position, batch.Positions[i]);
+		EXPECT_EQ(particle.GetComponent<VelocityComponent>().Velocity, batch.Velocities[i]);
+		EXPECT_EQ(particle.GetComponent<VelocityComponent>().Acceleration, batch.Gravity);
+		EXPECT_EQ(particle.GetComponent<SpriteComponent>().Color, batch.Colors[i]);
+
+		auto& comp = particle.GetComponent<ParticleComponent>();
+		EXPECT_FLOAT_EQ(comp.Lifetime, 2.0f);
+		EXPECT_TRUE(comp.ScaleOverTime);
+		EXPECT_FLOAT_EQ(comp.EndSize.x, 0.05f);
+		EXPECT_FLOAT_EQ(comp.EndColor.a, 0.0f);
+	}
+}
+
+TEST_F(ParticlePoolTests, SpawnBatch_GrowsPoolWhenExhausted)
+{
+	ParticlePool pool;
+	pool.Init(m_Scene.get(), 4);
+
+	ParticleSpawnBatch batch;
+	batch.Resize(10);
+	for (uint32_t i = 0; i < batch.Count; i++)
+	{
+		batch.Sizes[i] = 0.1f;
+		batch.Lifetimes[i] = 1.0f;
+	}
+
+	EXPECT_EQ(pool.SpawnBatch(batch), 10u);
+	EXPECT_EQ(pool.GetActiveCount(), 10);
+	EXPECT_EQ(pool.GetTotalCount(), 10);
+}
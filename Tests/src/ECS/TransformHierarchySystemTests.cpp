@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+// TransformHierarchySystemTests: parent/child world transforms — handle links,
+// depth-first storage order, dirty-subtree updates, reparenting and cycles.
+#include "Pillar/ECS/Systems/TransformHierarchySystem.h"
+#include "Pillar/ECS/Scene.h"
+#include "Pillar/ECS/Entity.h"
+#include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Core/HierarchyComponent.h"
+#include "Pillar/ECS/Components/Core/WorldTransformComponent.h"
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <vector>
+
+using namespace Pillar;
+
+class TransformHierarchySystemTests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		m_Scene = std::make_unique<Scene>();
+		m_System.OnAttach(m_Scene.get());
+	}
+
+	void TearDown() override
+	{
+		m_System.OnDetach();
+		m_Scene.reset();
+	}
+
+	Entity CreateNode(const glm::vec2& position, Entity parent = {})
+	{
+		Entity entity = m_Scene->CreateEntity("Node");
+		entity.GetComponent<TransformComponent>().Position = position;
+		entity.AddComponent<HierarchyComponent>(parent ? parent.GetUUID() : 0);
+		return entity;
+	}
+
+	glm::vec2 WorldPosition(Entity entity)
+	{
+		return entity.GetComponent<WorldTransformComponent>().Position;
+	}
+
+	std::unique_ptr<Scene> m_Scene;
+	TransformHierarchySystem m_System;
+};
+
+TEST_F(TransformHierarchySystemTests, ChildFollowsParent)
+{
+	Entity parent = CreateNode({ 10.0f, 0.0f });
+	Entity child = CreateNode({ 1.0f, 2.0f }, parent);
+	Entity grandchild = CreateNode({ 0.0f, 1.0f }, child);
+
+	m_System.OnUpdate(0.016f);
+
+	EXPECT_FLOAT_EQ(WorldPosition(parent).x, 10.0f);
+	EXPECT_FLOAT_EQ(WorldPosition(child).x, 11.0f);
+	EXPECT_FLOAT_EQ(WorldPosition(child).y, 2.0f);
+	EXPECT_FLOAT_EQ(WorldPosition(grandchild).x, 11.0f);
+	EXPECT_FLOAT_EQ(WorldPosition(grandchild).y, 3.0f);
+}
+
+TEST_F(TransformHierarchySystemTests, RotatedScaledParent)
+{
+	Entity parent = CreateNode({ 5.0f, 0.0f });
+	auto& parentTransform = parent.GetComponent<TransformComponent>();
+	parentTransform.Rotation = glm::half_pi<float>();
+	parentTransform.Scale = { 2.0f, 2.0f };
+	Entity child = CreateNode({ 1.0f, 0.0f }, parent);
+	child.GetComponent<TransformComponent>().Rotation = 0.25f;
+
+	m_System.OnUpdate(0.016f);
+
+	const auto& world = child.GetComponent<WorldTransformComponent>();
+	EXPECT_NEAR(world.Position.x, 5.0f, 1e-5f);
+	EXPECT_NEAR(world.Position.y, 2.0f, 1e-5f);
+	EXPECT_FLOAT_EQ(world.Rotation, glm::half_pi<float>() + 0.25f);
+	EXPECT_FLOAT_EQ(world.Scale.x, 2.0f);
+}
+
+TEST_F(TransformHierarchySystemTests, ParentWithoutHierarchyComponentIsRoot)
+{
+	Entity parent = m_Scene->CreateEntity("Plain");
+	parent.GetComponent<TransformComponent>().Position = { 3.0f, 4.0f };
+	Entity child = CreateNode({ 1.0f, 1.0f }, parent);
+
+	m_System.OnUpdate(0.016f);
+
+	EXPECT_EQ(m_System.GetRootCount(), 1u);
+	EXPECT_EQ(m_System.GetNodeCount(), 2u);
+	EXPECT_FLOAT_EQ(WorldPosition(child).x, 4.0f);
+	EXPECT_FLOAT_EQ(WorldPosition(child).y, 5.0f);
+	EXPECT_EQ(child.GetComponent<HierarchyComponent>().Depth, 1u);
+}
+
+TEST_F(TransformHierarchySystemTests, Relink_BuildsHandleLinks)
+{
+	Entity root = CreateNode({ 0.0f, 0.0f });
+	Entity a = CreateNode({ 1.0f, 0.0f }, root);
+	Entity b = CreateNode({ 2.0f, 0.0f }, root);
+	Entity c = CreateNode({ 3.0f, 0.0f }, a);
+
+	m_System.OnUpdate(0.016f);
+
+	const auto& rootNode = root.GetComponent<HierarchyComponent>();
+	EXPECT_EQ(rootNode.Parent, entt::entity(entt::null));
+	EXPECT_EQ(rootNode.Depth, 0u);
+	EXPECT_EQ(a.GetComponent<HierarchyComponent>().Parent, static_cast<entt::entity>(root));
+	EXPECT_EQ(c.GetComponent<HierarchyComponent>().Parent, static_cast<entt::entity>(a));
+	EXPECT_EQ(c.GetComponent<HierarchyComponent>().Depth, 2u);
+
+	// Walk the sibling list
+	std::vector<entt::entity> children;
+	for (entt::entity child = rootNode.FirstChild; child != entt::null;
+		child = m_Scene->GetRegistry().get<HierarchyComponent>(child).NextSibling)
+		children.push_back(child);
+	ASSERT_EQ(children.size(), 2u);
+	EXPECT_NE(std::find(children.begin(), children.end(), static_cast<entt::entity>(a)), children.end());
+	EXPECT_NE(std::find(children.begin(), children.end(), static_cast<entt::entity>(b)), children.end());
+}
+
+TEST_F(TransformHierarchySystemTests, Relink_SortsStorageParentsFirst)
+{
+	// Create children before their parents so creation order is wrong
+	Entity root = m_Scene->CreateEntity("Root");
+	Entity leaf = CreateNode({ 0.0f, 0.0f });
+	Entity mid = CreateNode({ 0.0f, 0.0f });
+	root.AddComponent<HierarchyComponent>();
+	mid.GetComponent<HierarchyComponent>().ParentUUID = root.GetUUID();
+	leaf.GetComponent<HierarchyComponent>().ParentUUID = mid.GetUUID();
+
+	m_System.OnUpdate(0.016f);
+
+	auto& hierarchy = m_Scene->GetRegistry().storage<HierarchyComponent>();
+	std::vector<entt::entity> order(hierarchy.begin(), hierarchy.end());
+	auto position = [&order](entt::entity entity) {
+		return std::find(order.begin(), order.end(), entity) - order.begin();
+	};
+	EXPECT_LT(position(root), position(mid));
+	EXPECT_LT(position(mid), position(leaf));
+}
+
+TEST_F(TransformHierarchySystemTests, OnUpdate_OnlyDirtySubtreeRecomputed)
+{
+	Entity rootA = CreateNode({ 0.0f, 0.0f });
+	CreateNode({ 1.0f, 0.0f }, rootA);
+	Entity rootB = CreateNode({ 10.0f, 0.0f });
+	Entity childB = CreateNode({ 1.0f, 0.0f }, rootB);
+
+	m_System.OnUpdate(0.016f);
+	EXPECT_EQ(m_System.GetUpdatedCount(), 4u);
+
+	m_System.OnUpdate(0.016f);
+	EXPECT_EQ(m_System.GetUpdatedCount(), 0u);
+
+	rootB.GetComponent<TransformComponent>().Position.x = 20.0f;
+	m_System.OnUpdate(0.016f);
+	EXPECT_EQ(m_System.GetUpdatedCount(), 2u);
+	EXPECT_FLOAT_EQ(WorldPosition(childB).x, 21.0f);
+}
+
+TEST_F(TransformHierarchySystemTests, Reparent_RelinksAndMovesChild)
+{
+	Entity first = CreateNode({ 0.0f, 0.0f });
+	Entity second = CreateNode({ 100.0f, 0.0f });
+	Entity child = CreateNode({ 1.0f, 0.0f }, first);
+
+	m_System.OnUpdate(0.016f);
+	EXPECT_EQ(m_System.GetRelinkCount(), 1u);
+	EXPECT_FLOAT_EQ(WorldPosition(child).x, 1.0f);
+
+	m_System.OnUpdate(0.016f);
+	EXPECT_EQ(m_System.GetRelinkCount(), 1u); // Nothing changed
+
+	child.GetComponent<HierarchyComponent>().ParentUUID = second.GetUUID();
+	m_System.OnUpdate(0.016f);
+	EXPECT_EQ(m_System.GetRelinkCount(), 2u);
+	EXPECT_FLOAT_EQ(WorldPosition(child).x, 101.0f);
+}
+
+TEST_F(TransformHierarchySystemTests, DestroyedParent_ChildBecomesRoot)
+{
+	Entity parent = CreateNode({ 50.0f, 0.0f });
+	Entity child = CreateNode({ 1.0f, 0.0f }, parent);
+
+	m_System.OnUpdate(0.016f);
+	EXPECT_FLOAT_EQ(WorldPosition(child).x, 51.0f);
+
+	m_Scene->DestroyEntity(parent);
+	m_System.OnUpdate(0.016f);
+
+	EXPECT_EQ(m_System.GetNodeCount(), 1u);
+	EXPECT_FLOAT_EQ(WorldPosition(child).x, 1.0f);
+}
+
+TEST_F(TransformHierarchySystemTests, RemovedHierarchy_DropsWorldTransform)
+{
+	Entity parent = CreateNode({ 0.0f, 0.0f });
+	Entity child = CreateNode({ 1.0f, 0.0f }, parent);
+
+	m_System.OnUpdate(0.016f);
+	ASSERT_TRUE(child.HasComponent<WorldTransformComponent>());
+
+	child.RemoveComponent<HierarchyComponent>();
+	m_System.OnUpdate(0.016f);
+
+	EXPECT_FALSE(child.HasComponent<WorldTransformComponent>());
+	EXPECT_TRUE(parent.HasComponent<WorldTransformComponent>());
+}
+
+TEST_F(TransformHierarchySystemTests, ParentCycle_IsBroken)
+{
+	Entity a = CreateNode({ 1.0f, 0.0f });
+	Entity b = CreateNode({ 2.0f, 0.0f }, a);
+	a.GetComponent<HierarchyComponent>().ParentUUID = b.GetUUID();
+
+	m_System.OnUpdate(0.016f);
+
+	EXPECT_EQ(m_System.GetNodeCount(), 2u);
+	EXPECT_EQ(m_System.GetRootCount(), 1u);
+	EXPECT_TRUE(a.HasComponent<WorldTransformComponent>());
+	EXPECT_TRUE(b.HasComponent<WorldTransformComponent>());
+}
+
+TEST_F(TransformHierarchySystemTests, Parallel_MatchesSerial)
+{
+	std::vector<Entity> leaves;
+	for (int root = 0; root < 64; ++root)
+	{
+		Entity parent = CreateNode({ static_cast<float>(root), 0.0f });
+		parent.GetComponent<TransformComponent>().Rotation = 0.01f * root;
+		for (int depth = 0; depth < 40; ++depth)
+		{
+			parent = CreateNode({ 0.5f, 0.25f }, parent);
+			leaves.push_back(parent);
+		}
+	}
+
+	m_System.SetParallelThreshold(SIZE_MAX);
+	m_System.OnUpdate(0.016f);
+	std::vector<glm::vec2> serial;
+	for (Entity leaf : leaves)
+		serial.push_back(WorldPosition(leaf));
+
+	// Force a full recompute on the worker path
+	for (auto [entity, world] : m_Scene->GetRegistry().view<WorldTransformComponent>().each())
+		world.NeedsUpdate = true;
+	m_System.SetParallelThreshold(0);
+	m_System.OnUpdate(0.016f);
+
+	EXPECT_EQ(m_System.GetUpdatedCount(), 64u * 41u);
+	for (size_t i = 0; i < leaves.size(); ++i)
+	{
+		EXPECT_FLOAT_EQ(WorldPosition(leaves[i]).x, serial[i].x);
+		EXPECT_FLOAT_EQ(WorldPosition(leaves[i]).y, serial[i].y);
+	}
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+// TypedPoolTests: fixed-capacity typed pools — InactiveTag parking, prototype
+// resets, O(1) membership, growth policy and view exclusion.
+#include "Pillar/ECS/TypedPool.h"
+#include "Pillar/ECS/Scene.h"
+#include "Pillar/ECS/Entity.h"
+#include "Pillar/ECS/Components/Core/InactiveTag.h"
+#include "Pillar/ECS/Components/Core/TransformComponent.h"
+#include "Pillar/ECS/Components/Physics/VelocityComponent.h"
+#include <vector>
+
+using namespace Pillar;
+
+using MoverPool = TypedPool<TransformComponent, VelocityComponent>;
+
+class TypedPoolTests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		m_Scene = std::make_unique<Scene>();
+	}
+
+	void TearDown() override
+	{
+		m_Scene.reset();
+	}
+
+	size_t CountActiveMovers()
+	{
+		auto view = m_Scene->GetRegistry().view<TransformComponent, VelocityComponent>(entt::exclude<InactiveTag>);
+		size_t count = 0;
+		for (auto entity : view)
+		{
+			(void)entity;
+			++count;
+		}
+		return count;
+	}
+
+	std::unique_ptr<Scene> m_Scene;
+};
+
+TEST_F(TypedPoolTests, Init_CreatesParkedEntities)
+{
+	MoverPool pool;
+	pool.Init(m_Scene.get(), 32);
+
+	EXPECT_EQ(pool.GetTotalCount(), 32u);
+	EXPECT_EQ(pool.GetAvailableCount(), 32u);
+	EXPECT_EQ(pool.GetActiveCount(), 0u);
+	EXPECT_EQ(m_Scene->GetRegistry().storage<InactiveTag>().size(), 32u);
+	EXPECT_EQ(CountActiveMovers(), 0u);
+}
+
+TEST_F(TypedPoolTests, Acquire_RemovesInactiveTag)
+{
+	MoverPool pool;
+	pool.Init(m_Scene.get(), 4);
+
+	Entity entity = pool.Acquire();
+	ASSERT_TRUE(entity);
+	EXPECT_FALSE(entity.HasComponent<InactiveTag>());
+	EXPECT_TRUE(entity.HasComponent<TransformComponent>());
+	EXPECT_TRUE(entity.HasComponent<VelocityComponent>());
+	EXPECT_FALSE(pool.IsInPool(entity));
+	EXPECT_EQ(CountActiveMovers(), 1u);
+}
+
+TEST_F(TypedPoolTests, Release_ResetsToPrototypeAndParks)
+{
+	MoverPool pool;
+	pool.GetPrototype<VelocityComponent>().Drag = 0.5f;
+	pool.Init(m_Scene.get(), 2);
+
+	Entity entity = pool.Acquire();
+	EXPECT_FLOAT_EQ(entity.GetComponent<VelocityComponent>().Drag, 0.5f);
+
+	entity.GetComponent<TransformComponent>().Position = glm::vec2(10.0f, 5.0f);
+	entity.GetComponent<VelocityComponent>().Velocity = glm::vec2(3.0f, 0.0f);
+	entity.GetComponent<VelocityComponent>().Drag = 0.0f;
+
+	pool.Release(entity);
+
+	EXPECT_TRUE(pool.IsInPool(entity));
+	EXPECT_EQ(entity.GetComponent<TransformComponent>().Position, glm::vec2(0.0f));
+	EXPECT_EQ(entity.GetComponent<VelocityComponent>().Velocity, glm::vec2(0.0f));
+	EXPECT_FLOAT_EQ(entity.GetComponent<VelocityComponent>().Drag, 0.5f);
+	EXPECT_EQ(CountActiveMovers(), 0u);
+}
+
+TEST_F(TypedPoolTests, Release_Twice_IsIgnored)
+{
+	MoverPool pool;
+	pool.Init(m_Scene.get(), 2);
+
+	Entity entity = pool.Acquire();
+	pool.Release(entity);
+	pool.Release(entity);
+
+	EXPECT_EQ(pool.GetAvailableCount(), 2u);
+}
+
+TEST_F(TypedPoolTests, FixedCapacity_ReturnsInvalidWhenExhausted)
+{
+	MoverPool pool;
+	pool.Init(m_Scene.get(), 2);
+
+	EXPECT_TRUE(pool.Acquire());
+	EXPECT_TRUE(pool.Acquire());
+	EXPECT_FALSE(pool.Acquire());
+	EXPECT_EQ(pool.GetTotalCount(), 2u);
+
+	std::vector<Entity> batch;
+	EXPECT_EQ(pool.AcquireBatch(5, batch), 0u);
+	EXPECT_TRUE(batch.empty());
+}
+
+TEST_F(TypedPoolTests, Growth_CreatesWhenExhausted)
+{
+	MoverPool pool;
+	pool.Init(m_Scene.get(), 2, true);
+
+	std::vector<Entity> batch;
+	EXPECT_EQ(pool.AcquireBatch(5, batch), 5u);
+	EXPECT_EQ(pool.GetTotalCount(), 5u);
+	EXPECT_EQ(pool.GetActiveCount(), 5u);
+	EXPECT_EQ(CountActiveMovers(), 5u);
+}
+
+TEST_F(TypedPoolTests, ReleaseBatch_ParksAllAndSkipsDuplicates)
+{
+	MoverPool pool;
+	pool.Init(m_Scene.get(), 8);
+
+	std::vector<Entity> batch;
+	pool.AcquireBatch(8, batch);
+	for (Entity entity : batch)
+		entity.GetComponent<VelocityComponent>().Velocity = glm::vec2(1.0f);
+
+	batch.push_back(batch.front()); // Duplicate must not be parked twice
+	pool.ReleaseBatch(batch);
+
+	EXPECT_EQ(pool.GetAvailableCount(), 8u);
+	EXPECT_EQ(CountActiveMovers(), 0u);
+	for (Entity entity : batch)
+		EXPECT_EQ(entity.GetComponent<VelocityComponent>().Velocity, glm::vec2(0.0f));
+}
+
+TEST_F(TypedPoolTests, Clear_DestroysActiveAndParked)
+{
+	MoverPool pool;
+	pool.Init(m_Scene.get(), 6);
+	pool.Acquire();
+	pool.Acquire();
+
+	pool.Clear();
+
+	EXPECT_EQ(pool.GetTotalCount(), 0u);
+	EXPECT_EQ(m_Scene->GetRegistry().alive(), 0u);
+}
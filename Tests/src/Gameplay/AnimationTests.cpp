@@ -10,6 +10,8 @@
 #include "Pillar/ECS/Systems/AnimationSystem.h"
 #include "Pillar/Utils/AnimationLoader.h"
 #include <glm/glm.hpp>
+#include <string>
+#include <vector>
 
 using namespace Pillar;
 
@@ -495,8 +497,8 @@ TEST(AnimationSystemTests, PlaybackSpeedModification)
 	anim.Play("Walk");
 	anim.PlaybackSpeed = 2.0f;  // 2x speed
 
-	// At 2x speed, 0.1s real time should advance 0.2s playback time
-	system.OnUpdate(0.1f);
+	// At 2x speed, 0.075s real time advances 0.15s playback time
+	system.OnUpdate(0.075f);
 
 	// Should have advanced to next frame
 	EXPECT_EQ(anim.FrameIndex, 1);
@@ -563,6 +565,188 @@ TEST(AnimationSystemTests, UVCoordinateUpdate)
 	EXPECT_EQ(sprite.TexCoordMax, glm::vec2(0.75f, 0.75f));
 }
 
+// Four 0.1s frames with distinct UVs, frame i spanning [i * 0.25, (i + 1) * 0.25] in x
+static AnimationClip MakeStripClip(const std::string& name, bool loop)
+{
+	AnimationClip clip;
+	clip.Name = name;
+	clip.Loop = loop;
+	for (int i = 0; i < 4; ++i)
+	{
+		AnimationFrame frame;
+		frame.Duration = 0.1f;
+		frame.UVMin = glm::vec2(i * 0.25f, 0.0f);
+		frame.UVMax = glm::vec2((i + 1) * 0.25f, 1.0f);
+		clip.Frames.push_back(frame);
+	}
+	return clip;
+}
+
+TEST(AnimationSystemTests, LongDeltaCatchesUpSeveralFrames)
+{
+	Scene scene("TestScene");
+	AnimationSystem system;
+	system.OnAttach(&scene);
+	system.RegisterClip(MakeStripClip("Run", true));
+
+	auto entity = scene.CreateEntity("TestEntity");
+	auto& sprite = entity.AddComponent<SpriteComponent>();
+	auto& anim = entity.AddComponent<AnimationComponent>();
+	anim.Play("Run");
+
+	// A 0.25s hitch covers frames 0 and 1 and lands halfway through frame 2
+	system.OnUpdate(0.25f);
+	EXPECT_EQ(anim.FrameIndex, 2);
+	EXPECT_NEAR(anim.PlaybackTime, 0.05f, 1e-4f);
+	EXPECT_EQ(sprite.TexCoordMin, glm::vec2(0.5f, 0.0f));
+
+	// Wrapping past the end carries the remainder into the next loop
+	system.OnUpdate(0.2f);
+	EXPECT_EQ(anim.FrameIndex, 0);
+	EXPECT_NEAR(anim.PlaybackTime, 0.05f, 1e-4f);
+	EXPECT_TRUE(anim.Playing);
+}
+
+TEST(AnimationSystemTests, LongDeltaFiresSkippedFrameEvents)
+{
+	Scene scene("TestScene");
+	AnimationSystem system;
+	system.OnAttach(&scene);
+
+	AnimationClip clip = MakeStripClip("Run", true);
+	for (int i = 0; i < 4; ++i)
+	{
+		AnimationClip::AnimationEvent event;
+		event.FrameIndex = i;
+		event.EventName = "Frame" + std::to_string(i);
+		clip.Events.push_back(event);
+	}
+	system.RegisterClip(clip);
+
+	auto entity = scene.CreateEntity("TestEntity");
+	entity.AddComponent<SpriteComponent>();
+	auto& anim = entity.AddComponent<AnimationComponent>();
+
+	std::vector<std::string> fired;
+	anim.OnAnimationEvent = [&fired](const std::string& eventName, entt::entity) {
+		fired.push_back(eventName);
+	};
+	anim.Play("Run");
+
+	// Frames 0-2 are left in one update, in order
+	system.OnUpdate(0.35f);
+	ASSERT_EQ(fired.size(), 3u);
+	EXPECT_EQ(fired[0], "Frame0");
+	EXPECT_EQ(fired[1], "Frame1");
+	EXPECT_EQ(fired[2], "Frame2");
+	EXPECT_EQ(anim.FrameIndex, 3);
+
+	// The rest of the loop fires Frame3; the whole loops skipped after it fire
+	// each event once, not once per loop
+	fired.clear();
+	system.OnUpdate(1.3f);
+	ASSERT_EQ(fired.size(), 1u + 4u);
+	EXPECT_EQ(fired[0], "Frame3");
+	EXPECT_EQ(anim.FrameIndex, 0);
+}
+
+TEST(AnimationSystemTests, NonLoopingLongDeltaCompletesOnce)
+{
+	Scene scene("TestScene");
+	AnimationSystem system;
+	system.OnAttach(&scene);
+	system.RegisterClip(MakeStripClip("Die", false));
+
+	auto entity = scene.CreateEntity("TestEntity");
+	auto& sprite = entity.AddComponent<SpriteComponent>();
+	auto& anim = entity.AddComponent<AnimationComponent>();
+
+	int completions = 0;
+	anim.OnAnimationComplete = [&completions](entt::entity) { ++completions; };
+	anim.Play("Die");
+
+	system.OnUpdate(5.0f);
+	EXPECT_EQ(anim.FrameIndex, 3);
+	EXPECT_FALSE(anim.Playing);
+	EXPECT_EQ(completions, 1);
+	EXPECT_EQ(sprite.TexCoordMin, glm::vec2(0.75f, 0.0f));
+
+	system.OnUpdate(5.0f);
+	EXPECT_EQ(completions, 1);
+}
+
+TEST(AnimationSystemTests, SpriteWrittenOnlyOnFrameChange)
+{
+	Scene scene("TestScene");
+	AnimationSystem system;
+	system.OnAttach(&scene);
+	system.RegisterClip(MakeStripClip("Run", true));
+
+	auto entity = scene.CreateEntity("TestEntity");
+	auto& sprite = entity.AddComponent<SpriteComponent>();
+	auto& anim = entity.AddComponent<AnimationComponent>();
+	anim.Play("Run");
+
+	system.OnUpdate(0.01f);
+	EXPECT_EQ(sprite.TexCoordMin, glm::vec2(0.0f, 0.0f));
+
+	// Within the same frame the sprite is left alone
+	sprite.TexCoordMin = glm::vec2(0.9f, 0.9f);
+	system.OnUpdate(0.01f);
+	EXPECT_EQ(sprite.TexCoordMin, glm::vec2(0.9f, 0.9f));
+
+	// Read-only lookups (the editor does them every frame) don't force a recompile
+	EXPECT_NE(system.GetClip("Run"), nullptr);
+	system.OnUpdate(0.01f);
+	EXPECT_EQ(sprite.TexCoordMin, glm::vec2(0.9f, 0.9f));
+
+	// The next frame overwrites it
+	system.OnUpdate(0.1f);
+	EXPECT_EQ(anim.FrameIndex, 1);
+	EXPECT_EQ(sprite.TexCoordMin, glm::vec2(0.25f, 0.0f));
+}
+
+TEST(AnimationSystemTests, ClipHandles)
+{
+	AnimationSystem system;
+	system.RegisterClip(MakeStripClip("Run", true));
+	system.RegisterClip(MakeStripClip("Idle", true));
+
+	AnimationClipHandle run = system.GetClipHandle("Run");
+	AnimationClipHandle idle = system.GetClipHandle("Idle");
+	EXPECT_NE(run, InvalidAnimationClip);
+	EXPECT_NE(idle, InvalidAnimationClip);
+	EXPECT_NE(run, idle);
+	EXPECT_EQ(system.GetClipHandle("Missing"), InvalidAnimationClip);
+
+	// Handles survive re-registration; unloaded clips no longer resolve
+	system.RegisterClip(MakeStripClip("Run", false));
+	EXPECT_EQ(system.GetClipHandle("Run"), run);
+	EXPECT_TRUE(system.UnloadClip("Idle"));
+	EXPECT_EQ(system.GetClipHandle("Idle"), InvalidAnimationClip);
+}
+
+TEST(AnimationSystemTests, ReRegisteredClipIsPickedUp)
+{
+	Scene scene("TestScene");
+	AnimationSystem system;
+	system.OnAttach(&scene);
+	system.RegisterClip(MakeStripClip("Run", true));
+
+	auto entity = scene.CreateEntity("TestEntity");
+	auto& sprite = entity.AddComponent<SpriteComponent>();
+	auto& anim = entity.AddComponent<AnimationComponent>();
+	anim.Play("Run");
+	system.OnUpdate(0.01f);
+
+	// Editing the clip through the library recompiles it on the next update
+	AnimationClip* clip = system.EditClip("Run");
+	ASSERT_NE(clip, nullptr);
+	clip->Frames[0].UVMin = glm::vec2(0.1f, 0.2f);
+	system.OnUpdate(0.01f);
+	EXPECT_EQ(sprite.TexCoordMin, glm::vec2(0.1f, 0.2f));
+}
+
 // ============================================================================
 // AnimationLoader Tests (JSON Serialization)
 // ============================================================================
@@ -6,8 +6,11 @@
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
 #include "Pillar/ECS/Components/Physics/VelocityComponent.h"
 #include "Pillar/ECS/Components/Gameplay/BulletComponent.h"
+#include "Pillar/ECS/Components/Physics/RigidbodyComponent.h"
+#include "Pillar/ECS/Components/Physics/ColliderComponent.h"
 #include "Pillar/ECS/Systems/BulletCollisionSystem.h"
 #include "Pillar/ECS/Systems/PhysicsSystem.h"
+#include <vector>
 
 using namespace Pillar;
 
@@ -21,6 +24,7 @@ TEST(BulletTests, DefaultConstructor_InitializesValues)
 	EXPECT_EQ(bullet.Damage, 10.0f);
 	EXPECT_EQ(bullet.Lifetime, 5.0f);
 	EXPECT_EQ(bullet.TimeAlive, 0.0f);
+	EXPECT_EQ(bullet.Radius, 0.0f);
 	EXPECT_FALSE(bullet.Pierce);
 	EXPECT_EQ(bullet.MaxHits, 1);
 	EXPECT_EQ(bullet.HitsRemaining, 1);
@@ -130,3 +134,204 @@ TEST(BulletCollisionTests, MultipleBullets_AllProcessed)
 	bulletSystem.OnUpdate(0.5f);
 	EXPECT_EQ(scene.GetRegistry().alive(), 0);
 }
+
+// ========================================
+// Batched Raycast Tests
+// ========================================
+
+namespace {
+
+	Entity CreateWall(Scene& scene, const glm::vec2& position, const glm::vec2& halfExtents)
+	{
+		Entity wall = scene.CreateEntity("Wall");
+		wall.GetComponent<TransformComponent>().Position = position;
+		wall.AddComponent<RigidbodyComponent>().BodyType = b2_staticBody;
+		wall.AddComponent<ColliderComponent>(ColliderComponent::Box(halfExtents));
+		return wall;
+	}
+
+	Entity CreateBullet(Scene& scene, const glm::vec2& position, const glm::vec2& velocity, uint32_t hits = 1, float radius = 0.0f)
+	{
+		Entity bullet = scene.CreateEntity("Bullet");
+		bullet.GetComponent<TransformComponent>().Position = position;
+		bullet.AddComponent<VelocityComponent>(velocity);
+		auto& comp = bullet.AddComponent<BulletComponent>();
+		comp.MaxHits = hits;
+		comp.HitsRemaining = hits;
+		comp.Radius = radius;
+		return bullet;
+	}
+
+} // namespace
+
+TEST(BulletCollisionTests, Raycast_HitsWallInPath)
+{
+	Scene scene;
+	PhysicsSystem physicsSystem;
+	BulletCollisionSystem bulletSystem(&physicsSystem);
+	physicsSystem.OnAttach(&scene);
+	bulletSystem.OnAttach(&scene);
+
+	CreateWall(scene, glm::vec2(1.0f, 0.0f), glm::vec2(0.25f, 1.0f));
+	physicsSystem.OnUpdate(0.016f); // Create bodies
+
+	Entity hitter = CreateBullet(scene, glm::vec2(0.0f), glm::vec2(100.0f, 0.0f));
+	Entity misser = CreateBullet(scene, glm::vec2(0.0f, 5.0f), glm::vec2(100.0f, 0.0f));
+
+	bulletSystem.OnUpdate(0.016f);
+
+	EXPECT_EQ(bulletSystem.GetHitCount(), 1u);
+	EXPECT_EQ(hitter.GetComponent<BulletComponent>().HitsRemaining, 0u);
+	EXPECT_EQ(misser.GetComponent<BulletComponent>().HitsRemaining, 1u);
+}
+
+TEST(BulletCollisionTests, Raycast_IgnoresOwner)
+{
+	Scene scene;
+	PhysicsSystem physicsSystem;
+	BulletCollisionSystem bulletSystem(&physicsSystem);
+	physicsSystem.OnAttach(&scene);
+	bulletSystem.OnAttach(&scene);
+
+	Entity owner = CreateWall(scene, glm::vec2(0.0f), glm::vec2(0.5f));
+	physicsSystem.OnUpdate(0.016f);
+
+	// Bullet starts inside its owner and flies out
+	Entity bullet = CreateBullet(scene, glm::vec2(-1.0f, 0.0f), glm::vec2(200.0f, 0.0f));
+	bullet.GetComponent<BulletComponent>().Owner = owner;
+
+	bulletSystem.OnUpdate(0.016f);
+
+	EXPECT_EQ(bulletSystem.GetHitCount(), 0u);
+	EXPECT_EQ(bullet.GetComponent<BulletComponent>().HitsRemaining, 1u);
+}
+
+TEST(BulletCollisionTests, Raycast_ParallelMatchesSerial)
+{
+	// Same bullet field cast serially and on worker threads must hit identically
+	auto run = [](size_t parallelThreshold) {
+		Scene scene;
+		PhysicsSystem physicsSystem;
+		BulletCollisionSystem bulletSystem(&physicsSystem);
+		physicsSystem.OnAttach(&scene);
+		bulletSystem.OnAttach(&scene);
+		bulletSystem.SetParallelThreshold(parallelThreshold);
+
+		for (int x = -5; x <= 5; ++x)
+			CreateWall(scene, glm::vec2(x * 6.0f, 0.0f), glm::vec2(0.5f, 20.0f));
+		physicsSystem.OnUpdate(0.016f);
+
+		std::vector<Entity> bullets;
+		for (int i = 0; i < 2000; ++i)
+		{
+			const float x = static_cast<float>(i % 67) - 33.0f;
+			const float y = static_cast<float>(i / 67) - 15.0f;
+			bullets.push_back(CreateBullet(scene, glm::vec2(x, y), glm::vec2((i % 2) ? 60.0f : -60.0f, 0.0f), 10));
+		}
+
+		bulletSystem.OnUpdate(0.016f);
+
+		std::vector<uint32_t> remaining;
+		for (Entity bullet : bullets)
+			remaining.push_back(bullet.GetComponent<BulletComponent>().HitsRemaining);
+		return std::make_pair(bulletSystem.GetHitCount(), remaining);
+	};
+
+	auto serial = run(static_cast<size_t>(-1));
+	auto parallel = run(0);
+
+	EXPECT_GT(serial.first, 0u);
+	EXPECT_EQ(serial.first, parallel.first);
+	EXPECT_EQ(serial.second, parallel.second);
+}
+
+// ========================================
+// Swept-Circle Tests
+// ========================================
+
+TEST(BulletCollisionTests, SweptCircle_GrazesWallThatRayMisses)
+{
+	Scene scene;
+	PhysicsSystem physicsSystem;
+	BulletCollisionSystem bulletSystem(&physicsSystem);
+	physicsSystem.OnAttach(&scene);
+	bulletSystem.OnAttach(&scene);
+
+	// Thin wall spanning y in [-1, 1]
+	CreateWall(scene, glm::vec2(1.0f, 0.0f), glm::vec2(0.05f, 1.0f));
+	physicsSystem.OnUpdate(0.016f);
+
+	// Both pass just above the wall; only the one with a radius touches it
+	Entity ray = CreateBullet(scene, glm::vec2(0.0f, 1.2f), glm::vec2(100.0f, 0.0f));
+	Entity circle = CreateBullet(scene, glm::vec2(0.0f, 1.2f), glm::vec2(100.0f, 0.0f), 1, 0.3f);
+
+	bulletSystem.OnUpdate(0.016f);
+
+	EXPECT_EQ(ray.GetComponent<BulletComponent>().HitsRemaining, 1u);
+	EXPECT_EQ(circle.GetComponent<BulletComponent>().HitsRemaining, 0u);
+	EXPECT_EQ(bulletSystem.GetHitCount(), 1u);
+}
+
+TEST(BulletCollisionTests, SweptCircle_HitsCircleCollider)
+{
+	Scene scene;
+	PhysicsSystem physicsSystem;
+	BulletCollisionSystem bulletSystem(&physicsSystem);
+	physicsSystem.OnAttach(&scene);
+	bulletSystem.OnAttach(&scene);
+
+	Entity target = scene.CreateEntity("Target");
+	target.GetComponent<TransformComponent>().Position = glm::vec2(1.0f, 0.0f);
+	target.AddComponent<RigidbodyComponent>().BodyType = b2_staticBody;
+	target.AddComponent<ColliderComponent>(ColliderComponent::Circle(0.5f));
+	physicsSystem.OnUpdate(0.016f);
+
+	// Passes 0.7 from the center: misses as a ray, hits with radius 0.25
+	Entity ray = CreateBullet(scene, glm::vec2(0.0f, 0.7f), glm::vec2(100.0f, 0.0f));
+	Entity circle = CreateBullet(scene, glm::vec2(0.0f, 0.7f), glm::vec2(100.0f, 0.0f), 1, 0.25f);
+
+	bulletSystem.OnUpdate(0.016f);
+
+	EXPECT_EQ(ray.GetComponent<BulletComponent>().HitsRemaining, 1u);
+	EXPECT_EQ(circle.GetComponent<BulletComponent>().HitsRemaining, 0u);
+}
+
+TEST(BulletCollisionTests, SweptCircle_FastBulletDoesNotTunnel)
+{
+	Scene scene;
+	PhysicsSystem physicsSystem;
+	BulletCollisionSystem bulletSystem(&physicsSystem);
+	physicsSystem.OnAttach(&scene);
+	bulletSystem.OnAttach(&scene);
+
+	// Very thin wall, bullet travels 50 units in one frame
+	CreateWall(scene, glm::vec2(25.0f, 0.0f), glm::vec2(0.01f, 2.0f));
+	physicsSystem.OnUpdate(0.016f);
+
+	Entity bullet = CreateBullet(scene, glm::vec2(0.0f, 1.9f), glm::vec2(3000.0f, 0.0f), 1, 0.2f);
+
+	bulletSystem.OnUpdate(1.0f / 60.0f);
+
+	EXPECT_EQ(bullet.GetComponent<BulletComponent>().HitsRemaining, 0u);
+}
+
+TEST(BulletCollisionTests, SweptCircle_StartingInsideIgnoresCorners)
+{
+	Scene scene;
+	PhysicsSystem physicsSystem;
+	BulletCollisionSystem bulletSystem(&physicsSystem);
+	physicsSystem.OnAttach(&scene);
+	bulletSystem.OnAttach(&scene);
+
+	CreateWall(scene, glm::vec2(0.0f), glm::vec2(2.0f));
+	physicsSystem.OnUpdate(0.016f);
+
+	// Starts well inside the box (farther than its radius from any corner) and
+	// leaves through the (2, 2) corner
+	Entity bullet = CreateBullet(scene, glm::vec2(1.0f, 1.0f), glm::vec2(120.0f, 120.0f), 1, 0.2f);
+
+	bulletSystem.OnUpdate(0.016f);
+
+	EXPECT_EQ(bulletSystem.GetHitCount(), 0u);
+	EXPECT_EQ(bullet.GetComponent<BulletComponent>().HitsRemaining, 1u);
+}
@@ -5,12 +5,17 @@
 #include "Pillar/ECS/Entity.h"
 #include "Pillar/ECS/Components/Gameplay/ParticleComponent.h"
 #include "Pillar/ECS/Components/Gameplay/ParticleEmitterComponent.h"
+#include "Pillar/ECS/Components/Gameplay/ParticleAnimationCurves.h"
+#include "Pillar/ECS/Components/Rendering/SpriteComponent.h"
 #include "Pillar/ECS/Components/Core/TransformComponent.h"
 #include "Pillar/ECS/Components/Physics/VelocityComponent.h"
 #include "Pillar/ECS/Systems/ParticleSystem.h"
 #include "Pillar/ECS/Systems/ParticleEmitterSystem.h"
 #include "Pillar/ECS/SpecializedPools.h"
+#include "Pillar/ECS/Components/Core/InactiveTag.h"
 #include <glm/glm.hpp>
+#include <vector>
+#include <cmath>
 
 using namespace Pillar;
 
@@ -249,6 +254,101 @@ TEST(ParticleEmitterComponentTests, GravitySettings)
 	EXPECT_FLOAT_EQ(emitter.Gravity.y, -9.8f);
 }
 
+// ============================================================================
+// Baked Gradient / Curve Lookup Table Tests
+// ============================================================================
+
+TEST(ParticleLUTTests, BakedGradient_MatchesEvaluate)
+{
+	ColorGradient gradient(
+		glm::vec4(1.0f, 0.0f, 0.0f, 1.0f),
+		glm::vec4(0.0f, 1.0f, 0.0f, 0.5f),
+		glm::vec4(0.0f, 0.0f, 1.0f, 0.0f));
+	EXPECT_FALSE(gradient.IsBaked());
+
+	gradient.Bake();
+	EXPECT_TRUE(gradient.IsBaked());
+
+	for (int i = 0; i <= 100; ++i)
+	{
+		float t = i / 100.0f;
+		glm::vec4 expected = gradient.Evaluate(t);
+		glm::vec4 sampled = gradient.Sample(t);
+		EXPECT_NEAR(sampled.r, expected.r, 0.01f);
+		EXPECT_NEAR(sampled.g, expected.g, 0.01f);
+		EXPECT_NEAR(sampled.b, expected.b, 0.01f);
+		EXPECT_NEAR(sampled.a, expected.a, 0.01f);
+	}
+}
+
+TEST(ParticleLUTTests, BakedGradient_StaleAfterStopsChange)
+{
+	ColorGradient gradient(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+	gradient.Bake();
+	EXPECT_TRUE(gradient.IsBaked());
+
+	gradient.Stops.back().Color = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
+	EXPECT_FALSE(gradient.IsBaked());
+	EXPECT_EQ(gradient.Sample(1.0f), glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
+
+	gradient.Stops.insert(gradient.Stops.begin() + 1, { 0.5f, glm::vec4(1.0f) });
+	EXPECT_FALSE(gradient.IsBaked());
+	gradient.Bake();
+	EXPECT_TRUE(gradient.IsBaked());
+}
+
+TEST(ParticleLUTTests, BakedGradient_ClampsOutOfRange)
+{
+	ColorGradient gradient(glm::vec4(0.0f), glm::vec4(1.0f));
+	gradient.Bake();
+
+	EXPECT_EQ(gradient.Sample(-1.0f), glm::vec4(0.0f));
+	EXPECT_EQ(gradient.Sample(2.0f), glm::vec4(1.0f));
+}
+
+TEST(ParticleLUTTests, SampleBatch_MatchesSample)
+{
+	ColorGradient gradient(glm::vec4(1.0f, 0.5f, 0.0f, 1.0f), glm::vec4(0.0f, 0.5f, 1.0f, 0.0f));
+	gradient.Bake();
+
+	// 19 = two full lane groups plus a remainder
+	std::vector<float> times(19);
+	for (size_t i = 0; i < times.size(); ++i)
+		times[i] = static_cast<float>(i) / 18.0f;
+
+	std::vector<glm::vec4> colors(times.size());
+	gradient.GetLUT().SampleBatch(times.data(), colors.data(), times.size());
+
+	for (size_t i = 0; i < times.size(); ++i)
+		EXPECT_EQ(colors[i], gradient.Sample(times[i]));
+}
+
+TEST(ParticleLUTTests, BakedCurve_MatchesEvaluate)
+{
+	for (CurveType type : { CurveType::Linear, CurveType::EaseIn, CurveType::EaseOut, CurveType::EaseInOut, CurveType::Bounce })
+	{
+		AnimationCurve curve(type, 0.75f);
+		curve.Bake();
+
+		for (int i = 0; i <= 100; ++i)
+		{
+			float t = i / 100.0f;
+			EXPECT_NEAR(curve.Sample(t), curve.Evaluate(t), 1e-3f);
+		}
+	}
+}
+
+TEST(ParticleLUTTests, BakedCurve_StaleAfterTypeChange)
+{
+	AnimationCurve curve(CurveType::EaseIn);
+	curve.Bake();
+	EXPECT_TRUE(curve.IsBaked());
+
+	curve.Type = CurveType::EaseOut;
+	EXPECT_FALSE(curve.IsBaked());
+	EXPECT_FLOAT_EQ(curve.Sample(0.3f), curve.Evaluate(0.3f));
+}
+
 // ============================================================================
 // ParticleSystem Tests
 // ============================================================================
@@ -276,10 +376,7 @@ protected:
 	ParticleSystem m_System;
 };
 
-// Note: ParticleSystem tests are limited because the system iterates over
-// ALL entities with ParticleComponent+TransformComponent+SpriteComponent,
-// including pooled (inactive) entities. The pool pre-allocates entities,
-// so counts include pooled entities.
+// Pooled particles carry InactiveTag, so the system only sees spawned ones.
 
 TEST_F(ParticleSystemTests, OnUpdate_ProcessesParticles)
 {
@@ -298,6 +395,55 @@ TEST_F(ParticleSystemTests, OnUpdate_ProcessesParticles)
 	EXPECT_GE(comp.Age, 0.0f);
 }
 
+TEST_F(ParticleSystemTests, OnUpdate_SkipsPooledParticles)
+{
+	m_ParticlePool->SpawnParticle(glm::vec2(0), glm::vec2(0), glm::vec4(1), 0.1f, 2.0f);
+
+	m_System.OnUpdate(0.5f);
+
+	// Only the spawned particle is visited, not the 99 parked ones
+	EXPECT_EQ(m_System.GetActiveParticleCount(), 1u);
+	EXPECT_EQ(m_System.GetDeadParticleCount(), 0u);
+}
+
+TEST_F(ParticleSystemTests, OnUpdate_ExpiredParticle_ParkedOnce)
+{
+	Entity particle = m_ParticlePool->SpawnParticle(
+		glm::vec2(0), glm::vec2(0), glm::vec4(1), 0.1f, 0.5f
+	);
+
+	m_System.OnUpdate(1.0f);
+	EXPECT_EQ(m_System.GetDeadParticleCount(), 1u);
+	EXPECT_TRUE(particle.HasComponent<InactiveTag>());
+	EXPECT_EQ(m_ParticlePool->GetAvailableCount(), 100u);
+
+	// Parked particle is reset and never aged or released again
+	m_System.OnUpdate(1.0f);
+	EXPECT_EQ(m_System.GetDeadParticleCount(), 0u);
+	EXPECT_FLOAT_EQ(particle.GetComponent<ParticleComponent>().Age, 0.0f);
+	EXPECT_EQ(m_ParticlePool->GetAvailableCount(), 100u);
+}
+
+TEST_F(ParticleSystemTests, OnUpdate_GradientParticle_UsesBakedGradient)
+{
+	ColorGradient gradient(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+
+	Entity particle = m_ParticlePool->SpawnParticle(
+		glm::vec2(0), glm::vec2(0), glm::vec4(1), 0.1f, 2.0f
+	);
+	auto& comp = particle.GetComponent<ParticleComponent>();
+	comp.UseColorGradient = true;
+	comp.ColorGradientPtr = &gradient;
+
+	m_System.OnUpdate(1.0f);
+
+	// Gradient is baked lazily on first use and sampled at t = 0.5
+	EXPECT_TRUE(gradient.IsBaked());
+	const glm::vec4& color = particle.GetComponent<SpriteComponent>().Color;
+	EXPECT_NEAR(color.r, 0.5f, 0.01f);
+	EXPECT_NEAR(color.b, 0.5f, 0.01f);
+}
+
 TEST_F(ParticleSystemTests, ParticleComponent_ShouldRemove_WhenDead)
 {
 	ParticleComponent comp;
@@ -400,6 +546,100 @@ TEST_F(ParticleEmitterSystemTests, OnUpdate_BurstMode_OnlyFiresOnce)
 	EXPECT_EQ(countAfterFirst, countAfterSecond);
 }
 
+TEST_F(ParticleEmitterSystemTests, OnUpdate_LargeBurst_SpawnsExactCount)
+{
+	Entity emitter = m_Scene->CreateEntity("Emitter");
+	auto& emitterComp = emitter.AddComponent<ParticleEmitterComponent>();
+	emitterComp.BurstMode = true;
+	emitterComp.BurstCount = 5000; // Larger than the pool; remainder is created in one go
+	emitterComp.Shape = EmissionShape::Box;
+	emitterComp.ShapeSize = glm::vec2(2.0f, 4.0f);
+
+	m_System.OnUpdate(0.016f);
+
+	EXPECT_EQ(m_System.GetParticlesSpawnedThisFrame(), 5000u);
+	EXPECT_EQ(m_ParticlePool->GetActiveCount(), 5000);
+
+	// Positions stay within the emission box
+	auto view = m_Scene->GetRegistry().view<ParticleComponent, TransformComponent>();
+	for (auto entity : view)
+	{
+		const auto& transform = view.get<TransformComponent>(entity);
+		EXPECT_LE(std::abs(transform.Position.x), 1.0f);
+		EXPECT_LE(std::abs(transform.Position.y), 2.0f);
+	}
+}
+
+TEST_F(ParticleEmitterSystemTests, OnUpdate_PropagatesEmitterSettings)
+{
+	ColorGradient gradient(glm::vec4(1.0f), glm::vec4(0.0f));
+	AnimationCurve curve(CurveType::EaseOut);
+
+	Entity emitter = m_Scene->CreateEntity("Emitter");
+	auto& emitterComp = emitter.AddComponent<ParticleEmitterComponent>();
+	emitterComp.BurstMode = true;
+	emitterComp.BurstCount = 10;
+	emitterComp.Gravity = glm::vec2(0.0f, 3.0f);
+	emitterComp.ScaleOverTime = true;
+	emitterComp.UseColorGradient = true;
+	emitterComp.ColorGradientPtr = &gradient;
+	emitterComp.SizeCurvePtr = &curve;
+
+	m_System.OnUpdate(0.016f);
+
+	uint32_t checked = 0;
+	auto view = m_Scene->GetRegistry().view<ParticleComponent, VelocityComponent>();
+	for (auto entity : view)
+	{
+		const auto& particle = view.get<ParticleComponent>(entity);
+		if (particle.ColorGradientPtr != &gradient)
+			continue;
+
+		EXPECT_TRUE(particle.UseColorGradient);
+		EXPECT_TRUE(particle.ScaleOverTime);
+		EXPECT_EQ(particle.SizeCurve, &curve);
+		EXPECT_EQ(view.get<VelocityComponent>(entity).Acceleration, glm::vec2(0.0f, 3.0f));
+		checked++;
+	}
+
+	EXPECT_EQ(checked, 10u);
+}
+
+TEST(ParticleEmitterDeterminismTests, SameSceneSeedAndUUID_SameParticles)
+{
+	auto runBurst = [](uint64_t sceneSeed) {
+		Scene scene;
+		scene.SetRandomSeed(sceneSeed);
+		ParticlePool pool;
+		pool.Init(&scene, 0);
+		ParticleEmitterSystem system;
+		system.OnAttach(&scene);
+		system.SetParticlePool(&pool);
+
+		Entity emitter = scene.CreateEntityWithUUID(42u, "Emitter");
+		auto& comp = emitter.AddComponent<ParticleEmitterComponent>();
+		comp.BurstMode = true;
+		comp.BurstCount = 20;
+		comp.Shape = EmissionShape::Circle;
+
+		system.OnUpdate(0.016f);
+
+		std::vector<glm::vec2> velocities;
+		auto view = scene.GetRegistry().view<ParticleComponent, VelocityComponent>();
+		for (auto entity : view)
+			velocities.push_back(view.get<VelocityComponent>(entity).Velocity);
+		return velocities;
+	};
+
+	auto first = runBurst(7u);
+	auto second = runBurst(7u);
+	auto other = runBurst(8u);
+
+	ASSERT_EQ(first.size(), 20);
+	EXPECT_EQ(first, second);
+	EXPECT_NE(first, other);
+}
+
 TEST_F(ParticleEmitterSystemTests, GetEmitterCount)
 {
 	// Create multiple emitters
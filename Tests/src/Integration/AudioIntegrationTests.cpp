@@ -178,6 +178,61 @@ TEST_F(AudioIntegrationTests, AudioSystem_UpdatesSourcePositions)
 	SUCCEED();
 }
 
+TEST_F(AudioIntegrationTests, AudioSystem_PushesPositionOnlyWhenMoved)
+{
+	AudioSystem audioSystem;
+	audioSystem.OnAttach(m_Scene.get());
+
+	Entity emitter = m_Scene->CreateEntity("Emitter");
+	emitter.AddComponent<AudioSourceComponent>();
+	emitter.GetComponent<TransformComponent>().Position = glm::vec2(10.0f, 0.0f);
+
+	audioSystem.OnUpdate(0.016f);
+	auto& audioComp = emitter.GetComponent<AudioSourceComponent>();
+	ASSERT_NE(audioComp.Source, nullptr);
+	EXPECT_FLOAT_EQ(audioComp.Source->GetPosition().x, 10.0f);
+
+	// A stationary entity leaves its source alone
+	audioComp.Source->SetPosition(glm::vec3(-3.0f, 0.0f, 0.0f));
+	audioSystem.OnUpdate(0.016f);
+	EXPECT_FLOAT_EQ(audioComp.Source->GetPosition().x, -3.0f);
+
+	emitter.GetComponent<TransformComponent>().Position = glm::vec2(20.0f, 5.0f);
+	audioSystem.OnUpdate(0.016f);
+	EXPECT_FLOAT_EQ(audioComp.Source->GetPosition().x, 20.0f);
+	EXPECT_FLOAT_EQ(audioComp.Source->GetPosition().y, 5.0f);
+}
+
+TEST_F(AudioIntegrationTests, AudioSystem_PushesOnlyDirtyProperties)
+{
+	AudioSystem audioSystem;
+	audioSystem.OnAttach(m_Scene.get());
+
+	Entity emitter = m_Scene->CreateEntity("Emitter");
+	emitter.AddComponent<AudioSourceComponent>().Volume = 0.5f;
+	audioSystem.OnUpdate(0.016f);
+
+	auto& audioComp = emitter.GetComponent<AudioSourceComponent>();
+	ASSERT_NE(audioComp.Source, nullptr);
+	EXPECT_FLOAT_EQ(audioComp.Source->GetVolume(), 0.5f);
+	EXPECT_EQ(audioComp.Dirty, 0);
+
+	// Unflagged writes wait for MarkDirty; setters go out on the next update
+	audioComp.Volume = 0.2f;
+	audioSystem.OnUpdate(0.016f);
+	EXPECT_FLOAT_EQ(audioComp.Source->GetVolume(), 0.5f);
+
+	audioComp.SetPitch(1.5f);
+	audioSystem.OnUpdate(0.016f);
+	EXPECT_FLOAT_EQ(audioComp.Source->GetPitch(), 1.5f);
+	EXPECT_FLOAT_EQ(audioComp.Source->GetVolume(), 0.5f);
+
+	audioComp.MarkDirty(AudioSourceComponent::DirtyVolume);
+	audioSystem.OnUpdate(0.016f);
+	EXPECT_FLOAT_EQ(audioComp.Source->GetVolume(), 0.2f);
+	EXPECT_EQ(audioComp.Dirty, 0);
+}
+
 TEST_F(AudioIntegrationTests, MultipleAudioSources_Independent)
 {
 	Entity emitter1 = m_Scene->CreateEntity("Emitter1");
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+// QuadGeometryTests: batch vertex expansion shared by OpenGLBatchRenderer2D and
+// SpriteRenderSystem::PackQuads, checked without a GL context.
+#include "Pillar/Renderer/QuadGeometry.h"
+#include "Pillar/ECS/Scene.h"
+#include "Pillar/ECS/Entity.h"
+#include "Pillar/ECS/Systems/SpriteRenderSystem.h"
+#include <glm/gtc/constants.hpp>
+#include <vector>
+
+using namespace Pillar;
+
+TEST(QuadGeometry, AxisAlignedCornersAndFlippedUVs)
+{
+    QuadGeometry::QuadVertex quad[4];
+    QuadGeometry::WriteQuad(quad, { 1.0f, 2.0f, 0.5f }, { 2.0f, 4.0f }, 0.0f, glm::vec4(0.5f),
+        { 0.25f, 0.0f }, { 0.75f, 1.0f }, true, false, 3.0f);
+
+    EXPECT_EQ(quad[0].Position, glm::vec3(0.0f, 0.0f, 0.5f));
+    EXPECT_EQ(quad[1].Position, glm::vec3(2.0f, 0.0f, 0.5f));
+    EXPECT_EQ(quad[2].Position, glm::vec3(2.0f, 4.0f, 0.5f));
+    EXPECT_EQ(quad[3].Position, glm::vec3(0.0f, 4.0f, 0.5f));
+
+    // FlipX swaps U only
+    EXPECT_EQ(quad[0].TexCoord, glm::vec2(0.75f, 0.0f));
+    EXPECT_EQ(quad[2].TexCoord, glm::vec2(0.25f, 1.0f));
+    for (const auto& vertex : quad)
+    {
+        EXPECT_EQ(vertex.Color, glm::vec4(0.5f));
+        EXPECT_FLOAT_EQ(vertex.TexIndex, 3.0f);
+    }
+}
+
+TEST(QuadGeometry, RotatedQuadTurnsAroundItsCenter)
+{
+    QuadGeometry::QuadVertex quad[4];
+    QuadGeometry::WriteQuad(quad, { 0.0f, 0.0f, 0.0f }, { 2.0f, 2.0f }, glm::half_pi<float>(), glm::vec4(1.0f),
+        glm::vec2(0.0f), glm::vec2(1.0f), false, false, 0.0f);
+
+    // A quarter turn moves the bottom-left corner to the bottom-right
+    EXPECT_NEAR(quad[0].Position.x, 1.0f, 1e-5f);
+    EXPECT_NEAR(quad[0].Position.y, -1.0f, 1e-5f);
+}
+
+TEST(QuadGeometry, PackQuadsSortsAndSkipsHiddenSprites)
+{
+    Scene scene;
+    auto front = scene.CreateEntity("Front");
+    front.AddComponent<SpriteComponent>().ZIndex = 2.0f;
+    auto back = scene.CreateEntity("Back");
+    back.AddComponent<SpriteComponent>().ZIndex = -1.0f;
+    back.GetComponent<TransformComponent>().Position = { 10.0f, 0.0f };
+    auto hidden = scene.CreateEntity("Hidden");
+    hidden.AddComponent<SpriteComponent>().Visible = false;
+
+    std::vector<entt::entity> order;
+    std::vector<QuadGeometry::QuadVertex> vertices;
+    SpriteRenderSystem::PackQuads(scene, order, vertices);
+
+    ASSERT_EQ(vertices.size(), 8u);
+    EXPECT_FLOAT_EQ(vertices[0].Position.z, -1.0f);
+    EXPECT_FLOAT_EQ(vertices[0].Position.x, 9.5f);
+    EXPECT_FLOAT_EQ(vertices[4].Position.z, 2.0f);
+}
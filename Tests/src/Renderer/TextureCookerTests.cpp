@@ -0,0 +1,359 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "Pillar/Renderer/CookedTexture.h"
+#include "Pillar/Renderer/Texture.h"
+#include "Pillar/Renderer/TextureCooker.h"
+
+using namespace Pillar;
+
+namespace {
+
+    // Reference decoders: what the GPU does with the cooked blocks
+
+    void Expand565(uint16_t packed, int* color)
+    {
+        const int r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+        color[0] = (r << 3) | (r >> 2);
+        color[1] = (g << 2) | (g >> 4);
+        color[2] = (b << 3) | (b >> 2);
+    }
+
+    void DecodeColorBlock(const uint8_t* block, bool forceFourColor, uint8_t* out)
+    {
+        const uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+        const uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+        int palette[4][4] = {};
+        Expand565(c0, palette[0]);
+        Expand565(c1, palette[1]);
+        palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+        if (c0 > c1 || forceFourColor)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            }
+        }
+        else
+        {
+            for (int c = 0; c < 3; ++c)
+                palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][0] = palette[3][1] = palette[3][2] = palette[3][3] = 0;
+        }
+
+        const uint32_t indices = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<uint32_t>(block[7]) << 24);
+        for (int i = 0; i < 16; ++i)
+        {
+            const int* color = palette[(indices >> (2 * i)) & 3];
+            for (int c = 0; c < 4; ++c)
+                out[i * 4 + c] = static_cast<uint8_t>(color[c]);
+        }
+    }
+
+    void DecodeBC3Block(const uint8_t* block, uint8_t* out)
+    {
+        DecodeColorBlock(block + 8, true, out);
+
+        const int a0 = block[0], a1 = block[1];
+        int palette[8] = { a0, a1 };
+        if (a0 > a1)
+        {
+            for (int i = 1; i < 7; ++i)
+                palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+        }
+        else
+        {
+            for (int i = 1; i < 5; ++i)
+                palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        uint64_t indices = 0;
+        for (int b = 0; b < 6; ++b)
+            indices |= static_cast<uint64_t>(block[2 + b]) << (8 * b);
+        for (int i = 0; i < 16; ++i)
+            out[i * 4 + 3] = static_cast<uint8_t>(palette[(indices >> (3 * i)) & 7]);
+    }
+
+    // Mode 6 only, which is all the cooker writes
+    bool DecodeBC7Mode6Block(const uint8_t* block, uint8_t* out)
+    {
+        uint32_t bit = 0;
+        auto read = [&](uint32_t bits) {
+            uint32_t value = 0;
+            for (uint32_t i = 0; i < bits; ++i, ++bit)
+                value |= ((block[bit >> 3] >> (bit & 7)) & 1u) << i;
+            return value;
+        };
+
+        if (read(7) != (1u << 6))
+            return false;
+
+        int endpoints[2][4];
+        for (int c = 0; c < 4; ++c)
+        {
+            endpoints[0][c] = static_cast<int>(read(7));
+            endpoints[1][c] = static_cast<int>(read(7));
+        }
+        const int p0 = static_cast<int>(read(1)), p1 = static_cast<int>(read(1));
+        for (int c = 0; c < 4; ++c)
+        {
+            endpoints[0][c] = (endpoints[0][c] << 1) | p0;
+            endpoints[1][c] = (endpoints[1][c] << 1) | p1;
+        }
+
+        static constexpr int kWeights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+        for (int i = 0; i < 16; ++i)
+        {
+            const int w = kWeights[read(i == 0 ? 3 : 4)];
+            for (int c = 0; c < 4; ++c)
+                out[i * 4 + c] = static_cast<uint8_t>(((64 - w) * endpoints[0][c] + w * endpoints[1][c] + 32) >> 6);
+        }
+        return true;
+    }
+
+    // Smooth diagonal ramp between two colors, the common case for sprites and backgrounds
+    std::vector<uint8_t> GradientBlock(bool varyAlpha)
+    {
+        std::vector<uint8_t> texels(64);
+        for (int y = 0; y < 4; ++y)
+        {
+            for (int x = 0; x < 4; ++x)
+            {
+                const int t = x + y;    // 0..6
+                uint8_t* texel = &texels[(y * 4 + x) * 4];
+                texel[0] = static_cast<uint8_t>(40 + t * 20);
+                texel[1] = static_cast<uint8_t>(200 - t * 25);
+                texel[2] = static_cast<uint8_t>(90 + t * 10);
+                texel[3] = varyAlpha ? static_cast<uint8_t>(255 - t * 40) : 255;
+            }
+        }
+        return texels;
+    }
+
+    double MaxChannelError(const std::vector<uint8_t>& a, const uint8_t* b, int channels)
+    {
+        double worst = 0.0;
+        for (size_t i = 0; i < a.size(); i += 4)
+        {
+            for (int c = 0; c < channels; ++c)
+                worst = std::max(worst, std::fabs(static_cast<double>(a[i + c]) - b[i + c]));
+        }
+        return worst;
+    }
+
+    TextureImage MakeImage(uint32_t width, uint32_t height, uint32_t channels)
+    {
+        TextureImage image;
+        image.Path = "generated";
+        image.Width = width;
+        image.Height = height;
+        image.Channels = channels;
+        image.Pixels.resize(static_cast<size_t>(width) * height * channels);
+        for (size_t i = 0; i < image.Pixels.size(); ++i)
+            image.Pixels[i] = static_cast<uint8_t>((i * 7) & 0xFF);
+        return image;
+    }
+
+    std::string WriteTemp(const std::string& name, const std::vector<uint8_t>& bytes)
+    {
+        const std::string path = (std::filesystem::temp_directory_path() / name).string();
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return path;
+    }
+
+}
+
+// ============================================================================
+// Block encoders
+// ============================================================================
+
+TEST(TextureCooker, BC1SolidBlockIsExactIn565)
+{
+    std::vector<uint8_t> texels(64);
+    for (int i = 0; i < 16; ++i)
+    {
+        texels[i * 4 + 0] = 255;
+        texels[i * 4 + 1] = 0;
+        texels[i * 4 + 2] = 255;
+        texels[i * 4 + 3] = 255;
+    }
+
+    uint8_t block[8], decoded[64];
+    TextureCooker::EncodeBC1Block(texels.data(), block);
+    DecodeColorBlock(block, false, decoded);
+
+    EXPECT_EQ(MaxChannelError(texels, decoded, 4), 0.0);
+}
+
+TEST(TextureCooker, BC1GradientStaysClose)
+{
+    const auto texels = GradientBlock(false);
+    uint8_t block[8], decoded[64];
+    TextureCooker::EncodeBC1Block(texels.data(), block);
+    DecodeColorBlock(block, false, decoded);
+
+    EXPECT_LE(MaxChannelError(texels, decoded, 3), 24.0);
+}
+
+TEST(TextureCooker, BC1PunchThroughAlpha)
+{
+    auto texels = GradientBlock(false);
+    texels[3] = 0;          // Top-left texel transparent
+    texels[15 * 4 + 3] = 0; // And the last one
+
+    uint8_t block[8], decoded[64];
+    TextureCooker::EncodeBC1Block(texels.data(), block);
+    DecodeColorBlock(block, false, decoded);
+
+    EXPECT_EQ(decoded[3], 0);
+    EXPECT_EQ(decoded[15 * 4 + 3], 0);
+    for (int i = 1; i < 15; ++i)
+        EXPECT_EQ(decoded[i * 4 + 3], 255) << "texel " << i;
+}
+
+TEST(TextureCooker, BC3KeepsAlpha)
+{
+    const auto texels = GradientBlock(true);
+    uint8_t block[16], decoded[64];
+    TextureCooker::EncodeBC3Block(texels.data(), block);
+    DecodeBC3Block(block, decoded);
+
+    EXPECT_LE(MaxChannelError(texels, decoded, 3), 24.0);
+    for (int i = 0; i < 16; ++i)
+        EXPECT_NEAR(decoded[i * 4 + 3], texels[i * 4 + 3], 18) << "texel " << i;
+}
+
+TEST(TextureCooker, BC7GradientIsAccurate)
+{
+    const auto texels = GradientBlock(true);
+    uint8_t block[16], decoded[64];
+    TextureCooker::EncodeBC7Block(texels.data(), block);
+    ASSERT_TRUE(DecodeBC7Mode6Block(block, decoded));
+
+    // 4-bit indices and 8-bit endpoints: much tighter than BC1
+    EXPECT_LE(MaxChannelError(texels, decoded, 4), 16.0);
+}
+
+TEST(TextureCooker, BC7SolidBlock)
+{
+    std::vector<uint8_t> texels(64);
+    for (int i = 0; i < 16; ++i)
+    {
+        texels[i * 4 + 0] = 17;
+        texels[i * 4 + 1] = 128;
+        texels[i * 4 + 2] = 250;
+        texels[i * 4 + 3] = 200;
+    }
+
+    uint8_t block[16], decoded[64];
+    TextureCooker::EncodeBC7Block(texels.data(), block);
+    ASSERT_TRUE(DecodeBC7Mode6Block(block, decoded));
+
+    EXPECT_LE(MaxChannelError(texels, decoded, 4), 1.0);
+}
+
+// ============================================================================
+// Mips and container
+// ============================================================================
+
+TEST(TextureCooker, DownsampleAveragesAndClampsOddEdges)
+{
+    // 3x1: the lone last column folds into itself
+    const uint8_t texels[12] = { 0, 0, 0, 0,  100, 100, 100, 100,  50, 60, 70, 80 };
+    std::vector<uint8_t> out;
+    TextureCooker::Downsample(texels, 3, 1, out);
+
+    ASSERT_EQ(out.size(), 4u);
+    EXPECT_EQ(out[0], 50);
+    EXPECT_EQ(out[3], 50);
+}
+
+TEST(TextureCooker, CookWritesFullMipChain)
+{
+    const TextureImage image = MakeImage(20, 6, 3);
+    TextureCookSettings settings;
+    settings.Format = CookedTextures::Format::BC1;
+
+    std::vector<uint8_t> file;
+    ASSERT_TRUE(TextureCooker::Cook(image, settings, file));
+
+    CookedTexture cooked;
+    ASSERT_TRUE(cooked.Load(WriteTemp("pillar_cook_chain.ptex", file)));
+    EXPECT_EQ(cooked.GetFormat(), CookedTextures::Format::BC1);
+    EXPECT_EQ(cooked.GetWidth(), 20u);
+    EXPECT_EQ(cooked.GetHeight(), 6u);
+    ASSERT_EQ(cooked.GetLevelCount(), 5u);      // 20x6, 10x3, 5x1, 2x1, 1x1
+
+    const uint32_t widths[5] = { 20, 10, 5, 2, 1 };
+    const uint32_t heights[5] = { 6, 3, 1, 1, 1 };
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        const auto& level = cooked.GetLevel(i);
+        EXPECT_EQ(level.Width, widths[i]);
+        EXPECT_EQ(level.Height, heights[i]);
+        EXPECT_EQ(level.Size, CookedTextures::GetLevelSize(CookedTextures::Format::BC1, widths[i], heights[i]));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(level.Data) % CookedTextures::kAlignment, 0u);
+    }
+}
+
+TEST(TextureCooker, RGBA8RoundTripsTopLevel)
+{
+    const TextureImage image = MakeImage(4, 4, 4);
+    TextureCookSettings settings;
+    settings.Format = CookedTextures::Format::RGBA8;
+    settings.GenerateMips = false;
+
+    std::vector<uint8_t> file;
+    ASSERT_TRUE(TextureCooker::Cook(image, settings, file));
+
+    CookedTexture cooked;
+    ASSERT_TRUE(cooked.Load(WriteTemp("pillar_cook_rgba.ptex", file)));
+    ASSERT_EQ(cooked.GetLevelCount(), 1u);
+    ASSERT_EQ(cooked.GetLevel(0).Size, image.Pixels.size());
+    EXPECT_EQ(std::memcmp(cooked.GetLevel(0).Data, image.Pixels.data(), image.Pixels.size()), 0);
+    EXPECT_EQ(cooked.GetDataSize(), image.Pixels.size());
+}
+
+TEST(TextureCooker, RejectsCorruptFiles)
+{
+    const TextureImage image = MakeImage(8, 8, 4);
+    std::vector<uint8_t> file;
+    ASSERT_TRUE(TextureCooker::Cook(image, TextureCookSettings{}, file));
+
+    CookedTexture cooked;
+
+    std::vector<uint8_t> badMagic = file;
+    badMagic[0] = 'X';
+    EXPECT_FALSE(cooked.Load(WriteTemp("pillar_cook_magic.ptex", badMagic)));
+
+    std::vector<uint8_t> truncated(file.begin(), file.end() - 16);
+    EXPECT_FALSE(cooked.Load(WriteTemp("pillar_cook_truncated.ptex", truncated)));
+    EXPECT_FALSE(cooked.IsValid());
+
+    EXPECT_TRUE(cooked.Load(WriteTemp("pillar_cook_good.ptex", file)));
+}
+
+TEST(TextureCooker, CookRejectsUnsupportedImages)
+{
+    std::vector<uint8_t> file;
+    EXPECT_FALSE(TextureCooker::Cook(TextureImage{}, TextureCookSettings{}, file));
+    EXPECT_FALSE(TextureCooker::Cook(MakeImage(4, 4, 2), TextureCookSettings{}, file));
+}
+
+TEST(TextureCooker, CookedPathHelpers)
+{
+    EXPECT_TRUE(CookedTexture::IsCookedPath("textures/hero.ptex"));
+    EXPECT_TRUE(CookedTexture::IsCookedPath("HERO.PTEX"));
+    EXPECT_FALSE(CookedTexture::IsCookedPath("hero.png"));
+    EXPECT_EQ(std::filesystem::path(CookedTexture::GetCookedPath("textures/hero.png")).filename().string(), "hero.ptex");
+}
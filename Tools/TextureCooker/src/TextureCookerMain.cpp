@@ -0,0 +1,138 @@
+// TextureCookerMain: entry point for PillarTextureCooker. Cooks source images
+// into .ptex files next to them; Texture2D picks those up instead of the source
+// while they are at least as new. Runs without a window or GPU.
+#include "Pillar/Logger.h"
+#include "Pillar/Renderer/CookedTexture.h"
+#include "Pillar/Renderer/TextureCooker.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+	void PrintUsage()
+	{
+		std::printf(
+			"Usage: PillarTextureCooker [options] <file-or-directory>...\n"
+			"  --format <bc7|bc3|bc1|rgba8>  Pixel format (default bc7)\n"
+			"  --no-mips                     Store only the top level\n"
+			"  --force                       Re-cook files that are up to date\n"
+			"Directories are searched recursively for .png, .jpg, .jpeg, .tga and .bmp files.\n");
+	}
+
+	bool ParseFormat(const char* name, Pillar::CookedTextures::Format& outFormat)
+	{
+		using Pillar::CookedTextures::Format;
+		if (std::strcmp(name, "bc7") == 0)   { outFormat = Format::BC7; return true; }
+		if (std::strcmp(name, "bc3") == 0)   { outFormat = Format::BC3; return true; }
+		if (std::strcmp(name, "bc1") == 0)   { outFormat = Format::BC1; return true; }
+		if (std::strcmp(name, "rgba8") == 0) { outFormat = Format::RGBA8; return true; }
+		return false;
+	}
+
+	bool IsSourceImage(const std::filesystem::path& path)
+	{
+		std::string extension = path.extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(),
+			[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp";
+	}
+
+	bool IsUpToDate(const std::filesystem::path& source, const std::filesystem::path& cooked)
+	{
+		std::error_code error;
+		if (!std::filesystem::exists(cooked, error))
+			return false;
+		const auto sourceTime = std::filesystem::last_write_time(source, error);
+		const auto cookedTime = std::filesystem::last_write_time(cooked, error);
+		return !error && cookedTime >= sourceTime;
+	}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	Pillar::Logger::Init();
+
+	Pillar::TextureCookSettings settings;
+	bool force = false;
+	std::vector<std::filesystem::path> inputs;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+		{
+			if (!ParseFormat(argv[++i], settings.Format))
+			{
+				std::fprintf(stderr, "Unknown format '%s'\n", argv[i]);
+				PrintUsage();
+				return 1;
+			}
+		}
+		else if (std::strcmp(argv[i], "--no-mips") == 0)
+			settings.GenerateMips = false;
+		else if (std::strcmp(argv[i], "--force") == 0)
+			force = true;
+		else if (std::strcmp(argv[i], "--help") == 0)
+		{
+			PrintUsage();
+			return 0;
+		}
+		else if (argv[i][0] == '-')
+		{
+			std::fprintf(stderr, "Unknown option '%s'\n", argv[i]);
+			PrintUsage();
+			return 1;
+		}
+		else
+			inputs.emplace_back(argv[i]);
+	}
+
+	if (inputs.empty())
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	// Expand directories into the images under them
+	std::vector<std::filesystem::path> sources;
+	for (const auto& input : inputs)
+	{
+		std::error_code error;
+		if (std::filesystem::is_directory(input, error))
+		{
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(input, error))
+			{
+				if (entry.is_regular_file() && IsSourceImage(entry.path()))
+					sources.push_back(entry.path());
+			}
+		}
+		else
+			sources.push_back(input);
+	}
+
+	int cooked = 0, skipped = 0, failed = 0;
+	for (const auto& source : sources)
+	{
+		const std::string cookedPath = Pillar::CookedTexture::GetCookedPath(source.string());
+		if (!force && IsUpToDate(source, cookedPath))
+		{
+			++skipped;
+			continue;
+		}
+
+		if (Pillar::TextureCooker::CookFile(source.string(), cookedPath, settings))
+			++cooked;
+		else
+			++failed;
+	}
+
+	std::printf("Cooked %d, up to date %d, failed %d (%s%s)\n", cooked, skipped, failed,
+		Pillar::TextureCooker::GetFormatName(settings.Format), settings.GenerateMips ? ", mips" : "");
+	return failed == 0 ? 0 : 1;
+}